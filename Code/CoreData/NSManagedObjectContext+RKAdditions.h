@@ -22,6 +22,11 @@
 
 @class RKManagedObjectStore;
 
+/**
+ The maximum number of values passed to a single `IN` predicate of a fetch request. Fetches for a larger number of values are split into batches of this size so as not to exceed the limit on the number of variables in a single SQLite statement.
+ */
+extern NSUInteger const RKFetchRequestInPredicateBatchSize;
+
 /**
  Provides extensions to `NSManagedObjectContext` for various common tasks.
  */
@@ -22,6 +22,8 @@
 #import "NSManagedObjectContext+RKAdditions.h"
 #import "RKLog.h"
 
+NSUInteger const RKFetchRequestInPredicateBatchSize = 500;
+
 @implementation NSManagedObjectContext (RKAdditions)
 
 - (id)insertNewObjectForEntityForName:(NSString *)entityName
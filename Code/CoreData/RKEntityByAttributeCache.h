@@ -94,6 +94,41 @@
  */
 - (void)flush:(void (^)(void))completion;
 
+///--------------------------------
+/// @name Loading Objects on Demand
+///--------------------------------
+
+/**
+ Loads the cache with only those instances of the configured entity whose values for the cache key attributes match one of the given dictionaries of attribute values.
+
+ Rather than retrieving every instance of the entity, the objects are fetched with a predicate restricted to the requested values, in batches. Once loaded, a value is known to the cache whether or not any objects were found for it, as reported by `hasLoadedObjectsWithAttributeValues:`. Values that have already been loaded are not fetched again. Like `load:`, the fetch cannot retrieve pending objects, which must be added via `addObjects:completion:`.
+
+ When the `maximumNumberOfLoadedAttributeValues` is exceeded, the values loaded by earlier invocations are evicted from the cache in the order they were loaded.
+
+ @param arrayOfAttributeValues An array of dictionaries of values for the cache key attributes. Values may be collections, in which case the objects for each value of the collection are loaded.
+ @param completion A block to execute when the objects have been loaded.
+ */
+- (void)loadObjectsWithAttributeValues:(NSArray *)arrayOfAttributeValues completion:(void (^)(void))completion;
+
+/**
+ Returns a Boolean value that indicates whether the objects with the given values for the cache key attributes have been loaded, either by `load:` or by `loadObjectsWithAttributeValues:completion:`.
+
+ If this method returns `YES`, then the result of `objectsWithAttributeValues:inContext:` for the given values reflects the persistent store as of the load, and an empty result means that no such objects exist.
+
+ @param attributeValues A dictionary of values for the cache key attributes.
+ @return `YES` if the objects with the given attribute values have been loaded, else `NO`.
+ */
+- (BOOL)hasLoadedObjectsWithAttributeValues:(NSDictionary *)attributeValues;
+
+/**
+ The maximum number of distinct attribute values whose objects the receiver retains after loading them with `loadObjectsWithAttributeValues:completion:`. A value of zero does not limit the number of loaded values.
+
+ The limit is enforced each time objects are loaded on demand or added with `addObjects:completion:`, by evicting the values cached earliest. Values loaded on demand and values of added objects count against the limit alike. Values for which an object with a temporary managed object ID is cached are never evicted, so that pending objects remain retrievable. The limit does not apply to a cache loaded in full by `load:`.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger maximumNumberOfLoadedAttributeValues;
+
 ///-----------------------------
 /// @name Inspecting Cache State
 ///-----------------------------
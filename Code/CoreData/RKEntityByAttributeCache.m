@@ -27,40 +27,175 @@
 #import "RKPropertyInspector.h"
 #import "RKPropertyInspector+CoreData.h"
 #import "NSManagedObject+RKAdditions.h"
+#import "NSManagedObjectContext+RKAdditions.h"
 #import "RKObjectUtilities.h"
 
 // Set Logging Component
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitCoreDataCache
 
-static id RKCacheKeyValueForEntityAttributeWithValue(NSEntityDescription *entity, NSString *attribute, id value)
+/*
+ Cache keys compare attribute values by their textual representation, such that the numeric value `@12345` and the string `@"12345"` identify the same objects. Rather than formatting every value as a string, values whose textual representation is a canonical decimal integer are stored as 64-bit integers and all other values as strings.
+ */
+static BOOL RKIntegerValueFromCanonicalDecimalString(NSString *string, int64_t *integerValue)
 {
-    if ([value isKindOfClass:[NSString class]] || [value isEqual:[NSNull null]]) {
-        return value;
+    CFIndex length = CFStringGetLength((__bridge CFStringRef)string);
+    if (length == 0 || length > 20) return NO;
+
+    UniChar characters[20];
+    CFStringGetCharacters((__bridge CFStringRef)string, CFRangeMake(0, length), characters);
+    BOOL isNegative = (characters[0] == '-');
+    CFIndex index = isNegative ? 1 : 0;
+    if (index == length) return NO;
+    // Leading zeros and negative zero have a different textual representation than the integer they denote
+    if (characters[index] == '0' && (length - index > 1 || isNegative)) return NO;
+
+    uint64_t magnitude = 0;
+    uint64_t limit = isNegative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+    for (; index < length; index++) {
+        UniChar character = characters[index];
+        if (character < '0' || character > '9') return NO;
+        uint64_t digit = character - '0';
+        if (magnitude > (limit - digit) / 10) return NO;
+        magnitude = magnitude * 10 + digit;
     }
-    return [value respondsToSelector:@selector(stringValue)] ? [value stringValue] : value;
+
+    *integerValue = isNegative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+    return YES;
 }
 
-static NSString *RKCacheKeyForEntityWithAttributeValues(NSEntityDescription *entity, NSDictionary *attributeValues)
+// Returns YES and the integer if the textual representation of the value is a canonical decimal integer, else NO and the textual representation
+static BOOL RKCacheKeyComponentFromValue(id value, int64_t *integerValue, NSString **stringValue)
 {
-    // Performance optimization
-    if ([attributeValues count] == 1) return [[[attributeValues allValues] lastObject] description];
-    NSArray *sortedAttributes = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
-    NSMutableArray *sortedValues = [NSMutableArray arrayWithCapacity:[sortedAttributes count]];
-    for (NSString *attributeName in sortedAttributes) {
-        id cacheKeyValue = RKCacheKeyValueForEntityAttributeWithValue(entity, attributeName, attributeValues[attributeName]);
-        [sortedValues addObject:cacheKeyValue];
-    };
-    
-    return [sortedValues componentsJoinedByString:@":"];
+    if ([value isKindOfClass:[NSNumber class]] && ![value isKindOfClass:[NSDecimalNumber class]]) {
+        const char *type = [value objCType];
+        switch (type[0]) {
+            case 'c': case 'C': case 's': case 'S': case 'i': case 'I': case 'l': case 'L': case 'q': case 'B':
+                *integerValue = [value longLongValue];
+                return YES;
+            case 'Q':
+                if ([value unsignedLongLongValue] <= INT64_MAX) {
+                    *integerValue = [value longLongValue];
+                    return YES;
+                }
+                break;
+            case 'f': case 'd': {
+                // Beyond 1e15 the description of a double may switch to exponential notation
+                double doubleValue = [value doubleValue];
+                if (doubleValue == trunc(doubleValue) && fabs(doubleValue) < 1e15 && !(doubleValue == 0 && signbit(doubleValue))) {
+                    *integerValue = (int64_t)doubleValue;
+                    return YES;
+                }
+                break;
+            }
+        }
+    }
+
+    NSString *string = [value isKindOfClass:[NSString class]] ? value : [value description];
+    if (RKIntegerValueFromCanonicalDecimalString(string, integerValue)) return YES;
+    *stringValue = string;
+    return NO;
+}
+
+static NSUInteger RKHashForInteger(int64_t integerValue)
+{
+    uint64_t hash = (uint64_t)integerValue;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return (NSUInteger)hash;
+}
+
+/**
+ An immutable key identifying the cached objects with a particular combination of attribute values. Single values are held inline and composite values as a tuple in the order of the sorted attribute names.
+ */
+@interface RKEntityCacheKey : NSObject <NSCopying>
+- (instancetype)initWithAttributeValues:(NSDictionary *)attributeValues sortedAttributeNames:(NSArray *)sortedAttributeNames;
+@end
+
+@implementation RKEntityCacheKey {
+    BOOL _isInteger;
+    int64_t _integerValue;
+    NSString *_stringValue;
+    NSArray *_components;
+    NSUInteger _hash;
+}
+
+- (instancetype)initWithAttributeValues:(NSDictionary *)attributeValues sortedAttributeNames:(NSArray *)sortedAttributeNames
+{
+    self = [super init];
+    if (self) {
+        NSUInteger count = [attributeValues count];
+        if (count == 1) {
+            const void *value = NULL;
+            CFDictionaryGetKeysAndValues((__bridge CFDictionaryRef)attributeValues, NULL, &value);
+            NSString *stringValue = nil;
+            _isInteger = RKCacheKeyComponentFromValue((__bridge id)value, &_integerValue, &stringValue);
+            _stringValue = stringValue;
+            _hash = _isInteger ? RKHashForInteger(_integerValue) : [_stringValue hash];
+        } else {
+            if ([sortedAttributeNames count] != count) sortedAttributeNames = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
+            NSMutableArray *components = [NSMutableArray arrayWithCapacity:count];
+            NSUInteger hash = count;
+            for (NSString *attributeName in sortedAttributeNames) {
+                int64_t integerValue = 0;
+                NSString *stringValue = nil;
+                id value = attributeValues[attributeName] ?: [NSNull null];
+                if (RKCacheKeyComponentFromValue(value, &integerValue, &stringValue)) {
+                    [components addObject:@(integerValue)];
+                    hash = hash * 31 + RKHashForInteger(integerValue);
+                } else {
+                    [components addObject:stringValue];
+                    hash = hash * 31 + [stringValue hash];
+                }
+            }
+            _components = components;
+            _hash = hash;
+        }
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return self;
+}
+
+- (NSUInteger)hash
+{
+    return _hash;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (! [object isKindOfClass:[RKEntityCacheKey class]]) return NO;
+    RKEntityCacheKey *key = object;
+    if (_hash != key->_hash) return NO;
+    if (_components || key->_components) return [_components isEqualToArray:key->_components];
+    if (_isInteger != key->_isInteger) return NO;
+    return _isInteger ? (_integerValue == key->_integerValue) : [_stringValue isEqualToString:key->_stringValue];
+}
+
+- (NSString *)description
+{
+    if (_components) return [_components componentsJoinedByString:@":"];
+    return _isInteger ? [NSString stringWithFormat:@"%lld", _integerValue] : _stringValue;
+}
+
+@end
+
+static RKEntityCacheKey *RKCacheKeyWithAttributeValues(NSArray *sortedAttributeNames, NSDictionary *attributeValues)
+{
+    return [[RKEntityCacheKey alloc] initWithAttributeValues:attributeValues sortedAttributeNames:sortedAttributeNames];
 }
 
 /*
- This function recursively calculates a set of cache keys given a dictionary of attribute values. The basic premise is that we wish to decompose all arrays of values within the dictionary into a distinct cache key, as each object within the cache will appear for only one key.
+ This function recursively decomposes a dictionary of attribute values into an array of dictionaries that do not contain collections. The basic premise is that we wish to decompose all arrays of values within the dictionary into a distinct cache key, as each object within the cache will appear for only one key.
  */
-static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *entity, NSDictionary *attributeValues)
+static NSArray *RKDecomposedAttributeValuesFromAttributeValues(NSDictionary *attributeValues)
 {
-    NSMutableArray *cacheKeys = [NSMutableArray array];
+    NSMutableArray *decomposedAttributeValues = [NSMutableArray array];
     NSSet *collectionKeys = [attributeValues keysOfEntriesPassingTest:^BOOL(id key, id obj, BOOL *stop) {
         return RKObjectIsCollection(obj);
     }];
@@ -71,18 +206,85 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
             for (id value in attributeValue) {
                 NSMutableDictionary *mutableAttributeValues = [attributeValues mutableCopy];
                 [mutableAttributeValues setValue:value forKey:attributeName];
-                [cacheKeys addObjectsFromArray:RKCacheKeysForEntityFromAttributeValues(entity, mutableAttributeValues)];
+                [decomposedAttributeValues addObjectsFromArray:RKDecomposedAttributeValuesFromAttributeValues(mutableAttributeValues)];
             }
         }
     } else {
-        [cacheKeys addObject:RKCacheKeyForEntityWithAttributeValues(entity, attributeValues)];
+        [decomposedAttributeValues addObject:attributeValues];
+    }
+
+    return decomposedAttributeValues;
+}
+
+static NSArray *RKCacheKeysFromAttributeValues(NSArray *sortedAttributeNames, NSDictionary *attributeValues)
+{
+    BOOL containsCollection = NO;
+    for (id value in [attributeValues objectEnumerator]) {
+        if (RKObjectIsCollection(value)) {
+            containsCollection = YES;
+            break;
+        }
     }
+    if (! containsCollection) return @[ RKCacheKeyWithAttributeValues(sortedAttributeNames, attributeValues) ];
 
+    NSArray *decomposedAttributeValues = RKDecomposedAttributeValuesFromAttributeValues(attributeValues);
+    NSMutableArray *cacheKeys = [NSMutableArray arrayWithCapacity:[decomposedAttributeValues count]];
+    for (NSDictionary *values in decomposedAttributeValues) {
+        [cacheKeys addObject:RKCacheKeyWithAttributeValues(sortedAttributeNames, values)];
+    }
     return cacheKeys;
 }
 
+// Cache keys normalize numeric values to strings, so string values must be converted back before they are compared in the store
+id RKAttributeValueCoercedToAttributeType(NSAttributeDescription *attribute, id value);
+id RKAttributeValueCoercedToAttributeType(NSAttributeDescription *attribute, id value)
+{
+    if (! [value isKindOfClass:[NSString class]]) return value;
+    switch ([attribute attributeType]) {
+        case NSInteger16AttributeType:
+        case NSInteger32AttributeType:
+        case NSInteger64AttributeType:
+            return @([value longLongValue]);
+        case NSDoubleAttributeType:
+        case NSFloatAttributeType:
+            return @([value doubleValue]);
+        case NSDecimalAttributeType:
+            return [NSDecimalNumber decimalNumberWithString:value];
+        default:
+            return value;
+    }
+}
+
+// For compound attributes the conjunction of `IN` predicates matches a superset of the given combinations of values
+static NSPredicate *RKPredicateForEntityWithArrayOfAttributeValues(NSEntityDescription *entity, NSArray *attributeNames, NSArray *arrayOfAttributeValues)
+{
+    NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:[attributeNames count]];
+    for (NSString *attributeName in attributeNames) {
+        NSAttributeDescription *attribute = [entity attributesByName][attributeName];
+        NSMutableSet *values = [NSMutableSet setWithCapacity:[arrayOfAttributeValues count]];
+        BOOL includesNil = NO;
+        for (NSDictionary *attributeValues in arrayOfAttributeValues) {
+            id value = attributeValues[attributeName];
+            if (value == nil || value == [NSNull null]) {
+                includesNil = YES;
+            } else {
+                [values addObject:RKAttributeValueCoercedToAttributeType(attribute, value)];
+            }
+        }
+
+        NSPredicate *predicate = [NSPredicate predicateWithFormat:@"%K IN %@", attributeName, values];
+        if (includesNil) predicate = [NSCompoundPredicate orPredicateWithSubpredicates:@[ predicate, [NSPredicate predicateWithFormat:@"%K == nil", attributeName] ]];
+        [subpredicates addObject:predicate];
+    }
+    return [NSCompoundPredicate andPredicateWithSubpredicates:subpredicates];
+}
+
 @interface RKEntityByAttributeCache ()
+@property (nonatomic, copy) NSArray *sortedAttributes;
 @property (nonatomic, strong) NSMutableDictionary *cacheKeysToObjectIDs;
+@property (nonatomic, strong) NSMutableOrderedSet *loadedCacheKeys;
+@property (nonatomic, strong) NSMutableOrderedSet *boundedCacheKeys;
+@property (nonatomic, assign) BOOL loadedAllObjects;
 #if OS_OBJECT_USE_OBJC
 @property (nonatomic, strong) dispatch_queue_t queue;
 #else
@@ -102,6 +304,7 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
     if (self) {
         _entity = entity;
         _attributes = attributeNames;
+        self.sortedAttributes = [attributeNames sortedArrayUsingSelector:@selector(compare:)];
         _managedObjectContext = context;
         NSString *queueName = [[NSString alloc] initWithFormat:@"%@.%p", @"org.restkit.core-data.entity-by-attribute-cache", self];
         self.queue = dispatch_queue_create([queueName UTF8String], DISPATCH_QUEUE_CONCURRENT);        
@@ -151,7 +354,7 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
     return [[self objectsWithAttributeValues:attributeValues inContext:self.managedObjectContext] count];
 }
 
-- (void)load:(void (^)(void))completion
+- (NSFetchRequest *)fetchRequestForObjectIDsAndAttributeValues
 {
     NSExpressionDescription* objectIDExpression = [NSExpressionDescription new];
     objectIDExpression.name = @"objectID";
@@ -163,7 +366,12 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
     fetchRequest.entity = self.entity;
     fetchRequest.resultType = NSDictionaryResultType;
     fetchRequest.propertiesToFetch = [self.attributes arrayByAddingObject:objectIDExpression];
+    return fetchRequest;
+}
 
+- (void)load:(void (^)(void))completion
+{
+    NSFetchRequest *fetchRequest = [self fetchRequestForObjectIDsAndAttributeValues];
     [self.managedObjectContext performBlock:^{
         NSError *error = nil;
         NSArray *dictionaries = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
@@ -183,17 +391,140 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
                 NSDictionary *attributeValues = [dictionary dictionaryWithValuesForKeys:self.attributes];
                 [self cacheObjectID:objectID forAttributeValues:attributeValues];
             }
+            self.loadedAllObjects = (dictionaries != nil);
+            self.loadedCacheKeys = nil;
+            self.boundedCacheKeys = nil;
             
             if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
         });
      }];
 }
 
+- (void)loadObjectsWithAttributeValues:(NSArray *)arrayOfAttributeValues completion:(void (^)(void))completion
+{
+    NSParameterAssert(arrayOfAttributeValues);
+    NSMutableDictionary *attributeValuesByCacheKey = [NSMutableDictionary dictionaryWithCapacity:[arrayOfAttributeValues count]];
+    for (NSDictionary *attributeValues in arrayOfAttributeValues) {
+        for (NSDictionary *decomposedAttributeValues in RKDecomposedAttributeValuesFromAttributeValues(attributeValues)) {
+            attributeValuesByCacheKey[RKCacheKeyWithAttributeValues(self.sortedAttributes, decomposedAttributeValues)] = decomposedAttributeValues;
+        }
+    }
+
+    __block NSArray *cacheKeysToLoad = nil;
+    dispatch_sync(self.queue, ^{
+        if (self.loadedAllObjects) return;
+        NSMutableArray *cacheKeys = [NSMutableArray arrayWithCapacity:[attributeValuesByCacheKey count]];
+        for (RKEntityCacheKey *cacheKey in attributeValuesByCacheKey) {
+            if (! [self.loadedCacheKeys containsObject:cacheKey]) [cacheKeys addObject:cacheKey];
+        }
+        cacheKeysToLoad = cacheKeys;
+    });
+    if ([cacheKeysToLoad count] == 0) {
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+        return;
+    }
+
+    [self.managedObjectContext performBlock:^{
+        NSMutableArray *dictionaries = [NSMutableArray array];
+        NSMutableArray *loadedCacheKeys = [NSMutableArray arrayWithCapacity:[cacheKeysToLoad count]];
+        for (NSUInteger location = 0; location < [cacheKeysToLoad count]; location += RKFetchRequestInPredicateBatchSize) {
+            NSArray *batchCacheKeys = [cacheKeysToLoad subarrayWithRange:NSMakeRange(location, MIN(RKFetchRequestInPredicateBatchSize, [cacheKeysToLoad count] - location))];
+            NSFetchRequest *fetchRequest = [self fetchRequestForObjectIDsAndAttributeValues];
+            fetchRequest.predicate = RKPredicateForEntityWithArrayOfAttributeValues(self.entity, self.attributes, [attributeValuesByCacheKey objectsForKeys:batchCacheKeys notFoundMarker:[NSNull null]]);
+
+            NSError *error = nil;
+            NSArray *batchDictionaries = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
+            if (batchDictionaries) {
+                [dictionaries addObjectsFromArray:batchDictionaries];
+                [loadedCacheKeys addObjectsFromArray:batchCacheKeys];
+            } else {
+                RKLogWarning(@"Failed to load %ld attribute values into entity cache. Failed to execute fetch request: %@", (long) [batchCacheKeys count], fetchRequest);
+                RKLogCoreDataError(error);
+            }
+        }
+        RKLogDebug(@"Retrieved %ld dictionaries for cachable `NSManagedObjectID` objects with %ld attribute values of Entity '%@'", (long) [dictionaries count], (long) [loadedCacheKeys count], self.entity.name);
+
+        dispatch_barrier_async(self.queue, ^{
+            NSSet *requestedCacheKeys = [NSSet setWithArray:loadedCacheKeys];
+            for (NSDictionary *dictionary in dictionaries) {
+                NSDictionary *attributeValues = [dictionary dictionaryWithValuesForKeys:self.attributes];
+                if (! [requestedCacheKeys containsObject:RKCacheKeyWithAttributeValues(self.sortedAttributes, attributeValues)]) continue;
+                [self cacheObjectID:dictionary[@"objectID"] forAttributeValues:attributeValues];
+            }
+
+            if (! self.loadedAllObjects) {
+                if (! self.loadedCacheKeys) self.loadedCacheKeys = [NSMutableOrderedSet orderedSet];
+                [self.loadedCacheKeys addObjectsFromArray:loadedCacheKeys];
+                [self boundCacheKeys:loadedCacheKeys];
+            }
+
+            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+        });
+    }];
+}
+
+// Pre-condition: invoked from a barrier block on the receiver's queue. Keys cached by objects that were loaded or added count against
+// the limit alike. The given keys are kept even if they alone exceed the limit.
+- (void)boundCacheKeys:(NSArray *)cacheKeys
+{
+    if (self.loadedAllObjects || self.maximumNumberOfLoadedAttributeValues == 0) return;
+
+    if (! self.boundedCacheKeys) self.boundedCacheKeys = [NSMutableOrderedSet orderedSet];
+    NSUInteger numberOfPreviouslyBoundedCacheKeys = [self.boundedCacheKeys count];
+    [self.boundedCacheKeys addObjectsFromArray:cacheKeys];
+    if ([self.boundedCacheKeys count] <= self.maximumNumberOfLoadedAttributeValues) return;
+
+    NSSet *retainedCacheKeys = [NSSet setWithArray:cacheKeys];
+    NSUInteger numberOfCacheKeysToEvict = [self.boundedCacheKeys count] - self.maximumNumberOfLoadedAttributeValues;
+    NSMutableIndexSet *evictedIndexes = [NSMutableIndexSet indexSet];
+    for (NSUInteger idx = 0; idx < numberOfPreviouslyBoundedCacheKeys && [evictedIndexes count] < numberOfCacheKeysToEvict; idx++) {
+        RKEntityCacheKey *cacheKey = self.boundedCacheKeys[idx];
+        if ([retainedCacheKeys containsObject:cacheKey]) continue;
+        BOOL containsTemporaryObjectID = NO;
+        for (NSManagedObjectID *objectID in self.cacheKeysToObjectIDs[cacheKey]) {
+            if ([objectID isTemporaryID]) {
+                containsTemporaryObjectID = YES;
+                break;
+            }
+        }
+        if (containsTemporaryObjectID) continue;
+
+        [self.cacheKeysToObjectIDs removeObjectForKey:cacheKey];
+        [self.loadedCacheKeys removeObject:cacheKey];
+        [evictedIndexes addIndex:idx];
+    }
+    [self.boundedCacheKeys removeObjectsAtIndexes:evictedIndexes];
+    RKLogTrace(@"Evicted %ld attribute values from entity cache for Entity '%@'", (long) [evictedIndexes count], self.entity.name);
+}
+
+- (BOOL)hasLoadedObjectsWithAttributeValues:(NSDictionary *)attributeValues
+{
+    NSArray *cacheKeys = RKCacheKeysFromAttributeValues(self.sortedAttributes, attributeValues);
+    __block BOOL hasLoaded = NO;
+    dispatch_sync(self.queue, ^{
+        if (self.loadedAllObjects) {
+            hasLoaded = YES;
+            return;
+        }
+        hasLoaded = ([cacheKeys count] > 0);
+        for (RKEntityCacheKey *cacheKey in cacheKeys) {
+            if (! [self.loadedCacheKeys containsObject:cacheKey]) {
+                hasLoaded = NO;
+                break;
+            }
+        }
+    });
+    return hasLoaded;
+}
+
 - (void)flush:(void (^)(void))completion
 {
     dispatch_barrier_async(self.queue, ^{
         RKLogDebug(@"Flushing entity cache for Entity '%@' by attributes '%@'", self.entity.name, self.attributes);
         self.cacheKeysToObjectIDs = nil;
+        self.loadedCacheKeys = nil;
+        self.boundedCacheKeys = nil;
+        self.loadedAllObjects = NO;
         if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
     });
 }
@@ -239,8 +570,8 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 - (NSSet *)objectsWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context
 {
     NSMutableSet *objects = [NSMutableSet set];
-    NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-    for (NSString *cacheKey in cacheKeys) {
+    NSArray *cacheKeys = RKCacheKeysFromAttributeValues(self.sortedAttributes, attributeValues);
+    for (RKEntityCacheKey *cacheKey in cacheKeys) {
         __block NSSet *objectIDs = nil;
         dispatch_sync(self.queue, ^{
             objectIDs = [[NSSet alloc] initWithSet:(self.cacheKeysToObjectIDs)[cacheKey] copyItems:YES];
@@ -269,7 +600,7 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 {
     NSParameterAssert(objectID);
     NSParameterAssert(attributeValues);
-    NSString *cacheKey = RKCacheKeyForEntityWithAttributeValues(self.entity, attributeValues);
+    RKEntityCacheKey *cacheKey = RKCacheKeyWithAttributeValues(self.sortedAttributes, attributeValues);
     NSMutableSet *objectIDs = (self.cacheKeysToObjectIDs)[cacheKey];
     if (objectIDs) {
         if (! [objectIDs containsObject:objectID]) {
@@ -280,15 +611,15 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
     }
     
     if (nil == self.cacheKeysToObjectIDs) self.cacheKeysToObjectIDs = [NSMutableDictionary dictionary];
-    [self.cacheKeysToObjectIDs setValue:objectIDs forKey:cacheKey];
+    self.cacheKeysToObjectIDs[cacheKey] = objectIDs;
 }
 
 - (void)deleteObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
 {
     NSParameterAssert(objectID);
     NSParameterAssert(attributeValues);
-    NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-    for (NSString *cacheKey in cacheKeys) {
+    NSArray *cacheKeys = RKCacheKeysFromAttributeValues(self.sortedAttributes, attributeValues);
+    for (RKEntityCacheKey *cacheKey in cacheKeys) {
         NSMutableSet *objectIDs = (self.cacheKeysToObjectIDs)[cacheKey];
         if (objectIDs && [objectIDs containsObject:objectID]) {
             [objectIDs removeObject:objectID];
@@ -299,9 +630,9 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 - (void)evictObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
 {
     if (attributeValues && [attributeValues count]) {
-        NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
+        NSArray *cacheKeys = RKCacheKeysFromAttributeValues(self.sortedAttributes, attributeValues);
         dispatch_barrier_async(self.queue, ^{
-            for (NSString *cacheKey in cacheKeys) {
+            for (RKEntityCacheKey *cacheKey in cacheKeys) {
                 NSMutableSet *objectIDs = (self.cacheKeysToObjectIDs)[cacheKey];
                 if (objectIDs && [objectIDs containsObject:objectID]) {
                     [objectIDs removeObject:objectID];
@@ -336,9 +667,12 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
         
         if ([newObjectIDsToAttributeValues count]) {
             dispatch_barrier_async(self.queue, ^{
+                NSMutableArray *cacheKeys = [NSMutableArray arrayWithCapacity:[newObjectIDsToAttributeValues count]];
                 [newObjectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
                     [self cacheObjectID:objectID forAttributeValues:attributeValues];
+                    [cacheKeys addObject:RKCacheKeyWithAttributeValues(self.sortedAttributes, attributeValues)];
                 }];
+                [self boundCacheKeys:cacheKeys];
                 
                 if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
             });
@@ -76,6 +76,36 @@
  */
 - (BOOL)isEntity:(NSEntityDescription *)entity cachedByAttributes:(NSArray *)attributeNames;
 
+/**
+ Caches the instances of an entity whose values for the given attributes match one of the given dictionaries of attribute values, rather than all instances of the entity.
+
+ Values that have already been loaded are not fetched again. New entity attribute caches are created with the `maximumNumberOfLoadedAttributeValues` of the receiver.
+
+ @param entity The entity to cache instances of.
+ @param attributeNames The attributes to cache the instances by.
+ @param arrayOfAttributeValues An array of dictionaries of values for the given attributes.
+ @param completion An optional block to be executed when the instances have been cached.
+ @see `[RKEntityByAttributeCache loadObjectsWithAttributeValues:completion:]`
+ */
+- (void)cacheObjectsForEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames withAttributeValues:(NSArray *)arrayOfAttributeValues completion:(void (^)(void))completion;
+
+/**
+ Returns a Boolean value indicating if the instances of an entity with the given attribute values have been cached, either because all instances of the entity have been cached by the attributes or because the given values have been loaded on demand.
+
+ @param entity The entity to check the cache status of.
+ @param attributeValues A dictionary of values for the attributes the entity is cached by.
+ @return YES if the instances with the given attribute values have been loaded, else NO.
+ */
+- (BOOL)isEntity:(NSEntityDescription *)entity cachedWithAttributeValues:(NSDictionary *)attributeValues;
+
+/**
+ The maximum number of attribute values assigned to the entity attribute caches created by `cacheObjectsForEntity:byAttributes:withAttributeValues:completion:`. A value of zero does not limit the number of loaded values.
+
+ **Default**: `0`
+ @see `[RKEntityByAttributeCache maximumNumberOfLoadedAttributeValues]`
+ */
+@property (nonatomic, assign) NSUInteger maximumNumberOfLoadedAttributeValues;
+
 /**
  Retrieves the first cached instance of a given entity where the specified attribute matches the given value.
 
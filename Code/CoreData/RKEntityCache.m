@@ -67,6 +67,29 @@
     return (attributeCache && attributeCache.isLoaded);
 }
 
+- (void)cacheObjectsForEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames withAttributeValues:(NSArray *)arrayOfAttributeValues completion:(void (^)(void))completion
+{
+    NSParameterAssert(entity);
+    NSParameterAssert(attributeNames);
+    NSParameterAssert(arrayOfAttributeValues);
+    RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributes:attributeNames];
+    if (! attributeCache) {
+        attributeCache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:attributeNames managedObjectContext:self.managedObjectContext];
+        attributeCache.callbackQueue = self.callbackQueue;
+        attributeCache.maximumNumberOfLoadedAttributeValues = self.maximumNumberOfLoadedAttributeValues;
+        [self.attributeCaches addObject:attributeCache];
+    }
+    [attributeCache loadObjectsWithAttributeValues:arrayOfAttributeValues completion:completion];
+}
+
+- (BOOL)isEntity:(NSEntityDescription *)entity cachedWithAttributeValues:(NSDictionary *)attributeValues
+{
+    NSParameterAssert(entity);
+    NSParameterAssert(attributeValues);
+    RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributes:[attributeValues allKeys]];
+    return [attributeCache hasLoadedObjectsWithAttributeValues:attributeValues];
+}
+
 - (NSManagedObject *)objectForEntity:(NSEntityDescription *)entity withAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context
 {
     NSParameterAssert(entity);
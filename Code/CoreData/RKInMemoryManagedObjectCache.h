@@ -39,4 +39,28 @@
  */
 - (instancetype)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext NS_DESIGNATED_INITIALIZER;
 
+///--------------------------------
+/// @name Configuring Cache Loading
+///--------------------------------
+
+/**
+ A Boolean value that determines whether the receiver loads only the instances of an entity that are looked up, rather than every instance of the entity.
+
+ By default, the first lookup of an entity by a set of attributes blocks while all instances of the entity are loaded into memory, which for large entities stalls mapping and retains an association for every row. When this property is `YES`, each lookup of attribute values that have not been loaded before fetches the identifiers of just the matching objects and caches them, including the knowledge that no such object exists. Objects created and fetched during mapping are added to the cache. Objects that have been inserted into a looked-up managed object context but not yet saved are tracked for that context alone, as their temporary object IDs cannot be resolved by any other context; insertions become visible to lookups once the context has processed its pending changes. The attribute values of a response that are known in advance are loaded with batched fetches via `loadManagedObjectsWithEntity:arrayOfAttributeValues:inManagedObjectContext:`.
+
+ The property should be set before the receiver is used.
+
+ **Default**: `NO`
+ */
+@property (nonatomic, assign) BOOL loadsObjectsOnDemand;
+
+/**
+ The maximum number of attribute values that the receiver retains for each entity and set of attributes when loading objects on demand. A value of zero does not limit the number of loaded values.
+
+ When the limit is exceeded, the attribute values cached earliest are evicted and will be loaded again on their next lookup. The values of objects added to the cache because they were inserted, created or fetched count against the limit as well as the loaded values. The limit has no effect unless `loadsObjectsOnDemand` is `YES`, and should be set before the receiver is used.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger maximumNumberOfCachedAttributeValues;
+
 @end
@@ -50,6 +50,8 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
 @interface RKInMemoryManagedObjectCache ()
 @property (nonatomic, strong, readwrite) RKEntityCache *entityCache;
 @property (nonatomic, assign) dispatch_queue_t callbackQueue;
+@property (nonatomic, weak) NSManagedObjectContext *observedManagedObjectContext;
+@property (nonatomic, strong) NSMapTable *insertedObjectCachesByLookupContext;
 @end
 
 @implementation RKInMemoryManagedObjectCache
@@ -62,6 +64,8 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
         [cacheContext setPersistentStoreCoordinator:RKPersistentStoreCoordinatorFromManagedObjectContext(managedObjectContext)];
         self.entityCache = [[RKEntityCache alloc] initWithManagedObjectContext:cacheContext];
         self.entityCache.callbackQueue = RKInMemoryManagedObjectCacheCallbackQueue();
+        self.observedManagedObjectContext = managedObjectContext;
+        self.insertedObjectCachesByLookupContext = [NSMapTable weakToStrongObjectsMapTable];
         
         [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(handleManagedObjectContextDidChangeNotification:) name:NSManagedObjectContextObjectsDidChangeNotification object:managedObjectContext];
     }
@@ -90,6 +94,13 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     NSParameterAssert(managedObjectContext);
     
     NSArray *attributes = [attributeValues allKeys];
+    if (self.loadsObjectsOnDemand) {
+        [self loadObjectsWithEntity:entity arrayOfAttributeValues:@[ attributeValues ] inManagedObjectContext:managedObjectContext];
+        NSSet *objects = [self.entityCache objectsForEntity:entity withAttributeValues:attributeValues inContext:managedObjectContext];
+        RKEntityByAttributeCache *insertedObjectCache = [self insertedObjectCacheForEntity:entity attributes:attributes inManagedObjectContext:managedObjectContext];
+        return insertedObjectCache ? [objects setByAddingObjectsFromSet:[insertedObjectCache objectsWithAttributeValues:attributeValues inContext:managedObjectContext]] : objects;
+    }
+
     if (! [self.entityCache isEntity:entity cachedByAttributes:attributes]) {
         RKLogInfo(@"Caching instances of Entity '%@' by attributes '%@'", entity.name, [attributes componentsJoinedByString:@", "]);
         dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
@@ -130,6 +141,108 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     return [self.entityCache objectsForEntity:entity withAttributeValues:attributeValues inContext:managedObjectContext];
 }
 
+- (void)loadManagedObjectsWithEntity:(NSEntityDescription *)entity
+              arrayOfAttributeValues:(NSArray *)arrayOfAttributeValues
+              inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSParameterAssert(entity);
+    NSParameterAssert(arrayOfAttributeValues);
+    NSParameterAssert(managedObjectContext);
+
+    // Objects are loaded in full upon the first lookup unless they are loaded on demand
+    if (self.loadsObjectsOnDemand) [self loadObjectsWithEntity:entity arrayOfAttributeValues:arrayOfAttributeValues inManagedObjectContext:managedObjectContext];
+}
+
+- (void)setMaximumNumberOfCachedAttributeValues:(NSUInteger)maximumNumberOfCachedAttributeValues
+{
+    _maximumNumberOfCachedAttributeValues = maximumNumberOfCachedAttributeValues;
+    self.entityCache.maximumNumberOfLoadedAttributeValues = maximumNumberOfCachedAttributeValues;
+}
+
+- (void)loadObjectsWithEntity:(NSEntityDescription *)entity arrayOfAttributeValues:(NSArray *)arrayOfAttributeValues inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    // Values that have not been loaded are grouped by the attributes they are cached by, such that each group is loaded with batched fetches
+    NSMutableDictionary *attributesByAttributeNames = [NSMutableDictionary dictionary];
+    NSMutableDictionary *arrayOfAttributeValuesByAttributeNames = [NSMutableDictionary dictionary];
+    for (NSDictionary *attributeValues in arrayOfAttributeValues) {
+        if ([attributeValues count] == 0 || [self.entityCache isEntity:entity cachedWithAttributeValues:attributeValues]) continue;
+        NSSet *attributeNames = [NSSet setWithArray:[attributeValues allKeys]];
+        NSMutableArray *arrayOfAttributeValuesToLoad = arrayOfAttributeValuesByAttributeNames[attributeNames];
+        if (! arrayOfAttributeValuesToLoad) {
+            arrayOfAttributeValuesToLoad = [NSMutableArray array];
+            arrayOfAttributeValuesByAttributeNames[attributeNames] = arrayOfAttributeValuesToLoad;
+            attributesByAttributeNames[attributeNames] = [attributeValues allKeys];
+        }
+        [arrayOfAttributeValuesToLoad addObject:attributeValues];
+    }
+    if ([arrayOfAttributeValuesByAttributeNames count] == 0) return;
+
+    dispatch_group_t dispatchGroup = dispatch_group_create();
+    [arrayOfAttributeValuesByAttributeNames enumerateKeysAndObjectsUsingBlock:^(NSSet *attributeNames, NSArray *arrayOfAttributeValuesToLoad, BOOL *stop) {
+        NSArray *attributes = attributesByAttributeNames[attributeNames];
+        if (! [self.entityCache attributeCacheForEntity:entity attributes:attributes]) {
+            RKLogInfo(@"Caching instances of Entity '%@' by attributes '%@' on demand", entity.name, [attributes componentsJoinedByString:@", "]);
+        }
+        dispatch_group_enter(dispatchGroup);
+        [self.entityCache cacheObjectsForEntity:entity byAttributes:attributes withAttributeValues:arrayOfAttributeValuesToLoad completion:^{
+            dispatch_group_leave(dispatchGroup);
+        }];
+    }];
+    dispatch_group_wait(dispatchGroup, DISPATCH_TIME_FOREVER);
+#if !OS_OBJECT_USE_OBJC
+    dispatch_release(dispatchGroup);
+#endif
+}
+
+// Unsaved objects cannot be fetched when loading on demand. As their temporary object IDs cannot be resolved by other contexts, the insertions
+// of each looked-up context are cached apart from the shared entity cache: seeded upon the first lookup of the entity and attributes in the
+// context, then maintained by observing the context. The insertions of the observed context are cached by the entity cache as before.
+- (RKEntityByAttributeCache *)insertedObjectCacheForEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    if (managedObjectContext == self.observedManagedObjectContext) return nil;
+
+    BOOL isNewLookupContext = NO;
+    RKEntityByAttributeCache *insertedObjectCache = nil;
+    @synchronized(self.insertedObjectCachesByLookupContext) {
+        NSMutableArray *insertedObjectCaches = [self.insertedObjectCachesByLookupContext objectForKey:managedObjectContext];
+        if (! insertedObjectCaches) {
+            insertedObjectCaches = [NSMutableArray array];
+            [self.insertedObjectCachesByLookupContext setObject:insertedObjectCaches forKey:managedObjectContext];
+            isNewLookupContext = YES;
+        }
+        for (RKEntityByAttributeCache *cache in insertedObjectCaches) {
+            if ([cache.entity isEqual:entity] && [cache.attributes isEqualToArray:attributeNames]) return cache;
+        }
+
+        // The cache is never loaded, so it is created against the context of the entity cache rather than retaining the looked-up context
+        insertedObjectCache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:attributeNames managedObjectContext:self.entityCache.managedObjectContext];
+        insertedObjectCache.callbackQueue = RKInMemoryManagedObjectCacheCallbackQueue();
+        [insertedObjectCaches addObject:insertedObjectCache];
+    }
+
+    if (isNewLookupContext) {
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(handleLookupManagedObjectContextDidChangeNotification:) name:NSManagedObjectContextObjectsDidChangeNotification object:managedObjectContext];
+    }
+
+    __block NSSet *insertedObjects = nil;
+    [managedObjectContext performBlockAndWait:^{
+        insertedObjects = [[managedObjectContext insertedObjects] objectsPassingTest:^BOOL(NSManagedObject *managedObject, BOOL *stop) {
+            return [[managedObject entity] isKindOfEntity:entity];
+        }];
+    }];
+    if ([insertedObjects count]) {
+        dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+        [insertedObjectCache addObjects:insertedObjects completion:^{
+            dispatch_semaphore_signal(semaphore);
+        }];
+        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+#if !OS_OBJECT_USE_OBJC
+        dispatch_release(semaphore);
+#endif
+    }
+    return insertedObjectCache;
+}
+
 - (void)didFetchObject:(NSManagedObject *)object
 {
     [self.entityCache addObjects:[NSSet setWithObject:object] completion:nil];
@@ -161,4 +274,28 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     [self.entityCache removeObjects:deletedObjects completion:nil];
 }
 
+- (void)handleLookupManagedObjectContextDidChangeNotification:(NSNotification *)notification
+{
+    // Updates of unsaved objects are cached again, as their attribute values may have been assigned after the insertion was processed
+    NSDictionary *userInfo = notification.userInfo;
+    NSMutableSet *objectsToAdd = [NSMutableSet setWithSet:userInfo[NSInsertedObjectsKey]];
+    for (NSManagedObject *managedObject in userInfo[NSUpdatedObjectsKey]) {
+        if ([[managedObject objectID] isTemporaryID]) [objectsToAdd addObject:managedObject];
+    }
+    NSSet *deletedObjects = userInfo[NSDeletedObjectsKey];
+    if ([objectsToAdd count] == 0 && [deletedObjects count] == 0) return;
+
+    NSArray *insertedObjectCaches = nil;
+    @synchronized(self.insertedObjectCachesByLookupContext) {
+        insertedObjectCaches = [[self.insertedObjectCachesByLookupContext objectForKey:notification.object] copy];
+    }
+    for (RKEntityByAttributeCache *insertedObjectCache in insertedObjectCaches) {
+        NSPredicate *predicate = [NSPredicate predicateWithBlock:^BOOL(NSManagedObject *managedObject, NSDictionary *bindings) {
+            return [[managedObject entity] isKindOfEntity:insertedObjectCache.entity];
+        }];
+        [insertedObjectCache addObjects:[objectsToAdd filteredSetUsingPredicate:predicate] completion:nil];
+        [insertedObjectCache removeObjects:[deletedObjects filteredSetUsingPredicate:predicate] completion:nil];
+    }
+}
+
 @end
@@ -42,12 +42,29 @@
                     attributeValues:(NSDictionary *)attributeValues
              inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext;
 
+@optional
+
+///------------------------------------------
+/// @name Loading Managed Objects in Advance
+///------------------------------------------
+
+/**
+ Invoked to inform the receiver that the managed objects for a given entity with each of the given dictionaries of attribute values are about to be retrieved in a given context.
+
+ Caches that would otherwise load the matching objects upon each retrieval can load them all at once, such that the subsequent invocations of `managedObjectsWithEntity:attributeValues:inManagedObjectContext:` are answered from memory.
+
+ @param entity The entity of the managed objects that are about to be retrieved.
+ @param arrayOfAttributeValues An array of dictionaries specifying the attribute criteria of each retrieval.
+ @param managedObjectContext The context the objects are about to be retrieved in.
+ */
+- (void)loadManagedObjectsWithEntity:(NSEntityDescription *)entity
+              arrayOfAttributeValues:(NSArray *)arrayOfAttributeValues
+              inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext;
+
 ///---------------------------------------------------
 /// @name Handling Managed Object Change Notifications
 ///---------------------------------------------------
 
-@optional
-
 /**
  Invoked to inform the receiver that an object was fetched and should be added to the cache.
 
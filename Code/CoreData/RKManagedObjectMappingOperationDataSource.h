@@ -66,14 +66,16 @@
 ///---------------------------------------------------
 
 /**
- The parent operation upon which instances of `RKRelationshipConnectionOperation` created by the data source are dependent upon.
+ The parent operation upon which the relationship connection operations created by the data source are dependent upon.
  
  When connecting relationships as part of a managed object mapping operation, it is possible that the mapping operation itself will create managed objects that should be used to satisfy the connections mappings of representations being mapped. To support such cases, is is desirable to defer the execution of connection operations until the execution of the aggregate mapping operation is complete. The `parentOperation` property provides support for deferring the execution of the enqueued relationship connection operations by establishing a dependency between the connection operations and a parent operation, such as an instance of `RKMapperOperation` such that they will not be executed by the `operationQueue` until the parent operation has finished executing.
+
+ When a parent operation is set, the connections of all of the managed objects mapped within the managed object context of the receiver during the parent operation are gathered into a single `RKRelationshipConnectionBatchOperation`, which resolves the foreign keys of each destination entity together rather than object by object. Without a parent operation, an `RKRelationshipConnectionOperation` is enqueued for each mapped object.
  */
 @property (nonatomic, weak) NSOperation *parentOperation;
 
 /**
- The operation queue in which instances of `RKRelationshipConnectionOperation` will be enqueued to connect the relationships of mapped objects.
+ The operation queue in which the relationship connection operations will be enqueued to connect the relationships of mapped objects.
  
  If `nil`, then current operation queue as returned from `[NSOperationQueue currentQueue]` will be used.
  
@@ -81,4 +83,22 @@
  */
 @property (nonatomic, strong) NSOperationQueue *operationQueue;
 
+///-------------------------------------------
+/// @name Prefetching Existing Managed Objects
+///-------------------------------------------
+
+/**
+ Finds the existing managed objects for all of the entity representations contained in an object representation in advance of mapping it.
+
+ The representation is scanned at each key path of the mappings dictionary in the manner of `RKMapperOperation`, descending into the nested representations of relationship mappings and resolving dynamic mappings along the way. The identification attribute values of every entity representation are gathered by entity and existing objects are then fetched with a single `IN` predicate per entity (split into batches for very large payloads) rather than one fetch request per representation. Subsequent invocations of `mappingOperation:targetObjectForRepresentation:withMapping:inRelationship:` for the scanned representations are answered from the prefetched objects without consulting the `managedObjectCache`; representations that were not encountered during the scan continue to be looked up in the cache, as do representations without a fetched object when the store matched identification values that are not equal to the requested ones. Managed objects created by the receiver are added to the prefetched objects so that repeated representations of a new object within the payload resolve to the same instance.
+
+ Representations whose entity mapping uses a dynamic nesting attribute or for which any identification attribute value is missing are not prefetched. If the receiver has no managed object cache then this method does nothing, as every mapped representation results in the insertion of a new object.
+
+ The fetches are performed on the queue of the receiver's managed object context.
+
+ @param representation The object representation that is to be mapped.
+ @param mappingsDictionary A dictionary of key paths to `RKMapping` objects, as given to `RKMapperOperation`.
+ */
+- (void)prefetchManagedObjectsForRepresentation:(id)representation withMappingsDictionary:(NSDictionary *)mappingsDictionary;
+
 @end
@@ -22,21 +22,25 @@
 #import "RKManagedObjectMappingOperationDataSource.h"
 #import "RKObjectMapping.h"
 #import "RKEntityMapping.h"
+#import "RKDynamicMapping.h"
 #import "RKLog.h"
 #import "RKManagedObjectStore.h"
 #import "RKMappingOperation.h"
 #import "RKObjectMappingMatcher.h"
 #import "RKManagedObjectCaching.h"
 #import "RKRelationshipConnectionOperation.h"
+#import "RKRelationshipConnectionBatchOperation.h"
 #import "RKMappingErrors.h"
 #import "RKValueTransformers.h"
 #import "RKRelationshipMapping.h"
 #import "RKObjectUtilities.h"
 #import "NSManagedObject+RKAdditions.h"
+#import "NSManagedObjectContext+RKAdditions.h"
 
 extern NSString * const RKObjectMappingNestingAttributeKeyName;
 
 static void *RKManagedObjectMappingOperationDataSourceAssociatedObjectKey = &RKManagedObjectMappingOperationDataSourceAssociatedObjectKey;
+static void *RKManagedObjectMappingOperationDataSourceConnectionOperationKey = &RKManagedObjectMappingOperationDataSourceConnectionOperationKey;
 
 NSArray *RKApplyNestingAttributeValueToMappings(NSString *attributeName, id value, NSArray *propertyMappings);
 
@@ -96,6 +100,38 @@ static NSDictionary *RKEntityIdentificationAttributesForEntityMappingWithReprese
     return entityIdentifierAttributes;
 }
 
+static NSString *RKPrefetchTableKeyForEntity(NSEntityDescription *entity, NSArray *attributeNames)
+{
+    return [NSString stringWithFormat:@"%@:%@", [entity name], [attributeNames componentsJoinedByString:@","]];
+}
+
+// Objects are keyed by the value of a single identification attribute or the array of values of a compound identifier
+static id RKPrefetchKeyForAttributeValues(NSArray *attributeNames, NSDictionary *attributeValues)
+{
+    if ([attributeNames count] == 1) {
+        id value = attributeValues[attributeNames[0]];
+        return (value == [NSNull null]) ? nil : value;
+    }
+
+    NSMutableArray *values = [NSMutableArray arrayWithCapacity:[attributeNames count]];
+    for (NSString *attributeName in attributeNames) {
+        id value = attributeValues[attributeName];
+        if (value == nil || value == [NSNull null]) return nil;
+        [values addObject:value];
+    }
+    return values;
+}
+
+// The identification attribute values of one entity gathered from a representation, keyed by prefetch key
+@interface RKManagedObjectPrefetch : NSObject
+@property (nonatomic, strong) NSEntityDescription *entity;
+@property (nonatomic, copy) NSArray *attributeNames;
+@property (nonatomic, strong) NSMutableDictionary *attributeValuesByKey;
+@end
+
+@implementation RKManagedObjectPrefetch
+@end
+
 static id RKMutableCollectionValueWithObjectForKeyPath(id object, NSString *keyPath)
 {
     id value = [object valueForKeyPath:keyPath];
@@ -190,6 +226,7 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
 @property (nonatomic, strong, readwrite) NSManagedObjectContext *managedObjectContext;
 @property (nonatomic, strong, readwrite) id<RKManagedObjectCaching> managedObjectCache;
 @property (nonatomic, strong) NSMutableArray *deletionPredicates;
+@property (nonatomic, strong) NSMutableDictionary *prefetchedObjectTables;
 @end
 
 @implementation RKManagedObjectMappingOperationDataSource
@@ -269,9 +306,10 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
     
     // If we have found the entity identification attributes, try to find an existing instance to update
     if ([entityIdentifierAttributes count]) {
-        NSSet *objects = [self.managedObjectCache managedObjectsWithEntity:entity
-                                                           attributeValues:entityIdentifierAttributes
-                                                    inManagedObjectContext:self.managedObjectContext];
+        NSSet *objects = [self prefetchedObjectsWithEntity:entity attributeValues:entityIdentifierAttributes];
+        if (! objects) objects = [self.managedObjectCache managedObjectsWithEntity:entity
+                                                                   attributeValues:entityIdentifierAttributes
+                                                            inManagedObjectContext:self.managedObjectContext];
         if (entityMapping.identificationPredicate) objects = [objects filteredSetUsingPredicate:entityMapping.identificationPredicate];
         if ([objects count] > 0) {
             managedObject = [objects anyObject];
@@ -291,11 +329,204 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
         if ([self.managedObjectCache respondsToSelector:@selector(didCreateObject:)]) {
             [self.managedObjectCache didCreateObject:managedObject];
         }
+        [self addPrefetchedObject:managedObject withEntity:entity attributeValues:entityIdentifierAttributes];
     }
 
     return managedObject;
 }
 
+#pragma mark - Prefetching
+
+- (void)prefetchManagedObjectsForRepresentation:(id)representation withMappingsDictionary:(NSDictionary *)mappingsDictionary
+{
+    NSParameterAssert(mappingsDictionary);
+    if (! self.managedObjectCache || ! representation) return;
+
+    NSMutableDictionary *prefetches = [NSMutableDictionary dictionary];
+    for (id keyPath in mappingsDictionary) {
+        id nestedRepresentation = ([keyPath isEqual:[NSNull null]] || [keyPath isEqualToString:@""]) ? representation : [representation valueForKeyPath:keyPath];
+        [self collectIdentificationAttributeValuesFromRepresentation:nestedRepresentation withMapping:mappingsDictionary[keyPath] intoPrefetches:prefetches visitedMappings:nil];
+    }
+    if ([prefetches count] == 0) return;
+
+    if (! self.prefetchedObjectTables) self.prefetchedObjectTables = [NSMutableDictionary dictionary];
+    [self.managedObjectContext performBlockAndWait:^{
+        [prefetches enumerateKeysAndObjectsUsingBlock:^(NSString *tableKey, RKManagedObjectPrefetch *prefetch, BOOL *stop) {
+            [self performPrefetch:prefetch withTableKey:tableKey];
+        }];
+    }];
+
+    // The values that were not resolved by the prefetch are looked up in the cache, which is given the opportunity to load them at once
+    if (! [self.managedObjectCache respondsToSelector:@selector(loadManagedObjectsWithEntity:arrayOfAttributeValues:inManagedObjectContext:)]) return;
+    [prefetches enumerateKeysAndObjectsUsingBlock:^(NSString *tableKey, RKManagedObjectPrefetch *prefetch, BOOL *stop) {
+        NSDictionary *objectsByKey = self.prefetchedObjectTables[tableKey];
+        NSMutableArray *arrayOfAttributeValues = [NSMutableArray array];
+        [prefetch.attributeValuesByKey enumerateKeysAndObjectsUsingBlock:^(id key, NSDictionary *attributeValues, BOOL *stopEnumerating) {
+            if (! objectsByKey[key]) [arrayOfAttributeValues addObject:attributeValues];
+        }];
+        if ([arrayOfAttributeValues count]) {
+            [self.managedObjectCache loadManagedObjectsWithEntity:prefetch.entity arrayOfAttributeValues:arrayOfAttributeValues inManagedObjectContext:self.managedObjectContext];
+        }
+    }];
+}
+
+// `visitedMappings` holds the mappings already applied to the representation, guarding against cycles of relationships without a source key path
+- (void)collectIdentificationAttributeValuesFromRepresentation:(id)representation withMapping:(RKMapping *)mapping intoPrefetches:(NSMutableDictionary *)prefetches visitedMappings:(NSSet *)visitedMappings
+{
+    if (representation == nil || representation == [NSNull null]) return;
+    if (RKObjectIsCollection(representation)) {
+        for (id nestedRepresentation in representation) {
+            [self collectIdentificationAttributeValuesFromRepresentation:nestedRepresentation withMapping:mapping intoPrefetches:prefetches visitedMappings:nil];
+        }
+        return;
+    }
+
+    RKObjectMapping *objectMapping = nil;
+    if ([mapping isKindOfClass:[RKDynamicMapping class]]) {
+        objectMapping = [(RKDynamicMapping *)mapping objectMappingForRepresentation:representation];
+    } else if ([mapping isKindOfClass:[RKObjectMapping class]]) {
+        objectMapping = (RKObjectMapping *)mapping;
+    }
+    if (! objectMapping) return;
+
+    if ([objectMapping isKindOfClass:[RKEntityMapping class]]) {
+        RKEntityMapping *entityMapping = (RKEntityMapping *)objectMapping;
+        // Representations mapped with a nesting attribute are split into a representation per key by the mapper
+        if ([entityMapping mappingForSourceKeyPath:RKObjectMappingNestingAttributeKeyName]) return;
+
+        if ([entityMapping.identificationAttributes count]) {
+            NSDictionary *representationDictionary = [representation isKindOfClass:[NSDictionary class]] ? representation : @{ [NSNull null]: representation };
+            NSDictionary *attributeValues = RKEntityIdentificationAttributesForEntityMappingWithRepresentation(entityMapping, representationDictionary);
+            NSArray *attributeNames = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
+            id key = RKPrefetchKeyForAttributeValues(attributeNames, attributeValues);
+            if (key) {
+                NSString *tableKey = RKPrefetchTableKeyForEntity(entityMapping.entity, attributeNames);
+                RKManagedObjectPrefetch *prefetch = prefetches[tableKey];
+                if (! prefetch) {
+                    prefetch = [RKManagedObjectPrefetch new];
+                    prefetch.entity = entityMapping.entity;
+                    prefetch.attributeNames = attributeNames;
+                    prefetch.attributeValuesByKey = [NSMutableDictionary dictionary];
+                    prefetches[tableKey] = prefetch;
+                }
+                prefetch.attributeValuesByKey[key] = attributeValues;
+            }
+        }
+    }
+
+    if (! [representation isKindOfClass:[NSDictionary class]]) return;
+    NSValue *mappingValue = [NSValue valueWithNonretainedObject:objectMapping];
+    NSSet *mappingsAppliedToRepresentation = visitedMappings ? [visitedMappings setByAddingObject:mappingValue] : [NSSet setWithObject:mappingValue];
+    for (RKRelationshipMapping *relationshipMapping in objectMapping.relationshipMappings) {
+        if (relationshipMapping.sourceKeyPath) {
+            id nestedRepresentation = [representation valueForKeyPath:relationshipMapping.sourceKeyPath];
+            [self collectIdentificationAttributeValuesFromRepresentation:nestedRepresentation withMapping:relationshipMapping.mapping intoPrefetches:prefetches visitedMappings:nil];
+        } else if (! [mappingsAppliedToRepresentation containsObject:[NSValue valueWithNonretainedObject:relationshipMapping.mapping]]) {
+            [self collectIdentificationAttributeValuesFromRepresentation:representation withMapping:relationshipMapping.mapping intoPrefetches:prefetches visitedMappings:mappingsAppliedToRepresentation];
+        }
+    }
+}
+
+// Pre-condition: invoked from the queue of the managed object context
+- (void)performPrefetch:(RKManagedObjectPrefetch *)prefetch withTableKey:(NSString *)tableKey
+{
+    NSMutableDictionary *objectsByKey = self.prefetchedObjectTables[tableKey];
+    if (! objectsByKey) {
+        objectsByKey = [NSMutableDictionary dictionary];
+        self.prefetchedObjectTables[tableKey] = objectsByKey;
+    }
+
+    NSMutableArray *keys = [NSMutableArray arrayWithCapacity:[prefetch.attributeValuesByKey count]];
+    for (id key in prefetch.attributeValuesByKey) {
+        if (! objectsByKey[key]) [keys addObject:key];
+    }
+
+    for (NSUInteger location = 0; location < [keys count]; location += RKFetchRequestInPredicateBatchSize) {
+        NSArray *batchKeys = [keys subarrayWithRange:NSMakeRange(location, MIN(RKFetchRequestInPredicateBatchSize, [keys count] - location))];
+        NSArray *batchAttributeValues = [prefetch.attributeValuesByKey objectsForKeys:batchKeys notFoundMarker:[NSNull null]];
+
+        // For compound identifiers the conjunction of `IN` predicates yields a superset of the requested objects
+        NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:[prefetch.attributeNames count]];
+        NSMutableDictionary *valuesByAttributeName = [NSMutableDictionary dictionaryWithCapacity:[prefetch.attributeNames count]];
+        for (NSString *attributeName in prefetch.attributeNames) {
+            NSSet *values = [NSSet setWithArray:[batchAttributeValues valueForKey:attributeName]];
+            valuesByAttributeName[attributeName] = values;
+            [subpredicates addObject:[NSPredicate predicateWithFormat:@"%K IN %@", attributeName, values]];
+        }
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:[prefetch.entity name]];
+        fetchRequest.predicate = ([subpredicates count] == 1) ? subpredicates[0] : [NSCompoundPredicate andPredicateWithSubpredicates:subpredicates];
+        fetchRequest.returnsObjectsAsFaults = NO;
+
+        NSError *error = nil;
+        NSArray *objects = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
+        if (! objects) {
+            // The keys of the batch are left out of the table so that they are looked up in the managed object cache
+            RKLogWarning(@"Failed to prefetch %ld '%@' objects: falling back to the managed object cache.", (long) [batchKeys count], [prefetch.entity name]);
+            RKLogCoreDataError(error);
+            continue;
+        }
+
+        BOOL fetchedValuesMatchRequestedValues = YES;
+        for (NSManagedObject *managedObject in objects) {
+            NSDictionary *attributeValues = [managedObject dictionaryWithValuesForKeys:prefetch.attributeNames];
+            for (NSString *attributeName in prefetch.attributeNames) {
+                if (! [valuesByAttributeName[attributeName] containsObject:attributeValues[attributeName]]) fetchedValuesMatchRequestedValues = NO;
+            }
+            id key = RKPrefetchKeyForAttributeValues(prefetch.attributeNames, attributeValues);
+            if (! key) continue;
+            NSMutableSet *keyedObjects = objectsByKey[key];
+            if (keyedObjects) {
+                [keyedObjects addObject:managedObject];
+            } else {
+                objectsByKey[key] = [NSMutableSet setWithObject:managedObject];
+            }
+        }
+
+        // Requested keys without a fetched object are known not to exist, unless the store matched a value that is not equal to
+        // the requested one (such as the string "12345" for the number 12345), in which case they are looked up in the managed object cache
+        if (fetchedValuesMatchRequestedValues) {
+            for (id key in batchKeys) {
+                if (! objectsByKey[key]) objectsByKey[key] = [NSMutableSet set];
+            }
+        }
+        RKLogDebug(@"Prefetched %ld '%@' objects for %ld identifiers", (long) [objects count], [prefetch.entity name], (long) [batchKeys count]);
+    }
+}
+
+// Returns `nil` if the representation with the given attribute values was not prefetched
+- (NSSet *)prefetchedObjectsWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues
+{
+    if (! self.prefetchedObjectTables) return nil;
+    NSArray *attributeNames = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
+    id key = RKPrefetchKeyForAttributeValues(attributeNames, attributeValues);
+    if (! key) return nil;
+
+    NSSet *objects = self.prefetchedObjectTables[RKPrefetchTableKeyForEntity(entity, attributeNames)][key];
+    if (! objects) return nil;
+
+    NSMutableSet *existingObjects = [NSMutableSet setWithCapacity:[objects count]];
+    for (NSManagedObject *managedObject in objects) {
+        if (! [managedObject isDeleted]) [existingObjects addObject:managedObject];
+    }
+    return existingObjects;
+}
+
+- (void)addPrefetchedObject:(NSManagedObject *)managedObject withEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues
+{
+    if (! self.prefetchedObjectTables || [attributeValues count] == 0) return;
+    NSArray *attributeNames = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
+    NSMutableDictionary *objectsByKey = self.prefetchedObjectTables[RKPrefetchTableKeyForEntity(entity, attributeNames)];
+    id key = RKPrefetchKeyForAttributeValues(attributeNames, attributeValues);
+    if (! objectsByKey || ! key) return;
+
+    NSMutableSet *objects = objectsByKey[key];
+    if (objects) {
+        [objects addObject:managedObject];
+    } else {
+        objectsByKey[key] = [NSMutableSet setWithObject:managedObject];
+    }
+}
+
 // Mapping operations should be executed against managed object contexts with the `NSPrivateQueueConcurrencyType` concurrency type
 - (BOOL)executingConnectionOperationsWouldDeadlock
 {
@@ -342,10 +573,9 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
         // Add a dependency on the parent operation. If we are being mapped as part of a relationship, then the assignment of the mapped object to a parent may well fulfill the validation requirements. This ensures that the relationship mapping has completed before we evaluate the object for deletion.
         if (self.parentOperation) [deletionOperation addDependency:self.parentOperation];
 
-        RKRelationshipConnectionOperation *connectionOperation = nil;
+        NSOperation *connectionOperation = nil;
         if ([connections count]) {
-            connectionOperation = [[RKRelationshipConnectionOperation alloc] initWithManagedObject:mappingOperation.destinationObject connections:connections managedObjectCache:self.managedObjectCache];
-            [connectionOperation setConnectionBlock:^(RKRelationshipConnectionOperation *operation, RKConnectionDescription *connection, id connectedValue) {
+            void (^connectionBlock)(RKConnectionDescription *connection, id connectedValue) = ^(RKConnectionDescription *connection, id connectedValue) {
                 if (connectedValue) {
                     if ([mappingOperation.delegate respondsToSelector:@selector(mappingOperation:didConnectRelationship:toValue:usingConnection:)]) {
                         [mappingOperation.delegate mappingOperation:mappingOperation didConnectRelationship:connection.relationship toValue:connectedValue usingConnection:connection];
@@ -355,12 +585,32 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
                         [mappingOperation.delegate mappingOperation:mappingOperation didFailToConnectRelationship:connection.relationship usingConnection:connection];
                     }
                 }
-            }];
-            
-            if (self.parentOperation) [connectionOperation addDependency:self.parentOperation];
+            };
+
+            if (self.parentOperation && weakContext == self.managedObjectContext) {
+                // The connections of every object mapped by the parent operation are established together by a single batch operation
+                RKRelationshipConnectionBatchOperation *batchOperation = objc_getAssociatedObject(self.parentOperation, RKManagedObjectMappingOperationDataSourceConnectionOperationKey);
+                if (! batchOperation) {
+                    batchOperation = [[RKRelationshipConnectionBatchOperation alloc] initWithManagedObjectContext:self.managedObjectContext managedObjectCache:self.managedObjectCache];
+                    objc_setAssociatedObject(self.parentOperation, RKManagedObjectMappingOperationDataSourceConnectionOperationKey, batchOperation, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+                    [batchOperation addDependency:self.parentOperation];
+                    [objc_getAssociatedObject(self.parentOperation, RKManagedObjectMappingOperationDataSourceAssociatedObjectKey) addDependency:batchOperation];
+                    [operationQueue addOperation:batchOperation];
+                    RKLogTrace(@"Enqueued %@ dependent upon parent operation %@ to operation queue %@", batchOperation, self.parentOperation, operationQueue);
+                }
+                [batchOperation addManagedObject:mappingOperation.destinationObject connections:connections connectionBlock:connectionBlock];
+                connectionOperation = batchOperation;
+            } else {
+                RKRelationshipConnectionOperation *objectConnectionOperation = [[RKRelationshipConnectionOperation alloc] initWithManagedObject:mappingOperation.destinationObject connections:connections managedObjectCache:self.managedObjectCache];
+                [objectConnectionOperation setConnectionBlock:^(RKRelationshipConnectionOperation *operation, RKConnectionDescription *connection, id connectedValue) {
+                    connectionBlock(connection, connectedValue);
+                }];
+                if (self.parentOperation) [objectConnectionOperation addDependency:self.parentOperation];
+                [operationQueue addOperation:objectConnectionOperation];
+                RKLogTrace(@"Enqueued %@ dependent upon parent operation %@ to operation queue %@", objectConnectionOperation, self.parentOperation, operationQueue);
+                connectionOperation = objectConnectionOperation;
+            }
             [deletionOperation addDependency:connectionOperation];
-            [operationQueue addOperation:connectionOperation];
-            RKLogTrace(@"Enqueued %@ dependent upon parent operation %@ to operation queue %@", connectionOperation, self.parentOperation, operationQueue);
         }
         
         // Enqueue our deletion operation for execution after all the connections
@@ -382,6 +632,8 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
 
                 // Ensure predicate deletion executes after any connections have been established
                 if (connectionOperation) [predicateDeletionOperation addDependency:connectionOperation];
+                NSOperation *batchOperation = objc_getAssociatedObject(self.parentOperation, RKManagedObjectMappingOperationDataSourceConnectionOperationKey);
+                if (batchOperation && batchOperation != connectionOperation) [predicateDeletionOperation addDependency:batchOperation];
 
                 [operationQueue addOperation:predicateDeletionOperation];
             }
@@ -0,0 +1,86 @@
+//
+//  RKRelationshipConnectionBatchOperation.h
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <CoreData/CoreData.h>
+
+@class RKConnectionDescription;
+@protocol RKManagedObjectCaching;
+
+/**
+ The `RKRelationshipConnectionBatchOperation` class is a subclass of `NSOperation` that connects the relationships of many managed objects at once. Where an `RKRelationshipConnectionOperation` connects the relationships of a single managed object and queries the managed object cache for each of its connections, a batch operation gathers the pending connections of all of the objects added to it, groups the foreign key connections by the destination entity and attributes they are connected by and resolves each group with a single pass.
+
+ When the managed object cache is an instance of `RKFetchRequestManagedObjectCache`, each group is resolved by fetching the destination objects with an `IN` predicate (split into batches for very large groups) rather than with a fetch request per connection. For any other managed object cache the cache is queried once for each distinct set of attribute values within the group, so that objects sharing a foreign key share a lookup. The destination objects are then filtered and assigned to the relationships exactly as they would be by `RKRelationshipConnectionOperation`.
+
+ All of the work of the operation, including the invocation of the connection blocks, takes place within a single `performBlockAndWait:` on the queue of the managed object context.
+
+ Managed objects must be added to the operation before it begins executing. Batch operations are typically made dependent upon a parent operation, such as an `RKMapperOperation`, during the execution of which the mapped objects are added.
+
+ @see `RKRelationshipConnectionOperation`
+ */
+@interface RKRelationshipConnectionBatchOperation : NSOperation
+
+///-------------------------------------------------------------
+/// @name Initializing a Relationship Connection Batch Operation
+///-------------------------------------------------------------
+
+/**
+ Initializes the receiver with a given managed object context and managed object cache.
+
+ @param managedObjectContext The managed object context in which the relationships of the added objects are to be connected. Cannot be `nil`.
+ @param managedObjectCache The managed object cache from which to attempt to fetch matching objects to satisfy the connections. Cannot be `nil`.
+ @return The receiver, initialized with the given managed object context and managed object cache.
+ */
+- (instancetype)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+                          managedObjectCache:(id<RKManagedObjectCaching>)managedObjectCache;
+
+///--------------------------------------------
+/// @name Accessing Details About the Operation
+///--------------------------------------------
+
+/**
+ The managed object context in which the receiver connects relationships.
+ */
+@property (nonatomic, weak, readonly) NSManagedObjectContext *managedObjectContext;
+
+/**
+ The managed object cache the receiver will use to fetch related objects satisfying the connections.
+ */
+@property (nonatomic, strong, readonly) id<RKManagedObjectCaching> managedObjectCache;
+
+/**
+ The number of managed objects that have been added to the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger managedObjectCount;
+
+///-------------------------------------
+/// @name Adding Objects to be Connected
+///-------------------------------------
+
+/**
+ Adds a managed object whose relationships are to be connected by the receiver.
+
+ @param managedObject The object to attempt to connect relationships to. Must belong to the managed object context of the receiver.
+ @param connections An array of `RKConnectionDescription` objects describing the relationships to connect.
+ @param connectionBlock An optional block to be executed for each connection that is evaluated for the object. The block is executed within the queue of the managed object context and accepts two arguments: the connection description and the value, if any, that was set for the relationship targetted by it.
+ */
+- (void)addManagedObject:(NSManagedObject *)managedObject
+             connections:(NSArray *)connections
+         connectionBlock:(void (^)(RKConnectionDescription *connection, id connectedValue))connectionBlock;
+
+@end
@@ -0,0 +1,359 @@
+//
+//  RKRelationshipConnectionBatchOperation.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKRelationshipConnectionBatchOperation.h"
+#import "RKConnectionDescription.h"
+#import "RKManagedObjectCaching.h"
+#import "RKFetchRequestManagedObjectCache.h"
+#import "RKObjectUtilities.h"
+#import "NSManagedObjectContext+RKAdditions.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitCoreData
+
+id RKRelationshipValueForConnectionResult(RKConnectionDescription *connection, id result);
+id RKConnectionResultWithManagedObjects(RKConnectionDescription *connection, NSSet *managedObjects);
+id RKAttributeValueCoercedToAttributeType(NSAttributeDescription *attribute, id value);
+
+// Source attributes are not required to share the type of the destination attribute, which the store resolves when comparing
+static id RKConnectionValueForDestinationAttribute(NSAttributeDescription *attribute, id value)
+{
+    if ([value isKindOfClass:[NSNumber class]] && [attribute attributeType] == NSStringAttributeType) return [value stringValue];
+    return RKAttributeValueCoercedToAttributeType(attribute, value);
+}
+
+// Returns the keys of the objects satisfying the attribute values within the table of a fetched group, or nil if they cannot be expressed as such
+static NSArray *RKConnectionTableKeysForAttributeValues(NSEntityDescription *entity, NSArray *attributeNames, NSDictionary *attributeValues)
+{
+    NSDictionary *attributesByName = [entity attributesByName];
+    if ([attributeNames count] == 1) {
+        NSAttributeDescription *attribute = attributesByName[attributeNames[0]];
+        id value = attributeValues[attributeNames[0]];
+        if (! attribute) return nil;
+        NSMutableArray *keys = [NSMutableArray array];
+        for (id element in (RKObjectIsCollection(value) ? value : @[ value ])) {
+            if (element != [NSNull null]) [keys addObject:RKConnectionValueForDestinationAttribute(attribute, element)];
+        }
+        return keys;
+    }
+
+    // Compound keys are only tabulated for scalar values, as a collection value for any attribute matches the cross product of values
+    NSMutableArray *values = [NSMutableArray arrayWithCapacity:[attributeNames count]];
+    for (NSString *attributeName in attributeNames) {
+        NSAttributeDescription *attribute = attributesByName[attributeName];
+        id value = attributeValues[attributeName];
+        if (! attribute || value == [NSNull null] || RKObjectIsCollection(value)) return nil;
+        [values addObject:RKConnectionValueForDestinationAttribute(attribute, value)];
+    }
+    return @[ values ];
+}
+
+static id RKConnectionTableKeyForManagedObject(NSManagedObject *managedObject, NSArray *attributeNames)
+{
+    if ([attributeNames count] == 1) return [managedObject valueForKey:attributeNames[0]];
+
+    NSMutableArray *values = [NSMutableArray arrayWithCapacity:[attributeNames count]];
+    for (NSString *attributeName in attributeNames) {
+        id value = [managedObject valueForKey:attributeName];
+        if (! value) return nil;
+        [values addObject:value];
+    }
+    return values;
+}
+
+// An object added to the operation along with the foreign key lookups of its connections
+@interface RKRelationshipConnectionBatchEntry : NSObject
+@property (nonatomic, strong) NSManagedObject *managedObject;
+@property (nonatomic, copy) NSArray *connections;
+@property (nonatomic, copy) void (^connectionBlock)(RKConnectionDescription *connection, id connectedValue);
+@property (nonatomic, strong) NSMutableArray *lookups;
+@end
+
+@implementation RKRelationshipConnectionBatchEntry
+@end
+
+// The destination attribute values of a foreign key connection of one object and the objects satisfying them
+@interface RKRelationshipConnectionBatchLookup : NSObject
+@property (nonatomic, copy) NSDictionary *attributeValues;
+@property (nonatomic, copy) NSArray *tableKeys;
+@property (nonatomic, strong) NSSet *managedObjects;
+@end
+
+@implementation RKRelationshipConnectionBatchLookup
+@end
+
+// The lookups of all connections sharing a destination entity and set of destination attributes
+@interface RKRelationshipConnectionBatchGroup : NSObject
+@property (nonatomic, strong) NSEntityDescription *entity;
+@property (nonatomic, copy) NSArray *attributeNames;
+@property (nonatomic, strong) NSMutableArray *lookups;
+@property (nonatomic, strong) NSMutableDictionary *objectsByTableKey;
+@end
+
+@implementation RKRelationshipConnectionBatchGroup
+@end
+
+@interface RKRelationshipConnectionBatchOperation ()
+@property (nonatomic, weak, readwrite) NSManagedObjectContext *managedObjectContext;
+@property (nonatomic, strong, readwrite) id<RKManagedObjectCaching> managedObjectCache;
+@property (nonatomic, strong) NSMutableArray *entries;
+@end
+
+@implementation RKRelationshipConnectionBatchOperation
+
+- (instancetype)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+                          managedObjectCache:(id<RKManagedObjectCaching>)managedObjectCache
+{
+    NSParameterAssert(managedObjectContext);
+    NSParameterAssert(managedObjectCache);
+    self = [self init];
+    if (self) {
+        self.managedObjectContext = managedObjectContext;
+        self.managedObjectCache = managedObjectCache;
+        self.entries = [NSMutableArray array];
+    }
+
+    return self;
+}
+
+- (NSUInteger)managedObjectCount
+{
+    return [self.entries count];
+}
+
+- (void)addManagedObject:(NSManagedObject *)managedObject
+             connections:(NSArray *)connections
+         connectionBlock:(void (^)(RKConnectionDescription *connection, id connectedValue))connectionBlock
+{
+    NSParameterAssert(managedObject);
+    NSAssert([managedObject isKindOfClass:[NSManagedObject class]], @"Relationship connection requires an instance of NSManagedObject");
+    NSParameterAssert(connections);
+    NSAssert(! [self isExecuting] && ! [self isFinished], @"Cannot add managed objects to a batch operation once it has begun executing");
+
+    RKRelationshipConnectionBatchEntry *entry = [RKRelationshipConnectionBatchEntry new];
+    entry.managedObject = managedObject;
+    entry.connections = connections;
+    entry.connectionBlock = connectionBlock;
+    [self.entries addObject:entry];
+}
+
+// Gathers the lookups of the foreign key connections of every entry into groups by destination entity and attributes
+- (NSArray *)groupsForLookups
+{
+    NSMutableDictionary *groupsByKey = [NSMutableDictionary dictionary];
+    NSMutableArray *groups = [NSMutableArray array];
+    for (RKRelationshipConnectionBatchEntry *entry in self.entries) {
+        entry.lookups = [NSMutableArray arrayWithCapacity:[entry.connections count]];
+        if ([entry.managedObject isDeleted]) continue;
+
+        for (RKConnectionDescription *connection in entry.connections) {
+            if (! [connection isForeignKeyConnection] || (connection.sourcePredicate && ![connection.sourcePredicate evaluateWithObject:entry.managedObject])) {
+                [entry.lookups addObject:[NSNull null]];
+                continue;
+            }
+
+            RKRelationshipConnectionBatchLookup *lookup = [RKRelationshipConnectionBatchLookup new];
+            [entry.lookups addObject:lookup];
+
+            BOOL isConnectable = NO;
+            NSMutableDictionary *attributeValues = [NSMutableDictionary dictionaryWithCapacity:[connection.attributes count]];
+            for (NSString *sourceAttribute in connection.attributes) {
+                id sourceValue = [entry.managedObject valueForKey:sourceAttribute];
+                if (sourceValue) isConnectable = YES;
+                attributeValues[connection.attributes[sourceAttribute]] = sourceValue ?: [NSNull null];
+            }
+            if (! isConnectable) continue;
+
+            lookup.attributeValues = attributeValues;
+
+            NSEntityDescription *entity = [connection.relationship destinationEntity];
+            NSArray *attributeNames = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
+            NSString *groupKey = [NSString stringWithFormat:@"%@:%@", [entity name], [attributeNames componentsJoinedByString:@","]];
+            RKRelationshipConnectionBatchGroup *group = groupsByKey[groupKey];
+            if (! group) {
+                group = [RKRelationshipConnectionBatchGroup new];
+                group.entity = entity;
+                group.attributeNames = attributeNames;
+                group.lookups = [NSMutableArray array];
+                group.objectsByTableKey = [NSMutableDictionary dictionary];
+                groupsByKey[groupKey] = group;
+                [groups addObject:group];
+            }
+            [group.lookups addObject:lookup];
+        }
+    }
+
+    return groups;
+}
+
+// Fetches the destination objects of every tabulated lookup of the group with `IN` predicates. Keys whose batch fails to fetch are left out of the table.
+- (void)fetchObjectsForGroup:(RKRelationshipConnectionBatchGroup *)group
+{
+    NSMutableOrderedSet *tableKeys = [NSMutableOrderedSet orderedSet];
+    for (RKRelationshipConnectionBatchLookup *lookup in group.lookups) {
+        lookup.tableKeys = RKConnectionTableKeysForAttributeValues(group.entity, group.attributeNames, lookup.attributeValues);
+        if (lookup.tableKeys) [tableKeys addObjectsFromArray:lookup.tableKeys];
+    }
+
+    NSArray *keys = [tableKeys array];
+    for (NSUInteger location = 0; location < [keys count]; location += RKFetchRequestInPredicateBatchSize) {
+        NSArray *batchKeys = [keys subarrayWithRange:NSMakeRange(location, MIN(RKFetchRequestInPredicateBatchSize, [keys count] - location))];
+
+        // For compound attributes the conjunction of `IN` predicates matches a superset of the requested objects
+        NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:[group.attributeNames count]];
+        [group.attributeNames enumerateObjectsUsingBlock:^(NSString *attributeName, NSUInteger idx, BOOL *stop) {
+            NSMutableSet *values = [NSMutableSet setWithCapacity:[batchKeys count]];
+            for (id key in batchKeys) {
+                [values addObject:([group.attributeNames count] == 1) ? key : key[idx]];
+            }
+            [subpredicates addObject:[NSPredicate predicateWithFormat:@"%K IN %@", attributeName, values]];
+        }];
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:[group.entity name]];
+        fetchRequest.predicate = ([subpredicates count] == 1) ? subpredicates[0] : [NSCompoundPredicate andPredicateWithSubpredicates:subpredicates];
+
+        NSError *error = nil;
+        NSArray *objects = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
+        if (! objects) {
+            RKLogWarning(@"Failed to fetch '%@' objects for %ld relationship connections: falling back to the managed object cache.", [group.entity name], (long) [batchKeys count]);
+            RKLogCoreDataError(error);
+            continue;
+        }
+
+        for (id key in batchKeys) {
+            group.objectsByTableKey[key] = [NSMutableSet set];
+        }
+        for (NSManagedObject *managedObject in objects) {
+            id key = RKConnectionTableKeyForManagedObject(managedObject, group.attributeNames);
+            if (key) [group.objectsByTableKey[key] addObject:managedObject];
+        }
+        RKLogDebug(@"Fetched %ld '%@' objects for %ld relationship connection keys", (long) [objects count], [group.entity name], (long) [batchKeys count]);
+    }
+}
+
+- (void)resolveLookupsForGroup:(RKRelationshipConnectionBatchGroup *)group
+{
+    if ([self.managedObjectCache isKindOfClass:[RKFetchRequestManagedObjectCache class]]) [self fetchObjectsForGroup:group];
+
+    // Lookups that could not be tabulated query the cache, once for each distinct set of attribute values
+    NSMutableArray *untabulatedLookups = [NSMutableArray array];
+    for (RKRelationshipConnectionBatchLookup *lookup in group.lookups) {
+        NSArray *tableObjects = lookup.tableKeys ? [group.objectsByTableKey objectsForKeys:lookup.tableKeys notFoundMarker:[NSNull null]] : nil;
+        if (tableObjects && ! [tableObjects containsObject:[NSNull null]]) {
+            NSMutableSet *managedObjects = [NSMutableSet set];
+            for (NSSet *objects in tableObjects) {
+                [managedObjects unionSet:objects];
+            }
+            lookup.managedObjects = managedObjects;
+        } else {
+            [untabulatedLookups addObject:lookup];
+        }
+    }
+    if ([untabulatedLookups count] && [self.managedObjectCache respondsToSelector:@selector(loadManagedObjectsWithEntity:arrayOfAttributeValues:inManagedObjectContext:)]) {
+        NSArray *arrayOfAttributeValues = [[NSSet setWithArray:[untabulatedLookups valueForKey:@"attributeValues"]] allObjects];
+        [self.managedObjectCache loadManagedObjectsWithEntity:group.entity arrayOfAttributeValues:arrayOfAttributeValues inManagedObjectContext:self.managedObjectContext];
+    }
+
+    NSMutableDictionary *cachedObjectsByAttributeValues = [NSMutableDictionary dictionary];
+    for (RKRelationshipConnectionBatchLookup *lookup in untabulatedLookups) {
+        NSSet *managedObjects = cachedObjectsByAttributeValues[lookup.attributeValues];
+        if (! managedObjects) {
+            managedObjects = [self.managedObjectCache managedObjectsWithEntity:group.entity
+                                                               attributeValues:lookup.attributeValues
+                                                        inManagedObjectContext:self.managedObjectContext] ?: [NSSet set];
+            cachedObjectsByAttributeValues[lookup.attributeValues] = managedObjects;
+        }
+        lookup.managedObjects = managedObjects;
+    }
+}
+
+- (void)connectRelationshipsOfEntry:(RKRelationshipConnectionBatchEntry *)entry
+{
+    [entry.connections enumerateObjectsUsingBlock:^(RKConnectionDescription *connection, NSUInteger idx, BOOL *stop) {
+        if (self.isCancelled || [entry.managedObject isDeleted]) {
+            *stop = YES;
+            return;
+        }
+        NSString *relationshipName = connection.relationship.name;
+        RKLogTrace(@"Connecting relationship '%@' with mapping: %@", relationshipName, connection);
+
+        id connectionResult = nil;
+        id lookup = entry.lookups[idx];
+        if ([lookup isKindOfClass:[RKRelationshipConnectionBatchLookup class]]) {
+            // If there are no attribute values available for connecting, skip the connection entirely
+            if (! [lookup attributeValues]) return;
+            connectionResult = RKConnectionResultWithManagedObjects(connection, [lookup managedObjects]);
+        } else if (connection.sourcePredicate && ![connection.sourcePredicate evaluateWithObject:entry.managedObject]) {
+            // The relationship is cleared for objects that do not satisfy the source predicate
+        } else if ([connection isKeyPathConnection]) {
+            connectionResult = [entry.managedObject valueForKeyPath:connection.keyPath];
+        } else if (! [connection isForeignKeyConnection]) {
+            @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                           reason:[NSString stringWithFormat:@"%@ Attempted to establish a relationship using a mapping that"
+                                                   " specifies neither a foreign key or a key path connection: %@",
+                                                   NSStringFromClass([self class]), connection]
+                                         userInfo:nil];
+        }
+
+        id connectedValue = RKRelationshipValueForConnectionResult(connection, connectionResult);
+        @try {
+            [entry.managedObject setValue:connectedValue forKeyPath:relationshipName];
+            RKLogDebug(@"Connected relationship '%@' to object '%@'", relationshipName, connectedValue);
+            if (entry.connectionBlock) entry.connectionBlock(connection, connectedValue);
+        }
+        @catch (NSException *exception) {
+            if ([[exception name] isEqualToString:NSObjectInaccessibleException]) {
+                // Object has been deleted
+                RKLogDebug(@"Rescued an `NSObjectInaccessibleException` exception while attempting to establish a relationship.");
+            } else {
+                [exception raise];
+            }
+        }
+    }];
+}
+
+- (void)main
+{
+    NSManagedObjectContext *managedObjectContext = self.managedObjectContext;
+    if (self.isCancelled || ! managedObjectContext) return;
+
+    [managedObjectContext performBlockAndWait:^{
+        NSArray *groups = [self groupsForLookups];
+        for (RKRelationshipConnectionBatchGroup *group in groups) {
+            if (self.isCancelled) return;
+            [self resolveLookupsForGroup:group];
+        }
+        RKLogDebug(@"Resolved relationship connections of %ld objects with %ld destination groups", (long) [self.entries count], (long) [groups count]);
+
+        for (RKRelationshipConnectionBatchEntry *entry in self.entries) {
+            [self connectRelationshipsOfEntry:entry];
+        }
+    }];
+
+    self.entries = nil;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@:%p %ld objects in %@ using %@>",
+            [self class], self, (long) [self.entries count], self.managedObjectContext, self.managedObjectCache];
+}
+
+@end
@@ -39,6 +39,67 @@ id RKMutableSetValueForRelationship(NSRelationshipDescription *relationship)
     return [relationship isOrdered] ? [NSMutableOrderedSet orderedSet] : [NSMutableSet set];
 }
 
+id RKRelationshipValueForConnectionResult(RKConnectionDescription *connection, id result);
+id RKRelationshipValueForConnectionResult(RKConnectionDescription *connection, id result)
+{
+    // TODO: Replace with use of object mapping engine for type conversion
+
+    // NOTE: This is a nasty hack to work around the fact that NSOrderedSet does not support key-value
+    // collection operators. We try to detect and unpack a doubly wrapped collection
+    if ([connection.relationship isToMany] && RKObjectIsCollectionOfCollections(result)) {
+        id mutableSet = RKMutableSetValueForRelationship(connection.relationship);
+        for (id<NSFastEnumeration> enumerable in result) {
+            for (id object in enumerable) {
+                [mutableSet addObject:object];
+            }
+        }
+
+        return mutableSet;
+    }
+
+    if ([connection.relationship isToMany]) {
+        if ([result isKindOfClass:[NSArray class]]) {
+            if ([connection.relationship isOrdered]) {
+                return [NSOrderedSet orderedSetWithArray:result];
+            } else {
+                return [NSSet setWithArray:result];
+            }
+        } else if ([result isKindOfClass:[NSSet class]]) {
+            if ([connection.relationship isOrdered]) {
+                return [NSOrderedSet orderedSetWithSet:result];
+            } else {
+                return result;
+            }
+        } else if ([result isKindOfClass:[NSOrderedSet class]]) {
+            if ([connection.relationship isOrdered]) {
+                return result;
+            } else {
+                return [(NSOrderedSet *)result set];
+            }
+        } else {
+            if ([connection.relationship isOrdered]) {
+                return [NSOrderedSet orderedSetWithObject:result];
+            } else {
+                return [NSSet setWithObject:result];
+            }
+        }
+    }
+
+    return result;
+}
+
+// Applies the destination criteria of a foreign key connection to the objects matching its attribute values
+id RKConnectionResultWithManagedObjects(RKConnectionDescription *connection, NSSet *managedObjects);
+id RKConnectionResultWithManagedObjects(RKConnectionDescription *connection, NSSet *managedObjects)
+{
+    if (connection.destinationPredicate) managedObjects = [managedObjects filteredSetUsingPredicate:connection.destinationPredicate];
+    if (!connection.includesSubentities) managedObjects = [managedObjects filteredSetUsingPredicate:[NSPredicate predicateWithFormat:@"entity == %@", [connection.relationship destinationEntity]]];
+    if ([connection.relationship isToMany]) return managedObjects;
+
+    if ([managedObjects count] > 1) RKLogWarning(@"Retrieved %ld objects satisfying connection criteria for one-to-one relationship connection: only one object will be connected.", (long) [managedObjects count]);
+    return [managedObjects anyObject];
+}
+
 static BOOL RKConnectionAttributeValuesIsNotConnectable(NSDictionary *attributeValues)
 {
     return [[NSSet setWithArray:[attributeValues allValues]] isEqualToSet:[NSSet setWithObject:[NSNull null]]];
@@ -96,54 +157,6 @@ static NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescripti
     return self.managedObject.managedObjectContext;
 }
 
-- (id)relationshipValueForConnection:(RKConnectionDescription *)connection withConnectionResult:(id)result
-{
-    // TODO: Replace with use of object mapping engine for type conversion
-
-    // NOTE: This is a nasty hack to work around the fact that NSOrderedSet does not support key-value
-    // collection operators. We try to detect and unpack a doubly wrapped collection
-    if ([connection.relationship isToMany] && RKObjectIsCollectionOfCollections(result)) {
-        id mutableSet = RKMutableSetValueForRelationship(connection.relationship);
-        for (id<NSFastEnumeration> enumerable in result) {
-            for (id object in enumerable) {
-                [mutableSet addObject:object];
-            }
-        }
-
-        return mutableSet;
-    }
-
-    if ([connection.relationship isToMany]) {
-        if ([result isKindOfClass:[NSArray class]]) {
-            if ([connection.relationship isOrdered]) {
-                return [NSOrderedSet orderedSetWithArray:result];
-            } else {
-                return [NSSet setWithArray:result];
-            }
-        } else if ([result isKindOfClass:[NSSet class]]) {
-            if ([connection.relationship isOrdered]) {
-                return [NSOrderedSet orderedSetWithSet:result];
-            } else {
-                return result;
-            }
-        } else if ([result isKindOfClass:[NSOrderedSet class]]) {
-            if ([connection.relationship isOrdered]) {
-                return result;
-            } else {
-                return [(NSOrderedSet *)result set];
-            }
-        } else {
-            if ([connection.relationship isOrdered]) {
-                return [NSOrderedSet orderedSetWithObject:result];
-            } else {
-                return [NSSet setWithObject:result];
-            }
-        }
-    }
-
-    return result;
-}
-
 - (id)findConnectedValueForConnection:(RKConnectionDescription *)connection shouldConnect:(BOOL *)shouldConnectRelationship
 {
     *shouldConnectRelationship = YES;
@@ -160,14 +173,7 @@ static NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescripti
         NSSet *managedObjects = [self.managedObjectCache managedObjectsWithEntity:[connection.relationship destinationEntity]
                                                                   attributeValues:attributeValues
                                                            inManagedObjectContext:self.managedObjectContext];
-        if (connection.destinationPredicate) managedObjects = [managedObjects filteredSetUsingPredicate:connection.destinationPredicate];
-        if (!connection.includesSubentities) managedObjects = [managedObjects filteredSetUsingPredicate:[NSPredicate predicateWithFormat:@"entity == %@", [connection.relationship destinationEntity]]];
-        if ([connection.relationship isToMany]) {
-            connectionResult = managedObjects;
-        } else {
-            if ([managedObjects count] > 1) RKLogWarning(@"Retrieved %ld objects satisfying connection criteria for one-to-one relationship connection: only one object will be connected.", (long) [managedObjects count]);
-            if ([managedObjects count]) connectionResult = [managedObjects anyObject];
-        }
+        connectionResult = RKConnectionResultWithManagedObjects(connection, managedObjects);
     } else if ([connection isKeyPathConnection]) {
         connectionResult = [self.managedObject valueForKeyPath:connection.keyPath];
     } else {
@@ -178,7 +184,7 @@ static NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescripti
                                      userInfo:nil];
     }
 
-    return [self relationshipValueForConnection:connection withConnectionResult:connectionResult];
+    return RKRelationshipValueForConnectionResult(connection, connectionResult);
 }
 
 - (void)main
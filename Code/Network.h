@@ -23,9 +23,11 @@
 #import "RKRouter.h"
 #import "RKRequestDescriptor.h"
 #import "RKResponseDescriptor.h"
+#import "RKResponseDescriptorIndex.h"
 #import "RKObjectManager.h"
 #import "RKHTTPUtilities.h"
 #import "RKObjectRequestOperation.h"
+#import "RKConditionalRequestCache.h"
 #import "RKObjectParameterization.h"
 #import "RKPathMatcher.h"
 
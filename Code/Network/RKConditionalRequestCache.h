@@ -0,0 +1,102 @@
+//
+//  RKConditionalRequestCache.h
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RKMappingResult;
+
+/**
+ The `RKConditionalRequestCache` class tracks the validators (the `ETag` and `Last-Modified` response headers) of resources that have been loaded and object mapped successfully, along with the mapping result that was produced for each of them. It enables object request operations to send conditional `GET` requests and to short-circuit the deserialization and mapping of the response when the server indicates that the resource has not been modified.
+
+ When an object request operation is configured with a conditional request cache, the following steps are taken:
+
+ 1. Before the request is sent, the cache is consulted for an entry matching the request URL, `Accept` header and response descriptors of the operation. If one is found, the `If-None-Match` and/or `If-Modified-Since` headers are added to the request.
+ 1. If the server responds with a 304 (Not Modified) status code, the mapping result stored in the entry is returned as the result of the operation. The empty response body is neither deserialized nor mapped.
+ 1. If the server responds with a 200 (OK) status code and a validator, the response is mapped as usual and the mapping result is stored in the cache together with the validators of the response.
+
+ `RKManagedObjectRequestOperation` stores the `NSManagedObjectID` of each mapped object rather than the object itself and resolves the identifiers in its `managedObjectContext` when a 304 response is received. Objects that have since been deleted from the context are omitted from the mapping result.
+
+ Entries are held in an `NSCache` and may be evicted under memory pressure, in which case the next request for the resource is sent unconditionally. Requests that already specify conditional headers and operations with a `targetObject` are never handled by the cache.
+
+ `RKConditionalRequestCache` is thread-safe.
+ */
+@interface RKConditionalRequestCache : NSObject
+
+///--------------------------------
+/// @name Configuring the Cache
+///--------------------------------
+
+/**
+ The maximum number of resources that the receiver should track. `0` means no limit.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger countLimit;
+
+///-----------------------------------------
+/// @name Performing Conditional Requests
+///-----------------------------------------
+
+/**
+ Returns a request with conditional headers for the validators of the cached entry matching the given request and response descriptors.
+
+ @param request The request to be sent.
+ @param responseDescriptors The response descriptors of the object request operation that will send the request.
+ @return A copy of the given request with the `If-None-Match` and/or `If-Modified-Since` headers set, or `nil` if the receiver does not contain a matching entry or the request cannot be sent conditionally.
+ */
+- (NSURLRequest *)conditionalRequestForRequest:(NSURLRequest *)request responseDescriptors:(NSArray *)responseDescriptors;
+
+/**
+ Returns the mapping result cached for the given request and response descriptors.
+
+ @param request The conditional request for which a 304 (Not Modified) response was loaded.
+ @param responseDescriptors The response descriptors of the object request operation that sent the request.
+ @return The cached mapping result, or `nil` if the receiver does not contain a matching entry or the validators of the request do not match those of the entry.
+ */
+- (RKMappingResult *)mappingResultForRequest:(NSURLRequest *)request responseDescriptors:(NSArray *)responseDescriptors;
+
+/**
+ Stores the mapping result produced for a response, keyed by the request that loaded it.
+
+ Nothing is stored unless the request method is `GET`, the response has a 200 (OK) status code and the response contains an `ETag` or `Last-Modified` header. Otherwise, any existing entry for the request is removed.
+
+ @param mappingResult The mapping result produced for the response.
+ @param request The request that loaded the response.
+ @param response The response that was mapped.
+ @param responseDescriptors The response descriptors that were used to map the response.
+ */
+- (void)storeMappingResult:(RKMappingResult *)mappingResult forRequest:(NSURLRequest *)request response:(NSHTTPURLResponse *)response responseDescriptors:(NSArray *)responseDescriptors;
+
+///----------------------------
+/// @name Removing Entries
+///----------------------------
+
+/**
+ Removes the entry for the given request, if any.
+
+ @param request The request whose entry is to be removed.
+ */
+- (void)removeMappingResultForRequest:(NSURLRequest *)request;
+
+/**
+ Removes all entries from the receiver.
+ */
+- (void)removeAllMappingResults;
+
+@end
@@ -0,0 +1,146 @@
+//
+//  RKConditionalRequestCache.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKConditionalRequestCache.h"
+#import "RKMappingResult.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitNetwork
+
+static NSString *RKConditionalRequestCacheKeyForRequest(NSURLRequest *request)
+{
+    // The `Accept` header selects the representation of the resource, and thus the mapping result
+    NSString *acceptHeader = [request valueForHTTPHeaderField:@"Accept"] ?: @"";
+    return [NSString stringWithFormat:@"%@ %@", acceptHeader, [[request URL] absoluteString]];
+}
+
+static BOOL RKResponseDescriptorArraysAreIdentical(NSArray *responseDescriptors, NSArray *otherResponseDescriptors)
+{
+    if ([responseDescriptors count] != [otherResponseDescriptors count]) return NO;
+    NSUInteger index = 0;
+    for (id responseDescriptor in responseDescriptors) {
+        if (responseDescriptor != otherResponseDescriptors[index++]) return NO;
+    }
+    return YES;
+}
+
+@interface RKConditionalRequestCacheEntry : NSObject
+@property (nonatomic, copy) NSString *entityTag;
+@property (nonatomic, copy) NSString *lastModified;
+@property (nonatomic, strong) RKMappingResult *mappingResult;
+@property (nonatomic, copy) NSArray *responseDescriptors;
+@end
+
+@implementation RKConditionalRequestCacheEntry
+@end
+
+@interface RKConditionalRequestCache ()
+@property (nonatomic, strong) NSCache *entries;
+@end
+
+@implementation RKConditionalRequestCache
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.entries = [NSCache new];
+        [self.entries setName:@"org.restkit.network.conditional-request-cache"];
+    }
+
+    return self;
+}
+
+- (NSUInteger)countLimit
+{
+    return [self.entries countLimit];
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit
+{
+    [self.entries setCountLimit:countLimit];
+}
+
+- (RKConditionalRequestCacheEntry *)entryForRequest:(NSURLRequest *)request responseDescriptors:(NSArray *)responseDescriptors
+{
+    if (! [[request HTTPMethod] isEqualToString:@"GET"] || ![request URL]) return nil;
+    RKConditionalRequestCacheEntry *entry = [self.entries objectForKey:RKConditionalRequestCacheKeyForRequest(request)];
+    if (! entry || !RKResponseDescriptorArraysAreIdentical(entry.responseDescriptors, responseDescriptors)) return nil;
+    return entry;
+}
+
+- (NSURLRequest *)conditionalRequestForRequest:(NSURLRequest *)request responseDescriptors:(NSArray *)responseDescriptors
+{
+    // Leave requests that the caller has made conditional alone
+    if ([request valueForHTTPHeaderField:@"If-None-Match"] || [request valueForHTTPHeaderField:@"If-Modified-Since"]) return nil;
+    RKConditionalRequestCacheEntry *entry = [self entryForRequest:request responseDescriptors:responseDescriptors];
+    if (! entry) return nil;
+
+    NSMutableURLRequest *conditionalRequest = [request mutableCopy];
+    if (entry.entityTag) [conditionalRequest setValue:entry.entityTag forHTTPHeaderField:@"If-None-Match"];
+    if (entry.lastModified) [conditionalRequest setValue:entry.lastModified forHTTPHeaderField:@"If-Modified-Since"];
+    return conditionalRequest;
+}
+
+- (RKMappingResult *)mappingResultForRequest:(NSURLRequest *)request responseDescriptors:(NSArray *)responseDescriptors
+{
+    RKConditionalRequestCacheEntry *entry = [self entryForRequest:request responseDescriptors:responseDescriptors];
+    if (! entry) return nil;
+    
+    // The request must have been validated against the cached representation rather than one known only to the caller
+    NSString *ifNoneMatch = [request valueForHTTPHeaderField:@"If-None-Match"];
+    NSString *ifModifiedSince = [request valueForHTTPHeaderField:@"If-Modified-Since"];
+    BOOL isValidatedByEntry = ((entry.entityTag && [ifNoneMatch isEqualToString:entry.entityTag]) ||
+                               (entry.lastModified && [ifModifiedSince isEqualToString:entry.lastModified]));
+    return isValidatedByEntry ? entry.mappingResult : nil;
+}
+
+- (void)storeMappingResult:(RKMappingResult *)mappingResult forRequest:(NSURLRequest *)request response:(NSHTTPURLResponse *)response responseDescriptors:(NSArray *)responseDescriptors
+{
+    if (! [[request HTTPMethod] isEqualToString:@"GET"] || ![request URL]) return;
+    NSDictionary *headers = [response allHeaderFields];
+    NSString *entityTag = headers[@"ETag"];
+    NSString *lastModified = headers[@"Last-Modified"];
+    if (! mappingResult || response.statusCode != 200 || (!entityTag && !lastModified)) {
+        [self removeMappingResultForRequest:request];
+        return;
+    }
+
+    RKConditionalRequestCacheEntry *entry = [RKConditionalRequestCacheEntry new];
+    entry.entityTag = entityTag;
+    entry.lastModified = lastModified;
+    entry.mappingResult = mappingResult;
+    entry.responseDescriptors = responseDescriptors;
+    [self.entries setObject:entry forKey:RKConditionalRequestCacheKeyForRequest(request)];
+    RKLogTrace(@"Stored mapping result for '%@' with validators ETag=%@, Last-Modified=%@", [request URL], entityTag, lastModified);
+}
+
+- (void)removeMappingResultForRequest:(NSURLRequest *)request
+{
+    [self.entries removeObjectForKey:RKConditionalRequestCacheKeyForRequest(request)];
+}
+
+- (void)removeAllMappingResults
+{
+    [self.entries removeAllObjects];
+}
+
+@end
@@ -134,13 +134,54 @@
  */
 - (NSURLSessionDataTask*)performRequest:(NSURLRequest *)request completionHandler:(void (^)(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error))completionHandler;
 
+@optional
+
+/**
+ Performs an HTTP request using the supplied request object, delivering the response body incrementally as it is received rather than buffering it in its entirety.
+ 
+ The response body is neither retained nor deserialized by the client. It is the responsibility of the caller to process each chunk as it is delivered.
+ 
+ @param request A NSURLRequest object that represents the request being made
+ @param dataHandler A callback block invoked serially, in order, for each chunk of the response body as it is received. Block parameters represent the chunk of data and the NSURLResponse
+ @param completionHandler A callback block on completion of the request. Block parameters represent the NSURLResponse and any associated error
+ */
+- (NSURLSessionDataTask*)performRequest:(NSURLRequest *)request dataHandler:(void (^)(NSData *data, NSURLResponse *response))dataHandler completionHandler:(void (^)(NSURLResponse *response, NSError *error))completionHandler;
+
 @end
 
 
 @interface RKHTTPClient : NSObject <RKHTTPClient>
 
+///-----------------------------------
+/// @name Accessing the Managed Session
+///-----------------------------------
+
+/**
+ The session configuration the client was initialized with. When initialized with a `nil` configuration, this is a copy of `[NSURLSessionConfiguration defaultSessionConfiguration]`.
+ 
+ The session copies its configuration at creation time, so changes made to this object after the client has been initialized have no effect. Per-host connection limits, timeouts and the cache policy should be configured before the configuration is handed to `initWithBaseURL:sessionConfiguration:`.
+ */
+@property (strong, nonatomic, readonly) NSURLSessionConfiguration *sessionConfiguration;
+
+/**
+ The session owned by the receiver. Every client creates its own session from its `sessionConfiguration` rather than using `[NSURLSession sharedSession]`, so each client has an independent connection pool.
+ */
 @property (strong, nonatomic, readonly) NSURLSession *session;
 
+/**
+ The serial operation queue on which the session delivers its delegate callbacks and completion handlers. Each client owns its own queue, so deserialization of responses for one client does not contend with the callbacks of another.
+ */
+@property (strong, nonatomic, readonly) NSOperationQueue *delegateQueue;
+
+/**
+ Invalidates the session managed by the receiver. Once invalidated, the client can no longer perform requests.
+ 
+ @param cancelPendingTasks Whether or not to cancel the tasks that are still in flight. If `NO`, outstanding tasks are allowed to finish before the session is torn down.
+ */
+- (void)invalidateSessionCancelingTasks:(BOOL)cancelPendingTasks;
+
 - (NSURLSessionDataTask*)performRequest:(NSURLRequest *)request completionHandler:(void (^)(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error))completionHandler;
 
+- (NSURLSessionDataTask*)performRequest:(NSURLRequest *)request dataHandler:(void (^)(NSData *data, NSURLResponse *response))dataHandler completionHandler:(void (^)(NSURLResponse *response, NSError *error))completionHandler;
+
 @end
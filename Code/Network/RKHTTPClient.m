@@ -13,10 +13,83 @@
 #import "RKHTTPPropertyListResponseSerializer.h"
 #import "RKMIMETypeSerialization.h"
 
+/**
+ Holds the callbacks of a single streaming data task
+ */
+@interface RKHTTPClientTaskHandlers : NSObject
+@property (nonatomic, copy) void (^dataHandler)(NSData *data, NSURLResponse *response);
+@property (nonatomic, copy) void (^completionHandler)(NSURLResponse *response, NSError *error);
+@end
+
+@implementation RKHTTPClientTaskHandlers
+@end
+
+/**
+ The session delegate routes the data callbacks of streaming tasks to their handlers. It is deliberately a separate object from the client, because a session retains its delegate until invalidated.
+ */
+@interface RKHTTPClientSessionDelegate : NSObject <NSURLSessionDataDelegate>
+@property (nonatomic, strong) NSMutableDictionary *taskHandlersByIdentifier;
+@property (nonatomic, strong) NSLock *lock;
+- (void)setTaskHandlers:(RKHTTPClientTaskHandlers *)taskHandlers forTask:(NSURLSessionTask *)task;
+@end
+
+@implementation RKHTTPClientSessionDelegate
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.taskHandlersByIdentifier = [NSMutableDictionary new];
+        self.lock = [NSLock new];
+    }
+    return self;
+}
+
+- (void)setTaskHandlers:(RKHTTPClientTaskHandlers *)taskHandlers forTask:(NSURLSessionTask *)task
+{
+    [self.lock lock];
+    if (taskHandlers) {
+        self.taskHandlersByIdentifier[@(task.taskIdentifier)] = taskHandlers;
+    } else {
+        [self.taskHandlersByIdentifier removeObjectForKey:@(task.taskIdentifier)];
+    }
+    [self.lock unlock];
+}
+
+- (RKHTTPClientTaskHandlers *)taskHandlersForTask:(NSURLSessionTask *)task
+{
+    [self.lock lock];
+    RKHTTPClientTaskHandlers *taskHandlers = self.taskHandlersByIdentifier[@(task.taskIdentifier)];
+    [self.lock unlock];
+    return taskHandlers;
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data
+{
+    RKHTTPClientTaskHandlers *taskHandlers = [self taskHandlersForTask:dataTask];
+    if (taskHandlers.dataHandler) {
+        taskHandlers.dataHandler(data, dataTask.response);
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error
+{
+    RKHTTPClientTaskHandlers *taskHandlers = [self taskHandlersForTask:task];
+    [self setTaskHandlers:nil forTask:task];
+    if (taskHandlers.completionHandler) {
+        taskHandlers.completionHandler(task.response, error);
+    }
+}
+
+@end
+
 @interface RKHTTPClient ()
 
 @property (readwrite, nonatomic, strong) NSURL *baseURL;
-@property (strong, nonatomic) NSURLSessionConfiguration *sessionConfiguration;
+@property (readwrite, nonatomic, strong) NSURLSessionConfiguration *sessionConfiguration;
+@property (readwrite, nonatomic, strong) NSURLSession *session;
+@property (readwrite, nonatomic, strong) NSOperationQueue *delegateQueue;
+@property (readwrite, nonatomic, strong) RKHTTPClientSessionDelegate *sessionDelegate;
 @property (readwrite, nonatomic, strong) NSMutableDictionary *defaultHeaders;
 
 @end
@@ -56,7 +129,15 @@ defaultHeaders = _defaultHeaders;
     }
     
     self.baseURL = url;
-    self.sessionConfiguration = configuration;
+    self.sessionConfiguration = configuration ? [configuration copy] : [NSURLSessionConfiguration defaultSessionConfiguration];
+    
+    //Each client owns its session, and with it its own connection pool and delegate queue
+    //The delegate queue must be serial so that the chunks of streamed responses are delivered in order
+    self.delegateQueue = [NSOperationQueue new];
+    self.delegateQueue.name = [NSString stringWithFormat:@"org.restkit.network.http-client.%p", self];
+    self.delegateQueue.maxConcurrentOperationCount = 1;
+    self.sessionDelegate = [RKHTTPClientSessionDelegate new];
+    self.session = [NSURLSession sessionWithConfiguration:self.sessionConfiguration delegate:self.sessionDelegate delegateQueue:self.delegateQueue];
     self.requestSerializer = [RKHTTPRequestSerializer serializer];
     self.defaultHeaders = [NSMutableDictionary new];
     
@@ -66,6 +147,21 @@ defaultHeaders = _defaultHeaders;
     return self;
 }
 
+- (void)dealloc{
+    
+    //Sessions retain their resources until invalidated, let any in-flight tasks finish
+    [_session finishTasksAndInvalidate];
+}
+
+- (void)invalidateSessionCancelingTasks:(BOOL)cancelPendingTasks{
+    
+    if(cancelPendingTasks){
+        [self.session invalidateAndCancel];
+    }else{
+        [self.session finishTasksAndInvalidate];
+    }
+}
+
 - (void)addDefaultHeader:(NSString *)header
                    value:(NSString *)value{
     
@@ -186,9 +282,7 @@ defaultHeaders = _defaultHeaders;
 
 - (NSURLSessionDataTask*)performRequest:(NSURLRequest *)request completionHandler:(void (^)(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error))completionHandler{
     
-    NSURLSession *session = [NSURLSession sharedSession];
-    
-    NSURLSessionDataTask *task = [session dataTaskWithRequest:request completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
+    NSURLSessionDataTask *task = [self.session dataTaskWithRequest:request completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
         
         if(!completionHandler){
             return;
@@ -214,4 +308,18 @@ defaultHeaders = _defaultHeaders;
     return task;
 }
 
+- (NSURLSessionDataTask*)performRequest:(NSURLRequest *)request dataHandler:(void (^)(NSData *data, NSURLResponse *response))dataHandler completionHandler:(void (^)(NSURLResponse *response, NSError *error))completionHandler{
+    
+    RKHTTPClientTaskHandlers *taskHandlers = [RKHTTPClientTaskHandlers new];
+    taskHandlers.dataHandler = dataHandler;
+    taskHandlers.completionHandler = completionHandler;
+    
+    //Tasks created without a completion handler report their progress to the session delegate
+    NSURLSessionDataTask *task = [self.session dataTaskWithRequest:request];
+    [self.sessionDelegate setTaskHandlers:taskHandlers forTask:task];
+    [task resume];
+    
+    return task;
+}
+
 @end
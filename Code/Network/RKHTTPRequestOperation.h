@@ -131,6 +131,18 @@
                               failure:(void (^)(RKHTTPRequestOperation *operation, NSError *error))failure;
 
 
+///-------------------------------------------
+/// @name Receiving the Response Incrementally
+///-------------------------------------------
+
+/**
+ Sets a block to be executed for each chunk of the response body as it is received.
+ 
+ When a data block has been set and the `HTTPClient` implements `performRequest:dataHandler:completionHandler:`, the operation streams the response body to the block instead of buffering it. In this mode only the first 64 KB of the response body are retained in the `responseData` and `responseString` properties for logging and error reporting, and the `responseObject` property remains `nil`. The block must be set before the operation is started.
+ 
+ @param block A block object to be executed serially, in order, on a background queue for each chunk of the response body. The block has no return value and takes two arguments: the receiver operation and the chunk of data that was received. The `response` property of the operation is set before the block is invoked.
+ */
+- (void)setDidReceiveDataBlock:(void (^)(RKHTTPRequestOperation *operation, NSData *data))block;
 
 ///--------------------
 /// @name Notifications
@@ -30,6 +30,9 @@ extern NSString * const RKErrorDomain;
 
 static NSString * const kRKNetworkingLockName = @"com.restkit.networking.operation.lock";
 
+// The number of leading bytes of a streamed response body that are retained for logging and error reporting
+static NSUInteger const RKStreamedResponseDataCapacity = 64 * 1024;
+
 NSString *const RKHTTPRequestOperationDidStartNotification = @"RKHTTPRequestOperationDidStartNotification";
 NSString *const RKHTTPRequestOperationDidFinishNotification = @"RKHTTPRequestOperationDidFinishNotification";
 
@@ -55,6 +58,8 @@ const NSMutableSet *acceptableContentTypes;
 @property (readwrite, nonatomic, strong) NSError *responseSerializationError;
 @property (readwrite, nonatomic, strong) NSRecursiveLock *lock;
 @property (readwrite, nonatomic, strong) NSURLSessionTask *requestTask;
+@property (readwrite, nonatomic, strong) NSMutableData *streamedResponseData;
+@property (readwrite, nonatomic, copy) void (^didReceiveDataBlock)(RKHTTPRequestOperation *operation, NSData *data);
 
 @end
 
@@ -142,15 +147,36 @@ const NSMutableSet *acceptableContentTypes;
             [[NSNotificationCenter defaultCenter] postNotificationName:RKHTTPRequestOperationDidStartNotification object:self];
         });
         
-        self.requestTask = [self.HTTPClient performRequest:self.request completionHandler:^(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error) {
+        if (self.didReceiveDataBlock && [self.HTTPClient respondsToSelector:@selector(performRequest:dataHandler:completionHandler:)]) {
+            
+            self.requestTask = [self.HTTPClient performRequest:self.request dataHandler:^(NSData *data, NSURLResponse *response) {
+                
+                self.response = (NSHTTPURLResponse*) response;
+                if (! self.streamedResponseData) self.streamedResponseData = [NSMutableData data];
+                NSUInteger length = MIN([data length], RKStreamedResponseDataCapacity - [self.streamedResponseData length]);
+                if (length) [self.streamedResponseData appendData:[data subdataWithRange:NSMakeRange(0, length)]];
+                self.didReceiveDataBlock(self, data);
+            } completionHandler:^(NSURLResponse *response, NSError *error) {
+                
+                self.responseData = [self.streamedResponseData copy];
+                self.responseString = self.responseData ? [[NSString alloc] initWithData:self.responseData encoding:NSUTF8StringEncoding] : nil;
+                self.streamedResponseData = nil;
+                self.response = (NSHTTPURLResponse*) response;
+                self.error = error;
+                [self finish];
+            }];
+        } else {
             
-            self.responseData = responseData;
-            self.responseString = [[NSString alloc] initWithData:responseData encoding:NSUTF8StringEncoding];
-            self.responseObject = responseObject;            
-            self.response = (NSHTTPURLResponse*) response;
-            self.error = error;
-            [self finish];
-        }];
+            self.requestTask = [self.HTTPClient performRequest:self.request completionHandler:^(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error) {
+                
+                self.responseData = responseData;
+                self.responseString = [[NSString alloc] initWithData:responseData encoding:NSUTF8StringEncoding];
+                self.responseObject = responseObject;
+                self.response = (NSHTTPURLResponse*) response;
+                self.error = error;
+                [self finish];
+            }];
+        }
     }
     [self.lock unlock];
 }
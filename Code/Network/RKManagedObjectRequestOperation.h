@@ -182,6 +182,49 @@
  */
 - (void)setWillSaveMappingContextBlock:(void (^)(NSManagedObjectContext *mappingContext))block;
 
+///------------------------------------
+/// @name Refetching the Mapping Result
+///------------------------------------
+
+/**
+ A dictionary of entity names to arrays of relationship key paths to be prefetched when the managed objects of the mapping result are refetched into the `managedObjectContext`.
+
+ Upon completion of the operation, the managed objects of the mapping result are refetched into the `managedObjectContext` the first time that the mapping result is accessed. The object IDs of all of the managed objects are gathered and refetched with a single fetch request per entity, to which the key paths given for the entity are applied with `relationshipKeyPathsForPrefetching`. Prefetching avoids firing a fault for each destination object when the relationships of the mapped objects are subsequently traversed.
+
+ **Default**: `nil`
+ */
+@property (nonatomic, copy) NSDictionary *relationshipKeyPathsForPrefetchingByEntityName;
+
+/**
+ A Boolean value that determines if the managed objects of the mapping result are refetched into the `managedObjectContext` as faults rather than by fetch request.
+
+ When `YES`, no fetch request is executed when the mapping result is first accessed: each managed object is replaced with the object returned by `objectWithID:`, the data of which is only loaded from the store when its properties are accessed. This avoids loading objects that are never accessed from large mapping results, but objects that have been deleted from the store in the meantime are not removed from the mapping result and will raise an exception when their faults are fired. The `relationshipKeyPathsForPrefetchingByEntityName` are not applied.
+
+ **Default**: `NO`
+ */
+@property (nonatomic, assign) BOOL refetchesMappedObjectsAsFaults;
+
+///------------------------------------------
+/// @name Inspecting Orphaned Object Deletion
+///------------------------------------------
+
+/**
+ The number of local objects matched by the fetch request blocks that were checked against the mapping result for orphaned object deletion.
+
+ Orphaned objects are identified by their object IDs: the fetch requests are executed with the `NSManagedObjectIDResultType` result type and the managed objects themselves are not fetched. The value is zero until orphaned object deletion has been performed.
+ */
+@property (nonatomic, readonly) NSUInteger numberOfScannedOrphanCandidates;
+
+/**
+ The number of orphaned objects that were deleted from the local store because they were missing from the mapping result.
+ */
+@property (nonatomic, readonly) NSUInteger numberOfDeletedOrphanedObjects;
+
+/**
+ The time taken to fetch, identify and delete the orphaned objects.
+ */
+@property (nonatomic, readonly) NSTimeInterval orphanedObjectDeletionTime;
+
 @end
 
 /**
@@ -136,46 +136,58 @@ static NSManagedObject *RKRefetchManagedObjectInContext(NSManagedObject *managed
     return refetchedObject;
 }
 
-static id RKRefetchedValueInManagedObjectContext(id value, NSManagedObjectContext *managedObjectContext)
+// Replaces each managed object within the value with the object returned by the block, dropping objects for which it returns nil
+static id RKRefetchedValueUsingBlock(id value, NSManagedObject *(^refetchBlock)(NSManagedObject *managedObject))
 {
     if (! value) {
         return value;
     } else if ([value isKindOfClass:[NSArray class]]) {
         NSMutableArray *newValue = [[NSMutableArray alloc] initWithCapacity:[value count]];
         for (__strong id object in value) {
-            if ([object isKindOfClass:[NSManagedObject class]]) object = RKRefetchManagedObjectInContext(object, managedObjectContext);
+            if ([object isKindOfClass:[NSManagedObject class]]) object = refetchBlock(object);
             if (object) [newValue addObject:object];
         }
         return newValue;
     } else if ([value isKindOfClass:[NSSet class]]) {
         NSMutableSet *newValue = [[NSMutableSet alloc] initWithCapacity:[value count]];
         for (__strong id object in value) {
-            if ([object isKindOfClass:[NSManagedObject class]]) object = RKRefetchManagedObjectInContext(object, managedObjectContext);
+            if ([object isKindOfClass:[NSManagedObject class]]) object = refetchBlock(object);
             if (object) [newValue addObject:object];
         }
         return newValue;
     } else if ([value isKindOfClass:[NSOrderedSet class]]) {
         NSMutableOrderedSet *newValue = [NSMutableOrderedSet orderedSet];
         [(NSOrderedSet *)value enumerateObjectsUsingBlock:^(id object, NSUInteger index, BOOL *stop) {
-            if ([object isKindOfClass:[NSManagedObject class]]) object = RKRefetchManagedObjectInContext(object, managedObjectContext);
+            if ([object isKindOfClass:[NSManagedObject class]]) object = refetchBlock(object);
             if (object) [newValue setObject:object atIndex:index];
         }];
         return newValue;
     } else if ([value isKindOfClass:[NSManagedObject class]]) {
-        return RKRefetchManagedObjectInContext(value, managedObjectContext);
+        return refetchBlock(value);
     }
     
     return value;
 }
 
+static void RKAddPermanentObjectIDsFromValueToSet(id value, NSMutableSet *objectIDs)
+{
+    for (id object in (RKObjectIsCollection(value) ? value : (value ? @[ value ] : @[]))) {
+        if ([object isKindOfClass:[NSManagedObject class]] && ![[object objectID] isTemporaryID]) [objectIDs addObject:[object objectID]];
+    }
+}
+
 /**
  This is an NSProxy object that stands in for the mapping result and provides support for refetching the results on demand. This enables us to defer the refetching until someone accesses the results directly. For managed object request operations that do not use the mapping result (such as those used in conjunction with a NSFetchedResultsController), the refetching will be skipped entirely.
+ 
+ The object IDs of all the managed objects within the mapping result are gathered and refetched with a single `self IN %@` fetch request per entity, rather than with an `existingObjectWithID:error:` call per object. Alternatively the objects can be refetched as faults that are only materialized when accessed.
  */
 @interface RKRefetchingMappingResult : NSProxy
 
 - (instancetype)initWithMappingResult:(RKMappingResult *)mappingResult
        managedObjectContext:(NSManagedObjectContext *)managedObjectContext
                 mappingInfo:(NSDictionary *)mappingInfo;
+@property (nonatomic, copy) NSDictionary *relationshipKeyPathsForPrefetchingByEntityName;
+@property (nonatomic, assign) BOOL refetchesObjectsAsFaults;
 @end
 
 @interface RKRefetchingMappingResult ()
@@ -236,6 +248,88 @@ static id RKRefetchedValueInManagedObjectContext(id value, NSManagedObjectContex
     return [self.mappingResult count];
 }
 
+// Invokes the block with each value of the dictionary that is to be refetched, replacing the value with the result of the block if `replacesValues` is YES
+- (void)enumerateRefetchableValuesInDictionary:(NSMutableDictionary *)dictionary replacingValues:(BOOL)replacesValues usingBlock:(id (^)(id value))block
+{
+    NSArray *entityMappingEvents = [RKEntityMappingEvent entityMappingEventsForMappingInfo:self.mappingInfo];
+    NSSet *rootKeys = [NSSet setWithArray:[entityMappingEvents valueForKey:@"rootKey"]];
+    for (id rootKey in rootKeys) {
+        NSArray *eventsForRootKey = [entityMappingEvents filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"rootKey = %@", rootKey]];
+        NSSet *keyPaths = [NSSet setWithArray:[eventsForRootKey valueForKey:@"keyPath"]];
+        // If keyPaths contains null, then the root object is a managed object and we only need to refetch it
+        NSSet *nonNestedKeyPaths = ([keyPaths containsObject:[NSNull null]]) ? [NSSet setWithObject:[NSNull null]] : RKSetByRemovingSubkeypathsFromSet(keyPaths);
+        
+        NSDictionary *mappingResultsAtRootKey = dictionary[rootKey];
+        for (NSString *keyPath in nonNestedKeyPaths) {
+            id value = nil;
+            if ([keyPath isEqual:[NSNull null]]) {
+                value = block(mappingResultsAtRootKey);
+                if (value && replacesValues) dictionary[rootKey] = value;
+            } else {
+                NSMutableArray *keyPathComponents = [[keyPath componentsSeparatedByString:@"."] mutableCopy];
+                NSString *destinationKey = [keyPathComponents lastObject];
+                [keyPathComponents removeLastObject];
+                id sourceObject = [keyPathComponents count] ? [mappingResultsAtRootKey valueForKeyPath:[keyPathComponents componentsJoinedByString:@"."]] : mappingResultsAtRootKey;
+                if (RKObjectIsCollection(sourceObject)) {
+                    // This is a to-many relationship, we want to refetch each item at the keyPath
+                    for (id nestedObject in sourceObject) {
+                        // NOTE: If this collection was mapped with a dynamic mapping then each instance may not respond to the key
+                        if ([nestedObject respondsToSelector:NSSelectorFromString(destinationKey)]) {
+                            NSManagedObject *managedObject = [nestedObject valueForKey:destinationKey];
+                            value = block(managedObject);
+                            if (replacesValues) [nestedObject setValue:value forKey:destinationKey];
+                        }
+                    }
+                } else {
+                    // This is a singular relationship. We want to refetch the object and set it directly.
+                    id valueToRefetch = [sourceObject valueForKey:destinationKey];
+                    value = block(valueToRefetch);
+                    if (replacesValues) [sourceObject setValue:value forKey:destinationKey];
+                }
+            }
+        }
+    }
+}
+
+// Precondition: Must be called from within the managed object context
+- (NSDictionary *)fetchObjectsWithIDs:(NSSet *)objectIDs
+{
+    NSMutableDictionary *objectIDsByEntityName = [NSMutableDictionary dictionary];
+    for (NSManagedObjectID *objectID in objectIDs) {
+        NSMutableArray *entityObjectIDs = objectIDsByEntityName[[[objectID entity] name]];
+        if (! entityObjectIDs) {
+            entityObjectIDs = [NSMutableArray array];
+            objectIDsByEntityName[[[objectID entity] name]] = entityObjectIDs;
+        }
+        [entityObjectIDs addObject:objectID];
+    }
+    
+    NSMutableDictionary *objectsByID = [NSMutableDictionary dictionaryWithCapacity:[objectIDs count]];
+    [objectIDsByEntityName enumerateKeysAndObjectsUsingBlock:^(NSString *entityName, NSArray *entityObjectIDs, BOOL *stop) {
+        for (NSUInteger location = 0; location < [entityObjectIDs count]; location += RKFetchRequestInPredicateBatchSize) {
+            NSArray *batchObjectIDs = [entityObjectIDs subarrayWithRange:NSMakeRange(location, MIN(RKFetchRequestInPredicateBatchSize, [entityObjectIDs count] - location))];
+            NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:entityName];
+            fetchRequest.predicate = [NSPredicate predicateWithFormat:@"self IN %@", batchObjectIDs];
+            fetchRequest.returnsObjectsAsFaults = NO;
+            fetchRequest.relationshipKeyPathsForPrefetching = self.relationshipKeyPathsForPrefetchingByEntityName[entityName];
+            
+            NSError *error = nil;
+            NSArray *objects = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
+            if (! objects) {
+                // Objects missing from the table are refetched individually
+                RKLogWarning(@"Failed to refetch %ld '%@' objects: %@", (long) [batchObjectIDs count], entityName, error);
+                continue;
+            }
+            for (NSManagedObject *managedObject in objects) {
+                objectsByID[[managedObject objectID]] = managedObject;
+            }
+        }
+    }];
+    RKLogDebug(@"Refetched %ld of %ld managed objects with %ld entities", (long) [objectsByID count], (long) [objectIDs count], (long) [objectIDsByEntityName count]);
+    
+    return objectsByID;
+}
+
 - (RKMappingResult *)refetchedMappingResult
 {
     NSAssert(!self.refetched, @"Mapping result should only be refetched once");
@@ -243,42 +337,28 @@ static id RKRefetchedValueInManagedObjectContext(id value, NSManagedObjectContex
     
     NSMutableDictionary *newDictionary = [self.mappingResult.dictionary mutableCopy];
     [self.managedObjectContext performBlockAndWait:^{
-        NSArray *entityMappingEvents = [RKEntityMappingEvent entityMappingEventsForMappingInfo:self.mappingInfo];
-        NSSet *rootKeys = [NSSet setWithArray:[entityMappingEvents valueForKey:@"rootKey"]];
-        for (id rootKey in rootKeys) {
-            NSArray *eventsForRootKey = [entityMappingEvents filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"rootKey = %@", rootKey]];
-            NSSet *keyPaths = [NSSet setWithArray:[eventsForRootKey valueForKey:@"keyPath"]];
-            // If keyPaths contains null, then the root object is a managed object and we only need to refetch it
-            NSSet *nonNestedKeyPaths = ([keyPaths containsObject:[NSNull null]]) ? [NSSet setWithObject:[NSNull null]] : RKSetByRemovingSubkeypathsFromSet(keyPaths);
-            
-            NSDictionary *mappingResultsAtRootKey = newDictionary[rootKey];
-            for (NSString *keyPath in nonNestedKeyPaths) {
-                id value = nil;
-                if ([keyPath isEqual:[NSNull null]]) {
-                    value = RKRefetchedValueInManagedObjectContext(mappingResultsAtRootKey, self.managedObjectContext);
-                    if (value) newDictionary[rootKey] = value;
-                } else {
-                    NSMutableArray *keyPathComponents = [[keyPath componentsSeparatedByString:@"."] mutableCopy];
-                    NSString *destinationKey = [keyPathComponents lastObject];
-                    [keyPathComponents removeLastObject];
-                    id sourceObject = [keyPathComponents count] ? [mappingResultsAtRootKey valueForKeyPath:[keyPathComponents componentsJoinedByString:@"."]] : mappingResultsAtRootKey;
-                    if (RKObjectIsCollection(sourceObject)) {
-                        // This is a to-many relationship, we want to refetch each item at the keyPath
-                        for (id nestedObject in sourceObject) {
-                            // NOTE: If this collection was mapped with a dynamic mapping then each instance may not respond to the key
-                            if ([nestedObject respondsToSelector:NSSelectorFromString(destinationKey)]) {
-                                NSManagedObject *managedObject = [nestedObject valueForKey:destinationKey];
-                                [nestedObject setValue:RKRefetchedValueInManagedObjectContext(managedObject, self.managedObjectContext) forKey:destinationKey];
-                            }
-                        }
-                    } else {
-                        // This is a singular relationship. We want to refetch the object and set it directly.
-                        id valueToRefetch = [sourceObject valueForKey:destinationKey];
-                        [sourceObject setValue:RKRefetchedValueInManagedObjectContext(valueToRefetch, self.managedObjectContext) forKey:destinationKey];
-                    }
-                }
-            }
+        NSManagedObjectContext *managedObjectContext = self.managedObjectContext;
+        NSManagedObject *(^refetchBlock)(NSManagedObject *managedObject) = nil;
+        if (self.refetchesObjectsAsFaults) {
+            refetchBlock = ^NSManagedObject *(NSManagedObject *managedObject) {
+                if ([[managedObject objectID] isTemporaryID]) return RKRefetchManagedObjectInContext(managedObject, managedObjectContext);
+                return [managedObjectContext objectWithID:[managedObject objectID]];
+            };
+        } else {
+            NSMutableSet *objectIDs = [NSMutableSet set];
+            [self enumerateRefetchableValuesInDictionary:newDictionary replacingValues:NO usingBlock:^id(id value) {
+                RKAddPermanentObjectIDsFromValueToSet(value, objectIDs);
+                return value;
+            }];
+            NSDictionary *objectsByID = [self fetchObjectsWithIDs:objectIDs];
+            refetchBlock = ^NSManagedObject *(NSManagedObject *managedObject) {
+                return objectsByID[[managedObject objectID]] ?: RKRefetchManagedObjectInContext(managedObject, managedObjectContext);
+            };
         }
+        
+        [self enumerateRefetchableValuesInDictionary:newDictionary replacingValues:YES usingBlock:^id(id value) {
+            return RKRefetchedValueUsingBlock(value, refetchBlock);
+        }];
     }];
     
     return [[RKMappingResult alloc] initWithDictionary:newDictionary];
@@ -413,12 +493,16 @@ static NSSet *RKManagedObjectsFromMappingResultWithMappingInfo(RKMappingResult *
     return managedObjectsInMappingResult;
 }
 
+// Orphaned objects are deleted in batches of object IDs, each within its own `performBlockAndWait:`
+static NSUInteger const RKOrphanedObjectDeletionBatchSize = 500;
+
 // Defined in RKObjectManager.h
 BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *responseDescriptors);
 
 @interface RKObjectRequestOperation ()
 @property (nonatomic, strong, readwrite) NSError *error;
 @property (nonatomic, strong, readwrite) RKMappingResult *mappingResult;
++ (void)enqueueResponseMapperOperation:(NSOperation *)responseMapperOperation serializedWithKey:(id)key;
 @end
 
 @interface RKManagedObjectRequestOperation ()
@@ -432,6 +516,10 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
 @property (nonatomic, readonly) BOOL canSkipMapping;
 @property (nonatomic, assign) BOOL hasMemoizedCanSkipMapping;
 @property (nonatomic, copy) void (^willSaveMappingContextBlock)(NSManagedObjectContext *mappingContext);
+@property (nonatomic, strong) RKMappingResult *persistedMappingResult;
+@property (nonatomic, assign, readwrite) NSUInteger numberOfScannedOrphanCandidates;
+@property (nonatomic, assign, readwrite) NSUInteger numberOfDeletedOrphanedObjects;
+@property (nonatomic, assign, readwrite) NSTimeInterval orphanedObjectDeletionTime;
 @end
 
 @implementation RKManagedObjectRequestOperation
@@ -458,10 +546,17 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
 - (void)dealloc
 {
     _mappingResult = nil;
+    _persistedMappingResult = nil;
     _responseMapperOperation = nil;
     _privateContext = nil;
 }
 
+- (BOOL)mapsResponseIncrementally
+{
+    // Managed object mapping is performed in a single pass against the complete response body
+    return NO;
+}
+
 - (void)setTargetObject:(id)targetObject
 {
     [super setTargetObject:targetObject];
@@ -591,7 +686,7 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
     self.responseMapperOperation = [[RKManagedObjectResponseMapperOperation alloc] initWithRequest:self.HTTPRequestOperation.request
                                                                                           response:self.HTTPRequestOperation.response
                                                                                               data:self.HTTPRequestOperation.responseData
-                                                                               responseDescriptors:self.responseDescriptors];
+                                                                           responseDescriptorIndex:self.responseDescriptorIndex];
     self.responseMapperOperation.mapperDelegate = self;
     self.responseMapperOperation.mappingMetadata = self.mappingMetadata;
     self.responseMapperOperation.targetObject = self.targetObject;
@@ -637,14 +732,19 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
         
         // Refetch all managed objects nested at key paths within the results dictionary before returning
         if (mappingResult) {
+            weakSelf.persistedMappingResult = mappingResult;
             RKRefetchingMappingResult *refetchingMappingResult = [[RKRefetchingMappingResult alloc] initWithMappingResult:mappingResult
                                                                                                      managedObjectContext:weakSelf.managedObjectContext
                                                                                                               mappingInfo:weakSelf.mappingInfo];
+            refetchingMappingResult.relationshipKeyPathsForPrefetchingByEntityName = weakSelf.relationshipKeyPathsForPrefetchingByEntityName;
+            refetchingMappingResult.refetchesObjectsAsFaults = weakSelf.refetchesMappedObjectsAsFaults;
             return completionBlock((RKMappingResult *)refetchingMappingResult, nil);
         }
         completionBlock(nil, responseMappingError);
     }];
-    [[RKObjectRequestOperation responseMappingQueue] addOperation:self.responseMapperOperation];
+    
+    // Managed mappings identify, connect and save objects in the target context and are serialized per context
+    [RKObjectRequestOperation enqueueResponseMapperOperation:self.responseMapperOperation serializedWithKey:self.managedObjectContext];
 }
 
 - (BOOL)deleteTargetObject:(NSError **)error
@@ -671,27 +771,29 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
     return _blockSuccess;
 }
 
-- (NSSet *)localObjectsFromFetchRequests:(NSArray *)fetchRequests matchingRequestURL:(NSError **)error
+// Only the object IDs are fetched, so that candidates for orphan deletion are not materialized
+- (NSSet *)localObjectIDsFromFetchRequests:(NSArray *)fetchRequests error:(NSError **)error
 {
-    NSMutableSet *localObjects = [NSMutableSet set];
+    NSMutableSet *localObjectIDs = [NSMutableSet set];
     __block NSError *_blockError;
-    __block NSArray *_blockObjects;
+    __block NSArray *_blockObjectIDs;
     
     for (NSFetchRequest *fetchRequest in fetchRequests) {
+        NSFetchRequest *objectIDFetchRequest = [fetchRequest copy];
+        objectIDFetchRequest.resultType = NSManagedObjectIDResultType;
         [self.privateContext performBlockAndWait:^{
-            _blockObjects = [self.privateContext executeFetchRequest:fetchRequest error:&_blockError];
+            _blockObjectIDs = [self.privateContext executeFetchRequest:objectIDFetchRequest error:&_blockError];
         }];
         
-        if (_blockObjects == nil) {
+        if (_blockObjectIDs == nil) {
             if (error) *error = _blockError;
             return nil;
         }
-        RKLogTrace(@"Fetched local objects matching URL with fetch request '%@': %@", fetchRequest, _blockObjects);
-        [localObjects addObjectsFromArray:_blockObjects];
-        
+        RKLogTrace(@"Fetched %ld local object IDs matching URL with fetch request '%@'", (long) [_blockObjectIDs count], fetchRequest);
+        [localObjectIDs addObjectsFromArray:_blockObjectIDs];
     }
     
-    return localObjects;
+    return localObjectIDs;
 }
 
 - (NSArray *)fetchRequestsMatchingResponseURL
@@ -733,26 +835,37 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
     if (! [fetchRequests count]) return YES;
     
     // Proceed with cleanup
+    CFAbsoluteTime startTime = CFAbsoluteTimeGetCurrent();
     NSSet *managedObjectsInMappingResult = RKManagedObjectsFromMappingResultWithMappingInfo(mappingResult, self.mappingInfo) ?: [NSSet set];
-    NSSet *localObjects = [self localObjectsFromFetchRequests:fetchRequests matchingRequestURL:error];
-    if (! localObjects) {
+    NSSet *localObjectIDs = [self localObjectIDsFromFetchRequests:fetchRequests error:error];
+    if (! localObjectIDs) {
         RKLogError(@"Failed when attempting to fetch local candidate objects for orphan cleanup: %@", error ? *error : nil);
         return NO;
     }
-    RKLogDebug(@"Checking mappings result of %ld objects for %ld potentially orphaned local objects...", (long) [managedObjectsInMappingResult count], (long) [localObjects count]);
+    RKLogDebug(@"Checking mappings result of %ld objects for %ld potentially orphaned local objects...", (long) [managedObjectsInMappingResult count], (long) [localObjectIDs count]);
     
-    NSMutableSet *orphanedObjects = [localObjects mutableCopy];
-    [orphanedObjects minusSet:managedObjectsInMappingResult];
-    RKLogDebug(@"Deleting %lu orphaned objects found in local database, but missing from mapping result", (unsigned long) [orphanedObjects count]);
+    NSMutableSet *orphanedObjectIDs = [localObjectIDs mutableCopy];
+    for (NSManagedObject *managedObject in managedObjectsInMappingResult) {
+        [orphanedObjectIDs removeObject:[managedObject objectID]];
+    }
+    RKLogDebug(@"Deleting %lu orphaned objects found in local database, but missing from mapping result", (unsigned long) [orphanedObjectIDs count]);
     
-    if ([orphanedObjects count]) {
+    // Deletion is performed in batches so that the context queue is not held for the entirety of a large cleanup
+    NSArray *orphanedObjectIDsArray = [orphanedObjectIDs allObjects];
+    for (NSUInteger location = 0; location < [orphanedObjectIDsArray count]; location += RKOrphanedObjectDeletionBatchSize) {
+        NSArray *batchObjectIDs = [orphanedObjectIDsArray subarrayWithRange:NSMakeRange(location, MIN(RKOrphanedObjectDeletionBatchSize, [orphanedObjectIDsArray count] - location))];
         [self.privateContext performBlockAndWait:^{
-            for (NSManagedObject *orphanedObject in orphanedObjects) {
-                [self.privateContext deleteObject:orphanedObject];
+            for (NSManagedObjectID *orphanedObjectID in batchObjectIDs) {
+                [self.privateContext deleteObject:[self.privateContext objectWithID:orphanedObjectID]];
             }
         }];
     }
 
+    self.numberOfScannedOrphanCandidates = [localObjectIDs count];
+    self.numberOfDeletedOrphanedObjects = [orphanedObjectIDs count];
+    self.orphanedObjectDeletionTime = CFAbsoluteTimeGetCurrent() - startTime;
+    RKLogInfo(@"Deleted %lu of %lu local objects as orphans in %.3f seconds", (unsigned long) self.numberOfDeletedOrphanedObjects, (unsigned long) self.numberOfScannedOrphanCandidates, self.orphanedObjectDeletionTime);
+
     return YES;
 }
 
@@ -858,6 +971,59 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
     return _blockSuccess;;
 }
 
+#pragma mark - Conditional Requests
+
+static id RKObjectIDsFromValue(id value)
+{
+    if ([value isKindOfClass:[NSManagedObject class]]) return [value objectID];
+    if ([value isKindOfClass:[NSArray class]]) {
+        NSMutableArray *objectIDs = [NSMutableArray arrayWithCapacity:[value count]];
+        for (id object in value) [objectIDs addObject:RKObjectIDsFromValue(object)];
+        return objectIDs;
+    }
+    return value;
+}
+
+static id RKObjectsFromObjectIDsInContext(id value, NSManagedObjectContext *managedObjectContext)
+{
+    if ([value isKindOfClass:[NSManagedObjectID class]]) return [managedObjectContext existingObjectWithID:value error:nil];
+    if ([value isKindOfClass:[NSArray class]]) {
+        NSMutableArray *objects = [NSMutableArray arrayWithCapacity:[value count]];
+        for (id objectID in value) {
+            id object = RKObjectsFromObjectIDsInContext(objectID, managedObjectContext);
+            if (object) [objects addObject:object];
+        }
+        return objects;
+    }
+    return value;
+}
+
+- (RKMappingResult *)mappingResultForConditionalRequestCache:(RKMappingResult *)mappingResult
+{
+    // Managed objects are bound to their context, so identifiers are cached in their place. The persisted result is used to avoid triggering a refetch.
+    RKMappingResult *persistedMappingResult = self.persistedMappingResult ?: mappingResult;
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[persistedMappingResult.dictionary count]];
+    [persistedMappingResult.dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        dictionary[key] = RKObjectIDsFromValue(value);
+    }];
+    return [[RKMappingResult alloc] initWithDictionary:dictionary];
+}
+
+- (RKMappingResult *)mappingResultFromConditionalRequestCache:(RKMappingResult *)cachedMappingResult
+{
+    // Objects that have been deleted locally since the resource was mapped are omitted
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[cachedMappingResult.dictionary count]];
+    [self.managedObjectContext performBlockAndWait:^{
+        [cachedMappingResult.dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+            id objects = RKObjectsFromObjectIDsInContext(value, self.managedObjectContext);
+            if (objects) dictionary[key] = objects;
+        }];
+    }];
+    return [[RKMappingResult alloc] initWithDictionary:dictionary];
+}
+
+#pragma mark -
+
 - (void)mapperDidFinishMapping:(RKMapperOperation *)mapper
 {
     self.mappingInfo = mapper.mappingInfo;
@@ -895,6 +1061,8 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
     operation.fetchRequestBlocks = self.fetchRequestBlocks;
     operation.deletesOrphanedObjects = self.deletesOrphanedObjects;
     operation.savesToPersistentStore = self.savesToPersistentStore;
+    operation.relationshipKeyPathsForPrefetchingByEntityName = self.relationshipKeyPathsForPrefetchingByEntityName;
+    operation.refetchesMappedObjectsAsFaults = self.refetchesMappedObjectsAsFaults;
     
     return operation;
 }
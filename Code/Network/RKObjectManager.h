@@ -540,6 +540,36 @@ RKMappingResult, RKRequestDescriptor, RKResponseDescriptor;
  */
 - (void)cancelAllObjectRequestOperationsWithMethod:(RKRequestMethod)method matchingPathPattern:(NSString *)pathPattern;
 
+///------------------------------------------
+/// @name Coalescing Identical Object Requests
+///------------------------------------------
+
+/**
+ A Boolean value that determines if identical `GET` requests made while an equivalent request is already in flight are coalesced into a single object request operation.
+ 
+ When `YES`, the `getObjectsAtPath:parameters:success:failure:`, `getObjectsAtPathForRouteNamed:object:parameters:success:failure:` and `getObjectsAtPathForRelationship:ofObject:parameters:success:failure:` methods first look for an in-flight object request operation enqueued by one of these methods for a request with the same URL, HTTP headers, response descriptors, mapping metadata and (for managed object request operations) managed object context. If one is found, no new operation is created. Instead, the success and failure blocks are attached to the in-flight operation and invoked with its operation object and mapping result once it finishes, after the blocks of the original caller. Otherwise, a new object request operation is enqueued and becomes the in-flight operation for subsequent identical requests until it finishes.
+ 
+ Coalescing saves the bandwidth, deserialization and object mapping work of duplicate requests issued in bursts, for example when several views load the same resource at the same time. Because the mapping result is shared, callers must not assume exclusive ownership of the mapped objects. Cancelling the in-flight operation fails all of the coalesced requests with an `RKOperationCancelledError`.
+ 
+ Operations enqueued directly via `enqueueObjectRequestOperation:` are never coalesced.
+ 
+ **Default**: `NO`
+ */
+@property (nonatomic, assign) BOOL coalescesIdenticalRequests;
+
+///------------------------------------
+/// @name Sending Conditional Requests
+///------------------------------------
+
+/**
+ The conditional request cache assigned to all object request operations created by the receiver.
+ 
+ When set, the receiver's operations remember the `ETag` and `Last-Modified` validators of every resource they map successfully, automatically send `If-None-Match` and `If-Modified-Since` headers when the resource is requested again and return the previously mapped result on a 304 (Not Modified) response without deserializing or mapping the response. This applies to object mappings and entity mappings alike. Please refer to `RKConditionalRequestCache` for details.
+ 
+ **Default**: `nil`
+ */
+@property (nonatomic, strong) RKConditionalRequestCache *conditionalRequestCache;
+
 ///-----------------------------------------
 /// @name Batching Object Request Operations
 ///-----------------------------------------
@@ -60,24 +60,6 @@ static RKObjectManager  *sharedManager = nil;
 //////////////////////////////////
 // Utility Functions
 
-/**
- Returns the subset of the given array of `RKResponseDescriptor` objects that match the given path.
- 
- @param responseDescriptors An array of `RKResponseDescriptor` objects.
- @param path The path for which to select matching response descriptors.
- @param method The method for which to select matching response descriptors.
- @return An `NSArray` object whose elements are `RKResponseDescriptor` objects matching the given path and method.
- */
-#ifdef RKCoreDataIncluded
-static NSArray *RKFilteredArrayOfResponseDescriptorsMatchingPathAndMethod(NSArray *responseDescriptors, NSString *path, RKRequestMethod method)
-{
-    NSIndexSet *indexSet = [responseDescriptors indexesOfObjectsPassingTest:^BOOL(RKResponseDescriptor *responseDescriptor, NSUInteger idx, BOOL *stop) {
-        return [responseDescriptor matchesPath:path] && (method & responseDescriptor.method);
-    }];
-    return [responseDescriptors objectsAtIndexes:indexSet];
-}
-#endif
-
 /**
  Returns the first `RKRequestDescriptor` object from the given array that matches the given object.
  
@@ -315,10 +297,12 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
 @interface RKObjectManager ()
 @property (nonatomic, strong) NSMutableArray *mutableRequestDescriptors;
 @property (nonatomic, strong) NSMutableArray *mutableResponseDescriptors;
+@property (strong) RKResponseDescriptorIndex *responseDescriptorIndex;
 @property (nonatomic, strong) NSMutableArray *mutableFetchRequestBlocks;
 @property (nonatomic, strong) NSMutableArray *registeredHTTPRequestOperationClasses;
 @property (nonatomic, strong) NSMutableArray *registeredObjectRequestOperationClasses;
 @property (nonatomic, strong) NSMutableArray *registeredManagedObjectRequestOperationClasses;
+@property (nonatomic, strong) NSMutableDictionary *coalescedObjectRequestOperations;
 
 @end
 
@@ -337,6 +321,7 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
         self.registeredHTTPRequestOperationClasses = [NSMutableArray new];
         self.registeredManagedObjectRequestOperationClasses = [NSMutableArray new];
         self.registeredObjectRequestOperationClasses = [NSMutableArray new];
+        self.coalescedObjectRequestOperations = [NSMutableDictionary new];
         
         //Set default serializer if none set
         if(!client.requestSerializer){
@@ -532,6 +517,8 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     Class objectRequestOperationClass = [self requestOperationClassForRequest:request fromRegisteredClasses:self.registeredObjectRequestOperationClasses] ?: [RKObjectRequestOperation class];
     RKObjectRequestOperation *operation = [[objectRequestOperationClass alloc] initWithHTTPRequestOperation:HTTPRequestOperation responseDescriptors:responseDescriptors];
     [operation setCompletionBlockWithSuccess:success failure:failure];
+    [self assignResponseDescriptorIndexToObjectRequestOperation:operation];
+    operation.conditionalRequestCache = self.conditionalRequestCache;
     return operation;
 }
 
@@ -555,9 +542,11 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     Class objectRequestOperationClass = [self requestOperationClassForRequest:request fromRegisteredClasses:self.registeredManagedObjectRequestOperationClasses] ?: [RKManagedObjectRequestOperation class];
     RKManagedObjectRequestOperation *operation = (RKManagedObjectRequestOperation *)[[objectRequestOperationClass alloc] initWithHTTPRequestOperation:HTTPRequestOperation responseDescriptors:responseDescriptors];
     [operation setCompletionBlockWithSuccess:success failure:failure];
+    [self assignResponseDescriptorIndexToObjectRequestOperation:operation];
     operation.managedObjectContext = managedObjectContext ?: self.managedObjectStore.mainQueueManagedObjectContext;
     operation.managedObjectCache = self.managedObjectStore.managedObjectCache;
     operation.fetchRequestBlocks = self.fetchRequestBlocks;
+    operation.conditionalRequestCache = self.conditionalRequestCache;
     return operation;
 }
 #endif
@@ -587,7 +576,7 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     }
     
 #ifdef RKCoreDataIncluded
-    NSArray *matchingDescriptors = RKFilteredArrayOfResponseDescriptorsMatchingPathAndMethod(self.responseDescriptors, path, method);
+    NSArray *matchingDescriptors = [[self currentResponseDescriptorIndex] responseDescriptorsMatchingPath:path method:method];
     BOOL containsEntityMapping = RKDoesArrayOfResponseDescriptorsContainEntityMapping(matchingDescriptors);
     BOOL isManagedObjectRequestOperation = (containsEntityMapping || [object isKindOfClass:[NSManagedObject class]]);
     
@@ -655,8 +644,7 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     operation.mappingMetadata = @{ @"routing": @{ @"parameters": interpolatedParameters, @"route": route },
                                    @"query": @{ @"parameters": parameters ?: @{} } };
     
-    [operation setCompletionBlockWithSuccess:success failure:failure];
-    [self enqueueObjectRequestOperation:operation];
+    [self enqueueGETObjectRequestOperation:operation success:success failure:failure];
 }
 
 - (void)getObjectsAtPathForRouteNamed:(NSString *)routeName
@@ -677,8 +665,7 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     operation.mappingMetadata = @{ @"routing": @{ @"parameters": interpolatedParameters, @"route": route },
                                    @"query": @{ @"parameters": parameters ?: @{} } };
     
-    [operation setCompletionBlockWithSuccess:success failure:failure];
-    [self enqueueObjectRequestOperation:operation];
+    [self enqueueGETObjectRequestOperation:operation success:success failure:failure];
 }
 
 - (void)getObjectsAtPath:(NSString *)path
@@ -688,8 +675,7 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
 {
     NSParameterAssert(path);
     RKObjectRequestOperation *operation = [self appropriateObjectRequestOperationWithObject:nil method:RKRequestMethodGET path:path parameters:parameters];
-    [operation setCompletionBlockWithSuccess:success failure:failure];
-    [self enqueueObjectRequestOperation:operation];
+    [self enqueueGETObjectRequestOperation:operation success:success failure:failure];
 }
 
 - (void)getObject:(id)object
@@ -807,7 +793,25 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
 
 - (NSArray *)responseDescriptors
 {
-    return [NSArray arrayWithArray:self.mutableResponseDescriptors];
+    return [self currentResponseDescriptorIndex].responseDescriptors;
+}
+
+// The index is rebuilt lazily after the response descriptors have changed, and its array of descriptors doubles as the immutable snapshot returned by `responseDescriptors`
+- (RKResponseDescriptorIndex *)currentResponseDescriptorIndex
+{
+    RKResponseDescriptorIndex *responseDescriptorIndex = self.responseDescriptorIndex;
+    if (! responseDescriptorIndex) {
+        responseDescriptorIndex = [RKResponseDescriptorIndex indexWithResponseDescriptors:[NSArray arrayWithArray:self.mutableResponseDescriptors]];
+        self.responseDescriptorIndex = responseDescriptorIndex;
+    }
+    return responseDescriptorIndex;
+}
+
+// Operations created with the complete set of response descriptors share the index of the receiver
+- (void)assignResponseDescriptorIndexToObjectRequestOperation:(RKObjectRequestOperation *)operation
+{
+    RKResponseDescriptorIndex *responseDescriptorIndex = [self currentResponseDescriptorIndex];
+    if (operation.responseDescriptors == responseDescriptorIndex.responseDescriptors) operation.responseDescriptorIndex = responseDescriptorIndex;
 }
 
 - (void)addResponseDescriptor:(RKResponseDescriptor *)responseDescriptor
@@ -816,6 +820,7 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     NSAssert([responseDescriptor isKindOfClass:[RKResponseDescriptor class]], @"Expected an object of type RKResponseDescriptor, got '%@'", [responseDescriptor class]);
     responseDescriptor.baseURL = self.baseURL;
     [self.mutableResponseDescriptors addObject:responseDescriptor];
+    self.responseDescriptorIndex = nil;
 }
 
 - (void)addResponseDescriptorsFromArray:(NSArray *)responseDescriptors
@@ -830,6 +835,7 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     NSParameterAssert(responseDescriptor);
     NSAssert([responseDescriptor isKindOfClass:[RKResponseDescriptor class]], @"Expected an object of type RKResponseDescriptor, got '%@'", [responseDescriptor class]);
     [self.mutableResponseDescriptors removeObject:responseDescriptor];
+    self.responseDescriptorIndex = nil;
 }
 
 #pragma mark - Fetch Request Blocks
@@ -856,6 +862,76 @@ static BOOL RKDoesArrayOfResponseDescriptorsContainMappingForClass(NSArray *resp
     [self.operationQueue addOperation:objectRequestOperation];
 }
 
+// Identifies object request operations whose requests are interchangeable
+static id RKCoalescingKeyForObjectRequestOperation(RKObjectRequestOperation *operation)
+{
+    if (operation.targetObject) return nil;
+    NSURLRequest *request = operation.HTTPRequestOperation.request;
+    if (! [[request HTTPMethod] isEqualToString:@"GET"] || ![request URL]) return nil;
+    
+    // Response descriptors are compared by identity, a deep comparison of their mappings is too costly
+    NSMutableArray *responseDescriptorPointers = [NSMutableArray arrayWithCapacity:[operation.responseDescriptors count]];
+    for (RKResponseDescriptor *responseDescriptor in operation.responseDescriptors) {
+        [responseDescriptorPointers addObject:[NSValue valueWithNonretainedObject:responseDescriptor]];
+    }
+    id managedObjectContext = [NSNull null];
+#ifdef RKCoreDataIncluded
+    if ([operation isKindOfClass:[RKManagedObjectRequestOperation class]]) {
+        managedObjectContext = [NSValue valueWithNonretainedObject:[(RKManagedObjectRequestOperation *)operation managedObjectContext]];
+    }
+#endif
+    
+    return @[ [[request URL] absoluteString], [request allHTTPHeaderFields] ?: @{}, responseDescriptorPointers,
+              NSStringFromClass([operation class]), managedObjectContext, operation.mappingMetadata ?: @{} ];
+}
+
+- (void)enqueueGETObjectRequestOperation:(RKObjectRequestOperation *)operation
+                                 success:(void (^)(RKObjectRequestOperation *operation, RKMappingResult *mappingResult))success
+                                 failure:(void (^)(RKObjectRequestOperation *operation, NSError *error))failure
+{
+    id key = self.coalescesIdenticalRequests ? RKCoalescingKeyForObjectRequestOperation(operation) : nil;
+    if (! key) {
+        [operation setCompletionBlockWithSuccess:success failure:failure];
+        [self enqueueObjectRequestOperation:operation];
+        return;
+    }
+    
+    NSMutableDictionary *coalescedObjectRequestOperations = self.coalescedObjectRequestOperations;
+    @synchronized(coalescedObjectRequestOperations) {
+        NSMutableArray *coalescedBlocks = coalescedObjectRequestOperations[key];
+        if (coalescedBlocks) {
+            RKLogDebug(@"Coalescing GET request for '%@' with an identical request already in flight", [operation.HTTPRequestOperation.request URL]);
+            [coalescedBlocks addObject:@[ success ? [success copy] : [NSNull null], failure ? [failure copy] : [NSNull null] ]];
+            return;
+        }
+        coalescedBlocks = [NSMutableArray array];
+        coalescedObjectRequestOperations[key] = coalescedBlocks;
+    }
+    
+    // The first caller's blocks are invoked first, followed by the blocks of any coalesced callers
+    NSArray *(^dequeueCoalescedBlocks)(void) = ^{
+        @synchronized(coalescedObjectRequestOperations) {
+            NSArray *coalescedBlocks = [coalescedObjectRequestOperations[key] copy];
+            [coalescedObjectRequestOperations removeObjectForKey:key];
+            return coalescedBlocks;
+        }
+    };
+    [operation setCompletionBlockWithSuccess:^(RKObjectRequestOperation *operation, RKMappingResult *mappingResult) {
+        NSArray *coalescedBlocks = dequeueCoalescedBlocks();
+        if (success) success(operation, mappingResult);
+        for (NSArray *blocks in coalescedBlocks) {
+            if (blocks[0] != [NSNull null]) ((void (^)(RKObjectRequestOperation *, RKMappingResult *))blocks[0])(operation, mappingResult);
+        }
+    } failure:^(RKObjectRequestOperation *operation, NSError *error) {
+        NSArray *coalescedBlocks = dequeueCoalescedBlocks();
+        if (failure) failure(operation, error);
+        for (NSArray *blocks in coalescedBlocks) {
+            if (blocks[1] != [NSNull null]) ((void (^)(RKObjectRequestOperation *, NSError *))blocks[1])(operation, error);
+        }
+    }];
+    [self enqueueObjectRequestOperation:operation];
+}
+
 - (NSArray *)enqueuedObjectRequestOperationsWithMethod:(RKRequestMethod)method matchingPathPattern:(NSString *)pathPattern
 {
     NSMutableArray *matches = [NSMutableArray array];
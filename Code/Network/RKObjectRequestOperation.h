@@ -21,6 +21,8 @@
 #import "RKHTTPRequestOperation.h"
 #import "RKMappingResult.h"
 #import "RKMapperOperation.h"
+#import "RKConditionalRequestCache.h"
+#import "RKResponseDescriptorIndex.h"
 
 /**
  The key for a Boolean NSNumber value that indicates if a `NSCachedURLResponse` stored in the `NSURLCache` has been object mapped to completion. This key is stored on the `userInfo` of the cached response, if any, just before an `RKObjectRequestOperation` transitions to the finished state.
@@ -112,6 +114,16 @@ extern NSString * const RKResponseHasBeenMappedCacheUserInfoKey;
  */
 @property (nonatomic, strong, readonly) NSArray *responseDescriptors;
 
+/**
+ The index of the `responseDescriptors` with which the response descriptors matching the loaded response are found.
+
+ If not set, an index is created from the `responseDescriptors` of the receiver the first time it is accessed. `RKObjectManager` assigns a single index of its response descriptors to all of the operations it creates with them, so that the descriptors are indexed once rather than once per request.
+
+ @warning The index must have been created from the `responseDescriptors` of the receiver.
+ @see `RKResponseDescriptorIndex`
+ */
+@property (nonatomic, strong) RKResponseDescriptorIndex *responseDescriptorIndex;
+
 /**
  The target object for the object mapping operation.
  
@@ -124,6 +136,28 @@ extern NSString * const RKResponseHasBeenMappedCacheUserInfoKey;
  */
 @property (nonatomic, copy) NSDictionary *mappingMetadata;
 
+/**
+ A Boolean value that determines if the receiver streams the response body into the response mapper as it is received, rather than waiting for the entire body to be loaded before deserializing and mapping it.
+ 
+ When `YES`, the elements of top-level collections within a JSON response are object mapped while the remainder of the response is still being downloaded, reducing both the peak memory use and the latency until the first objects have been mapped for large collection responses. Only the first 64 KB of the response body are retained in the `responseData` of the `HTTPRequestOperation` in this mode, for logging and error reporting. Responses that cannot be mapped incrementally are buffered and mapped as usual. Please refer to `[RKResponseMapperOperation appendResponseData:]` for details.
+ 
+ **Default**: `NO`
+ 
+ @warning Incremental mapping is not supported by `RKManagedObjectRequestOperation`, which always returns `NO`.
+ */
+@property (nonatomic, assign) BOOL mapsResponseIncrementally;
+
+/**
+ The conditional request cache used by the receiver to send conditional `GET` requests for resources that have been mapped previously and to skip the deserialization and mapping of 304 (Not Modified) responses.
+ 
+ When set, the receiver adds `If-None-Match` and `If-Modified-Since` headers to its request for any resource tracked by the cache. If the server responds with a 304 (Not Modified) status code, the mapping result of the previous load of the resource is returned without deserializing or mapping the response. Successfully mapped 200 (OK) responses carrying an `ETag` or `Last-Modified` header are stored in the cache. The cache is not consulted when the receiver has a `targetObject`.
+ 
+ **Default**: `nil`
+ 
+ @see `RKConditionalRequestCache`
+ */
+@property (nonatomic, strong) RKConditionalRequestCache *conditionalRequestCache;
+
 ///----------------------------------
 /// @name Accessing Operation Results
 ///----------------------------------
@@ -205,7 +239,9 @@ extern NSString * const RKResponseHasBeenMappedCacheUserInfoKey;
 /**
  Returns the operation queue used by all object request operations when object mapping the body of a response loaded via HTTP.
  
- By default, the response mapping queue is configured with a maximum concurrent operation count of 1, ensuring that only one HTTP response is mapped at a time.
+ By default, the response mapping queue is configured with a maximum concurrent operation count equal to the number of active processors. Responses mapped by `RKObjectRequestOperation` share no state and are mapped concurrently. Responses mapped by `RKManagedObjectRequestOperation` are serialized per target `managedObjectContext`: only one response is mapped into a given context at a time, in the order in which the responses were received, while responses targeting different contexts are mapped concurrently. Setting the maximum concurrent operation count of the queue to 1 restores the behavior of mapping only one HTTP response at a time.
+ 
+ @warning Blocks such as the `willMapDeserializedResponseBlock` may be invoked concurrently for different operations.
  
  @return The response mapping queue.
  */
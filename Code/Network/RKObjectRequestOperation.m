@@ -285,10 +285,17 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
 @property (nonatomic, strong) NSDate *mappingDidFinishDate;
 @property (nonatomic, copy) void (^successBlock)(RKObjectRequestOperation *operation, RKMappingResult *mappingResult);
 @property (nonatomic, copy) void (^failureBlock)(RKObjectRequestOperation *operation, NSError *error);
++ (void)enqueueResponseMapperOperation:(NSOperation *)responseMapperOperation serializedWithKey:(id)key;
+@end
+
+@interface RKHTTPRequestOperation ()
+@property (readwrite, nonatomic, strong) NSURLRequest *request;
 @end
 
 @implementation RKObjectRequestOperation
 
+@synthesize responseDescriptorIndex = _responseDescriptorIndex;
+
 + (NSOperationQueue *)responseMappingQueue
 {
     static NSOperationQueue *responseMappingQueue = nil;
@@ -296,12 +303,32 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
     dispatch_once(&onceToken, ^{
         responseMappingQueue = [NSOperationQueue new];
         [responseMappingQueue setName:@"RKObjectRequestOperation Response Mapping Queue" ];
-        [responseMappingQueue setMaxConcurrentOperationCount:1];
+        [responseMappingQueue setMaxConcurrentOperationCount:[[NSProcessInfo processInfo] activeProcessorCount]];
     });
     
     return responseMappingQueue;
 }
 
++ (void)enqueueResponseMapperOperation:(NSOperation *)responseMapperOperation serializedWithKey:(id)key
+{
+    static NSMapTable *lastOperationsByKey = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        lastOperationsByKey = [NSMapTable weakToWeakObjectsMapTable];
+    });
+    
+    // Operations sharing a key are chained via dependencies so that they execute one at a time and in order
+    if (key) {
+        @synchronized(lastOperationsByKey) {
+            NSOperation *lastOperation = [lastOperationsByKey objectForKey:key];
+            if (lastOperation && ![lastOperation isFinished]) [responseMapperOperation addDependency:lastOperation];
+            [lastOperationsByKey setObject:responseMapperOperation forKey:key];
+        }
+    }
+    
+    [[self responseMappingQueue] addOperation:responseMapperOperation];
+}
+
 + (dispatch_queue_t)dispatchQueue
 {
     static dispatch_queue_t dispatchQueue;
@@ -372,6 +399,18 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
     return [self initWithHTTPRequestOperation:[[RKHTTPRequestOperation alloc] initWithRequest:request HTTPClient:[RKHTTPClient new]] responseDescriptors:responseDescriptors];
 }
 
+- (RKResponseDescriptorIndex *)responseDescriptorIndex
+{
+    if (! _responseDescriptorIndex) _responseDescriptorIndex = [RKResponseDescriptorIndex indexWithResponseDescriptors:self.responseDescriptors];
+    return _responseDescriptorIndex;
+}
+
+- (void)setResponseDescriptorIndex:(RKResponseDescriptorIndex *)responseDescriptorIndex
+{
+    NSAssert(responseDescriptorIndex == nil || [responseDescriptorIndex.responseDescriptors isEqualToArray:self.responseDescriptors], @"The response descriptor index must have been created from the response descriptors of the operation");
+    _responseDescriptorIndex = responseDescriptorIndex;
+}
+
 - (void)setSuccessCallbackQueue:(dispatch_queue_t)successCallbackQueue
 {
    if (successCallbackQueue != _successCallbackQueue) {
@@ -471,21 +510,30 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
 #pragma clang diagnostic pop
 }
 
+- (RKObjectResponseMapperOperation *)responseMapperOperationWithResponse:(NSHTTPURLResponse *)response data:(NSData *)data
+{
+    RKObjectResponseMapperOperation *responseMapperOperation = [[RKObjectResponseMapperOperation alloc] initWithRequest:self.HTTPRequestOperation.request
+                                                                                                               response:response
+                                                                                                                   data:data
+                                                                                                responseDescriptorIndex:self.responseDescriptorIndex];
+    responseMapperOperation.targetObject = self.targetObject;
+    responseMapperOperation.mappingMetadata = self.mappingMetadata;
+    responseMapperOperation.mapperDelegate = self;
+    [responseMapperOperation setQueuePriority:[self queuePriority]];
+    [responseMapperOperation setWillMapDeserializedResponseBlock:self.willMapDeserializedResponseBlock];
+    return responseMapperOperation;
+}
+
 - (void)performMappingOnResponseWithCompletionBlock:(void(^)(RKMappingResult *mappingResult, NSError *error))completionBlock
 {
-    self.responseMapperOperation = [[RKObjectResponseMapperOperation alloc] initWithRequest:self.HTTPRequestOperation.request
-                                                                                   response:self.HTTPRequestOperation.response
-                                                                                       data:self.HTTPRequestOperation.responseData
-                                                                        responseDescriptors:self.responseDescriptors];
-    self.responseMapperOperation.targetObject = self.targetObject;
-    self.responseMapperOperation.mappingMetadata = self.mappingMetadata;
-    self.responseMapperOperation.mapperDelegate = self;
-    [self.responseMapperOperation setQueuePriority:[self queuePriority]];
-    [self.responseMapperOperation setWillMapDeserializedResponseBlock:self.willMapDeserializedResponseBlock];
+    // When mapping incrementally the response mapper has already been fed the response body as it arrived
+    if (! self.responseMapperOperation) {
+        self.responseMapperOperation = [self responseMapperOperationWithResponse:self.HTTPRequestOperation.response data:self.HTTPRequestOperation.responseData];
+    }
     [self.responseMapperOperation setDidFinishMappingBlock:^(RKMappingResult *mappingResult, NSError *error) {
         completionBlock(mappingResult, error);
     }];
-    [[RKObjectRequestOperation responseMappingQueue] addOperation:self.responseMapperOperation];
+    [RKObjectRequestOperation enqueueResponseMapperOperation:self.responseMapperOperation serializedWithKey:nil];
 }
 
 - (void)execute
@@ -499,6 +547,15 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
         }
         
         weakSelf.mappingDidStartDate = [NSDate date];
+        RKMappingResult *notModifiedMappingResult = [weakSelf mappingResultForNotModifiedResponse];
+        if (notModifiedMappingResult) {
+            RKLogDebug(@"Loaded 304 (Not Modified) response for '%@': returning the previously mapped result without mapping", [operation.request URL]);
+            weakSelf.mappingResult = notModifiedMappingResult;
+            weakSelf.mappingDidFinishDate = [NSDate date];
+            [weakSelf.stateMachine finish];
+            return;
+        }
+        
         [weakSelf performMappingOnResponseWithCompletionBlock:^(RKMappingResult *mappingResult, NSError *error) {
             if (weakSelf.isCancelled) {
                 [weakSelf.stateMachine finish];
@@ -527,6 +584,13 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
                     NSCachedURLResponse *newCachedResponse = [[NSCachedURLResponse alloc] initWithResponse:cachedResponse.response data:cachedResponse.rkData userInfo:userInfo storagePolicy:cachedResponse.storagePolicy];
                     [[NSURLCache sharedURLCache] storeCachedResponse:newCachedResponse forRequest:weakSelf.HTTPRequestOperation.request];
                 }
+                
+                if (weakSelf.conditionalRequestCache && !weakSelf.targetObject) {
+                    [weakSelf.conditionalRequestCache storeMappingResult:[weakSelf mappingResultForConditionalRequestCache:mappingResult]
+                                                              forRequest:weakSelf.HTTPRequestOperation.request
+                                                                response:weakSelf.HTTPRequestOperation.response
+                                                     responseDescriptors:weakSelf.responseDescriptors];
+                }
             }
             
             weakSelf.mappingDidFinishDate = [NSDate date];
@@ -538,10 +602,42 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
         [weakSelf.stateMachine finish];
     }];
     
+    if (self.mapsResponseIncrementally) {
+        [self.HTTPRequestOperation setDidReceiveDataBlock:^(RKHTTPRequestOperation *operation, NSData *data) {
+            if (! weakSelf.responseMapperOperation) {
+                weakSelf.responseMapperOperation = [weakSelf responseMapperOperationWithResponse:operation.response data:nil];
+            }
+            [weakSelf.responseMapperOperation appendResponseData:data];
+        }];
+    }
+    
+    // Validate the previously mapped representation of the resource, if any
+    if (self.conditionalRequestCache && !self.targetObject) {
+        NSURLRequest *conditionalRequest = [self.conditionalRequestCache conditionalRequestForRequest:self.HTTPRequestOperation.request responseDescriptors:self.responseDescriptors];
+        if (conditionalRequest) self.HTTPRequestOperation.request = conditionalRequest;
+    }
+    
     // Send the request
     [self.HTTPRequestOperation start];
 }
 
+- (RKMappingResult *)mappingResultForNotModifiedResponse
+{
+    if (! self.conditionalRequestCache || self.targetObject || self.HTTPRequestOperation.response.statusCode != 304) return nil;
+    RKMappingResult *cachedMappingResult = [self.conditionalRequestCache mappingResultForRequest:self.HTTPRequestOperation.request responseDescriptors:self.responseDescriptors];
+    return cachedMappingResult ? [self mappingResultFromConditionalRequestCache:cachedMappingResult] : nil;
+}
+
+- (RKMappingResult *)mappingResultForConditionalRequestCache:(RKMappingResult *)mappingResult
+{
+    return mappingResult;
+}
+
+- (RKMappingResult *)mappingResultFromConditionalRequestCache:(RKMappingResult *)cachedMappingResult
+{
+    return cachedMappingResult;
+}
+
 - (NSString *)description {
     return [NSString stringWithFormat:@"<%@: %p, state: %@, isCancelled=%@, request: %@, response: %@>",
             NSStringFromClass([self class]), self, RKStringForStateOfObjectRequestOperation(self), [self isCancelled] ? @"YES" : @"NO",
@@ -559,6 +655,9 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
     RKObjectRequestOperation *operation = [(RKObjectRequestOperation *)[[self class] allocWithZone:zone] initWithHTTPRequestOperation:[self.HTTPRequestOperation copyWithZone:zone] responseDescriptors:self.responseDescriptors];
     operation.targetObject = self.targetObject;
     operation.mappingMetadata = self.mappingMetadata;
+    operation.mapsResponseIncrementally = self.mapsResponseIncrementally;
+    operation.conditionalRequestCache = self.conditionalRequestCache;
+    operation.responseDescriptorIndex = self.responseDescriptorIndex;
     operation.successCallbackQueue = self.successCallbackQueue;
     operation.failureCallbackQueue = self.failureCallbackQueue;
     operation.willMapDeserializedResponseBlock = self.willMapDeserializedResponseBlock;
@@ -42,4 +42,24 @@
  */
 - (void)willFinish;
 
+/**
+ Returns the representation of the given mapping result to be stored in the `conditionalRequestCache`.
+ 
+ The default implementation returns the mapping result unchanged.
+ 
+ @param mappingResult The mapping result produced by the receiver.
+ @return The mapping result to be cached.
+ */
+- (RKMappingResult *)mappingResultForConditionalRequestCache:(RKMappingResult *)mappingResult;
+
+/**
+ Returns the mapping result to be returned for a 304 (Not Modified) response given the mapping result stored in the `conditionalRequestCache`.
+ 
+ The default implementation returns the cached mapping result unchanged.
+ 
+ @param cachedMappingResult The mapping result retrieved from the conditional request cache.
+ @return The mapping result of the receiver.
+ */
+- (RKMappingResult *)mappingResultFromConditionalRequestCache:(RKMappingResult *)cachedMappingResult;
+
 @end
@@ -39,6 +39,8 @@ NSString *RKPathFromPatternWithObject(NSString *pathPattern, id object);
 /**
  The `RKPathMatcher` class performs pattern matching and parameter parsing of strings, typically representing the path portion of an `NSURL` object. It provides much of the necessary tools to map a given path to local objects (the inverse of RKRouter's function).  This makes it easier to implement the `RKManagedObjectCaching` protocol and generate `NSFetchRequest` objects from a given path.  There are two means of instantiating and using a matcher object in order to provide more flexibility in implementations, and to improve efficiency by eliminating repetitive and costly pattern initializations.
 
+ Patterns are compiled once per process: compiled patterns are kept in a thread-safe cache keyed by pattern string and are shared by every matcher created for, or matched against, the same pattern string. A compiled pattern also records the number of slashes in the pattern, so that paths with a different number of path segments are rejected before the pattern is evaluated.
+
  @see `RKManagedObjectCaching`
  @see `RKPathFromPatternWithObject`
  @see `RKRouter`
@@ -40,14 +40,56 @@ static NSString *RKEncodeURLString(NSString *unencodedString)
 
 static NSUInteger RKNumberOfSlashesInString(NSString *string)
 {
-    static NSRegularExpression *regex = nil;
+    CFStringInlineBuffer buffer;
+    CFIndex length = CFStringGetLength((__bridge CFStringRef)string);
+    CFStringInitInlineBuffer((__bridge CFStringRef)string, &buffer, CFRangeMake(0, length));
+    NSUInteger numberOfSlashes = 0;
+    for (CFIndex index = 0; index < length; index++) {
+        if (CFStringGetCharacterFromInlineBuffer(&buffer, index) == '/') numberOfSlashes++;
+    }
+    return numberOfSlashes;
+}
+
+/**
+ An `RKCompiledPathPattern` object pairs the `SOCPattern` compiled from a pattern string with the number of slashes in the pattern, which a path must share in order to match it. Compiled patterns are immutable and are shared by all path matchers via a process-wide cache.
+ */
+@interface RKCompiledPathPattern : NSObject
+@property (nonatomic, copy) NSString *patternString;
+@property (nonatomic, strong) SOCPattern *socPattern;
+@property (nonatomic, assign) NSUInteger numberOfSlashes;
++ (instancetype)compiledPathPatternWithString:(NSString *)patternString;
+@end
+
+@implementation RKCompiledPathPattern
+
++ (NSCache *)cache
+{
+    static NSCache *cache = nil;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
-        regex = [NSRegularExpression regularExpressionWithPattern:@"/" options:NSRegularExpressionCaseInsensitive error:nil];
+        cache = [NSCache new];
+        [cache setName:@"org.restkit.network.compiled-path-patterns"];
     });
-    return [regex numberOfMatchesInString:string options:0 range:NSMakeRange(0, [string length])];
+    return cache;
 }
 
++ (instancetype)compiledPathPatternWithString:(NSString *)patternString
+{
+    NSCache *cache = [self cache];
+    RKCompiledPathPattern *compiledPathPattern = [cache objectForKey:patternString];
+    if (! compiledPathPattern) {
+        // Concurrent misses may compile the same pattern more than once, which is harmless as compiled patterns are immutable
+        compiledPathPattern = [self new];
+        compiledPathPattern.patternString = patternString;
+        compiledPathPattern.socPattern = [SOCPattern patternWithString:patternString];
+        compiledPathPattern.numberOfSlashes = RKNumberOfSlashesInString(patternString);
+        [cache setObject:compiledPathPattern forKey:compiledPathPattern.patternString];
+    }
+    return compiledPathPattern;
+}
+
+@end
+
 NSString *RKPathFromPatternWithObject(NSString *pathPattern, id object)
 {
     NSCAssert(object != NULL, @"Object provided is invalid; cannot create a path from a NULL object");
@@ -56,8 +98,7 @@ NSString *RKPathFromPatternWithObject(NSString *pathPattern, id object)
 }
 
 @interface RKPathMatcher ()
-@property (nonatomic, strong) SOCPattern *socPattern;
-@property (nonatomic, copy) NSString *patternString; // SOCPattern keeps it private
+@property (nonatomic, strong) RKCompiledPathPattern *compiledPathPattern;
 @property (nonatomic, copy) NSString *sourcePath;
 @end
 
@@ -66,8 +107,7 @@ NSString *RKPathFromPatternWithObject(NSString *pathPattern, id object)
 - (id)copyWithZone:(NSZone *)zone
 {
     RKPathMatcher *copy = [[[self class] allocWithZone:zone] init];
-    copy.socPattern = self.socPattern;
-    copy.patternString = self.patternString;
+    copy.compiledPathPattern = self.compiledPathPattern;
     copy.sourcePath = self.sourcePath;
     return copy;
 }
@@ -76,8 +116,7 @@ NSString *RKPathFromPatternWithObject(NSString *pathPattern, id object)
 {
     NSAssert(patternString != NULL, @"Pattern string must not be empty in order to perform pattern matching.");
     RKPathMatcher *matcher = [self new];
-    matcher.socPattern = [SOCPattern patternWithString:patternString];
-    matcher.patternString = patternString;
+    matcher.compiledPathPattern = [RKCompiledPathPattern compiledPathPatternWithString:patternString];
     return matcher;
 }
 
@@ -88,48 +127,50 @@ NSString *RKPathFromPatternWithObject(NSString *pathPattern, id object)
     return matcher;
 }
 
-- (BOOL)itMatchesAndHasParsedArguments:(NSDictionary **)arguments andPattern:(NSString*)pattern andSourcePath:(NSString*)sourcePath tokenizeQueryStrings:(BOOL)shouldTokenize
+- (BOOL)itMatchesAndHasParsedArguments:(NSDictionary **)arguments andPattern:(RKCompiledPathPattern *)compiledPathPattern andSourcePath:(NSString*)sourcePath tokenizeQueryStrings:(BOOL)shouldTokenize
 {
-    NSMutableDictionary *argumentsCollection = [NSMutableDictionary dictionary];
-    NSString *rootPath = [sourcePath copy];
-    NSArray *components = [sourcePath componentsSeparatedByString:@"?"];
-    SOCPattern *socPattern = [SOCPattern patternWithString:pattern];
+    NSString *rootPath = sourcePath;
+    NSString *queryString = nil;
     
     // Bifurcate Source Path From Query Parameters
     
-    if ([components count] > 1) {
+    if ([sourcePath rangeOfString:@"?"].location != NSNotFound) {
+        NSArray *components = [sourcePath componentsSeparatedByString:@"?"];
         rootPath = [components objectAtIndex:0];
-        NSDictionary *queryParameters = RKQueryParametersFromStringWithEncoding([components objectAtIndex:1], NSUTF8StringEncoding);
-        if (shouldTokenize) {
-            [argumentsCollection addEntriesFromDictionary:queryParameters];
-        }
+        queryString = [components objectAtIndex:1];
     }
     
-    bool rootPathMatchesPattern = RKNumberOfSlashesInString(pattern) == RKNumberOfSlashesInString(rootPath);
+    // A parameter never spans a slash, so a path with a different number of slashes cannot match
+    if (RKNumberOfSlashesInString(rootPath) != compiledPathPattern.numberOfSlashes) return NO;
     
+    SOCPattern *socPattern = compiledPathPattern.socPattern;
     if (![socPattern stringMatches:rootPath]) return NO;
-    if (!arguments) return YES && rootPathMatchesPattern;
+    if (!arguments) return YES;
+    NSMutableDictionary *argumentsCollection = [NSMutableDictionary dictionary];
+    if (queryString && shouldTokenize) {
+        [argumentsCollection addEntriesFromDictionary:RKQueryParametersFromStringWithEncoding(queryString, NSUTF8StringEncoding)];
+    }
     NSDictionary *extracted = [socPattern parameterDictionaryFromSourceString:rootPath];
     if (extracted) [argumentsCollection addEntriesFromDictionary:RKDictionaryByReplacingPercentEscapesInEntriesFromDictionary(extracted)];
     *arguments = argumentsCollection;
-    return YES && rootPathMatchesPattern;
+    return YES;
 }
 
 - (BOOL)matchesPattern:(NSString *)patternString tokenizeQueryStrings:(BOOL)shouldTokenize parsedArguments:(NSDictionary **)arguments
 {
     NSAssert(self.sourcePath != NULL, @"Matcher is not configured correctly. Instantiate it using pathMatcherWithPath: to use matchesPattern:tokenizeQueryStrings:parsedArguments");
     NSAssert(patternString != NULL, @"Pattern string must not be empty in order to perform patterm matching.");
-    return [self itMatchesAndHasParsedArguments:arguments andPattern:patternString andSourcePath:self.sourcePath tokenizeQueryStrings:shouldTokenize];
+    return [self itMatchesAndHasParsedArguments:arguments andPattern:[RKCompiledPathPattern compiledPathPatternWithString:patternString] andSourcePath:self.sourcePath tokenizeQueryStrings:shouldTokenize];
 }
 
 - (BOOL)matchesPath:(NSString *)sourceString tokenizeQueryStrings:(BOOL)shouldTokenize parsedArguments:(NSDictionary **)arguments
 {
-    return [self itMatchesAndHasParsedArguments:arguments andPattern:self.patternString andSourcePath:sourceString tokenizeQueryStrings:shouldTokenize];
+    return [self itMatchesAndHasParsedArguments:arguments andPattern:self.compiledPathPattern andSourcePath:sourceString tokenizeQueryStrings:shouldTokenize];
 }
 
 - (NSString *)pathFromObject:(id)object addingEscapes:(BOOL)addEscapes interpolatedParameters:(NSDictionary **)interpolatedParameters
 {
-    NSAssert(self.socPattern != NULL, @"Matcher has no established pattern.  Instantiate it using pathMatcherWithPattern: before calling pathFromObject:");
+    NSAssert(self.compiledPathPattern.socPattern != NULL, @"Matcher has no established pattern.  Instantiate it using pathMatcherWithPattern: before calling pathFromObject:");
     NSAssert(object != NULL, @"Object provided is invalid; cannot create a path from a NULL object");
     NSString *(^encoderBlock)(NSString *interpolatedString) = nil;
     if (addEscapes) {
@@ -137,9 +178,9 @@ NSString *RKPathFromPatternWithObject(NSString *pathPattern, id object)
             return RKEncodeURLString(interpolatedString);
         };
     }
-    NSString *path = [self.socPattern stringFromObject:object withBlock:encoderBlock];
+    NSString *path = [self.compiledPathPattern.socPattern stringFromObject:object withBlock:encoderBlock];
     if (interpolatedParameters) {
-        NSMutableDictionary *parsedParameters = [[self.socPattern parameterDictionaryFromSourceString:path] mutableCopy];
+        NSMutableDictionary *parsedParameters = [[self.compiledPathPattern.socPattern parameterDictionaryFromSourceString:path] mutableCopy];
         if (addEscapes) {
             for (NSString *key in [parsedParameters allKeys]) {
                 NSString *unescapedParameter = [parsedParameters[key] stringByReplacingPercentEscapesUsingEncoding:NSUTF8StringEncoding];
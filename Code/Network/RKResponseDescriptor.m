@@ -122,8 +122,7 @@ extern NSString *RKStringDescribingRequestMethod(RKRequestMethod method);
 - (BOOL)matchesPath:(NSString *)path parsedArguments:(NSDictionary **)outParsedArguments
 {
     if (!self.pathPattern || !path) return YES;
-    RKPathMatcher *pathMatcher = [RKPathMatcher pathMatcherWithPattern:self.pathPattern];
-    return [pathMatcher matchesPath:path tokenizeQueryStrings:NO parsedArguments:outParsedArguments];
+    return [self.pathPatternMatcher matchesPath:path tokenizeQueryStrings:NO parsedArguments:outParsedArguments];
 }
 
 - (BOOL)matchesURL:(NSURL *)URL
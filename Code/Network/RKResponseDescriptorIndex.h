@@ -0,0 +1,88 @@
+//
+//  RKResponseDescriptorIndex.h
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "RKHTTPUtilities.h"
+
+/**
+ The `RKResponseDescriptorIndex` class organizes an array of `RKResponseDescriptor` objects into a route index so that the descriptors matching a response or path can be found without evaluating the path pattern of every descriptor.
+
+ The path patterns of the indexed descriptors are split on the `/` character and inserted into a tree of path segments, one tree per distinct `baseURL`. Segments without a colon-prefixed parameter are matched literally while parameterized segments (such as `:articleID` or `:filename\\.json`) match any single segment of the path. Every node of the tree records the union of the request methods of the descriptors below it, so that branches that cannot match the request method are skipped. A lookup walks the tree along the segments of the path and thus takes time proportional to the length of the path rather than the number of descriptors. Only the descriptors whose patterns contain parameters are subsequently evaluated with their `RKPathMatcher`, which also yields their parsed arguments.
+
+ The results of a lookup are identical to evaluating `matchesResponse:` or `matchesPath:` of each descriptor in turn, and are returned in the order of the indexed array.
+
+ Indexes are immutable and may be shared between threads. The `pathPattern` and `baseURL` of each descriptor are captured when the index is created, so an index must be rebuilt if the `baseURL` of an indexed descriptor is changed.
+ */
+@interface RKResponseDescriptorIndex : NSObject
+
+///-------------------------------------------
+/// @name Creating a Response Descriptor Index
+///-------------------------------------------
+
+/**
+ Creates and returns an index of the given response descriptors.
+
+ @param responseDescriptors An array of `RKResponseDescriptor` objects to index.
+ @return A new index of the given response descriptors.
+ */
++ (instancetype)indexWithResponseDescriptors:(NSArray *)responseDescriptors;
+
+/**
+ Initializes the receiver with the given response descriptors.
+
+ This is the designated initializer.
+
+ @param responseDescriptors An array of `RKResponseDescriptor` objects to index.
+ @return The receiver, initialized with an index of the given response descriptors.
+ */
+- (instancetype)initWithResponseDescriptors:(NSArray *)responseDescriptors NS_DESIGNATED_INITIALIZER;
+
+/**
+ The response descriptors indexed by the receiver.
+ */
+@property (nonatomic, copy, readonly) NSArray *responseDescriptors;
+
+///--------------------------------------------
+/// @name Finding Matching Response Descriptors
+///--------------------------------------------
+
+/**
+ Returns the indexed response descriptors that match the given path and request method.
+
+ A descriptor matches if `matchesPath:` returns `YES` for the given path and its `method` includes the given method. The `baseURL` of the descriptors is not considered.
+
+ @param path The path to match against the path patterns of the indexed descriptors.
+ @param method The request method to match against the methods of the indexed descriptors.
+ @return An array of matching response descriptors, in the order of the `responseDescriptors` array.
+ */
+- (NSArray *)responseDescriptorsMatchingPath:(NSString *)path method:(RKRequestMethod)method;
+
+/**
+ Returns the indexed response descriptors that match the given response and the method of the request that loaded it.
+
+ A descriptor matches if `matchesResponse:` returns `YES` for the given response and its `method` includes the given method.
+
+ @param response The HTTP response to match against the base URLs, path patterns and status codes of the indexed descriptors.
+ @param method The method of the request for which the response was loaded.
+ @param parsedArguments On return, an array with an element for each matching descriptor: the dictionary of arguments parsed from the response URL by its path pattern, as returned by `parsedArgumentsFromResponse:`, or `[NSNull null]` if the descriptor does not have a path pattern. May be `NULL`.
+ @return An array of matching response descriptors, in the order of the `responseDescriptors` array.
+ */
+- (NSArray *)responseDescriptorsMatchingResponse:(NSHTTPURLResponse *)response method:(RKRequestMethod)method parsedArguments:(NSArray **)parsedArguments;
+
+@end
@@ -0,0 +1,246 @@
+//
+//  RKResponseDescriptorIndex.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKResponseDescriptorIndex.h"
+#import "RKResponseDescriptor.h"
+
+// `RKPathMatcher` disregards the query string of the path and requires the path and pattern to contain the same number of slashes
+static NSArray *RKPathSegmentsFromPath(NSString *path)
+{
+    NSRange queryRange = [path rangeOfString:@"?"];
+    if (queryRange.location != NSNotFound) path = [path substringToIndex:queryRange.location];
+    return [path componentsSeparatedByString:@"/"];
+}
+
+// Parameters and escapes are evaluated by `SOCPattern` rather than by string comparison
+static BOOL RKPathPatternIsLiteral(NSString *pathPattern)
+{
+    static NSCharacterSet *parameterCharacterSet = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        parameterCharacterSet = [NSCharacterSet characterSetWithCharactersInString:@":\\"];
+    });
+    return [pathPattern rangeOfCharacterFromSet:parameterCharacterSet].location == NSNotFound;
+}
+
+@interface RKResponseDescriptorIndexNode : NSObject
+@property (nonatomic, strong) NSMutableDictionary *literalChildren;
+@property (nonatomic, strong) RKResponseDescriptorIndexNode *parameterChild;
+@property (nonatomic, strong) NSMutableIndexSet *terminalIndexes;
+@property (nonatomic, assign) RKRequestMethod methods;
+@end
+
+@implementation RKResponseDescriptorIndexNode
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.literalChildren = [NSMutableDictionary dictionary];
+        self.terminalIndexes = [NSMutableIndexSet indexSet];
+    }
+    return self;
+}
+
+- (RKResponseDescriptorIndexNode *)childForPatternSegment:(NSString *)segment
+{
+    if (! RKPathPatternIsLiteral(segment)) {
+        if (! self.parameterChild) self.parameterChild = [RKResponseDescriptorIndexNode new];
+        return self.parameterChild;
+    }
+
+    RKResponseDescriptorIndexNode *child = self.literalChildren[segment];
+    if (! child) {
+        child = [RKResponseDescriptorIndexNode new];
+        self.literalChildren[segment] = child;
+    }
+    return child;
+}
+
+- (void)addIndexesMatchingSegments:(NSArray *)segments fromIndex:(NSUInteger)segmentIndex method:(RKRequestMethod)method toIndexSet:(NSMutableIndexSet *)indexSet
+{
+    if (! (self.methods & method)) return;
+    if (segmentIndex == [segments count]) {
+        [indexSet addIndexes:self.terminalIndexes];
+        return;
+    }
+
+    [self.literalChildren[segments[segmentIndex]] addIndexesMatchingSegments:segments fromIndex:segmentIndex + 1 method:method toIndexSet:indexSet];
+    [self.parameterChild addIndexesMatchingSegments:segments fromIndex:segmentIndex + 1 method:method toIndexSet:indexSet];
+}
+
+@end
+
+// The descriptors sharing a base URL
+@interface RKResponseDescriptorIndexTree : NSObject
+@property (nonatomic, copy) NSURL *baseURL;
+@property (nonatomic, strong) RKResponseDescriptorIndexNode *rootNode;
+@property (nonatomic, strong) NSMutableIndexSet *indexes;
+@property (nonatomic, strong) NSMutableIndexSet *unpatternedIndexes;
+@end
+
+@implementation RKResponseDescriptorIndexTree
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.rootNode = [RKResponseDescriptorIndexNode new];
+        self.indexes = [NSMutableIndexSet indexSet];
+        self.unpatternedIndexes = [NSMutableIndexSet indexSet];
+    }
+    return self;
+}
+
+- (void)addResponseDescriptor:(RKResponseDescriptor *)responseDescriptor atIndex:(NSUInteger)index
+{
+    [self.indexes addIndex:index];
+    if (! responseDescriptor.pathPattern) {
+        [self.unpatternedIndexes addIndex:index];
+        return;
+    }
+
+    RKResponseDescriptorIndexNode *node = self.rootNode;
+    node.methods |= responseDescriptor.method;
+    for (NSString *segment in [responseDescriptor.pathPattern componentsSeparatedByString:@"/"]) {
+        node = [node childForPatternSegment:segment];
+        node.methods |= responseDescriptor.method;
+    }
+    [node.terminalIndexes addIndex:index];
+}
+
+- (NSIndexSet *)candidateIndexesForPath:(NSString *)path method:(RKRequestMethod)method
+{
+    // A nil path matches every descriptor
+    if (! path) return self.indexes;
+
+    NSMutableIndexSet *indexSet = [self.unpatternedIndexes mutableCopy];
+    [self.rootNode addIndexesMatchingSegments:RKPathSegmentsFromPath(path) fromIndex:0 method:method toIndexSet:indexSet];
+    return indexSet;
+}
+
+@end
+
+@interface RKResponseDescriptorIndex ()
+@property (nonatomic, copy, readwrite) NSArray *responseDescriptors;
+@property (nonatomic, copy) NSArray *trees;
+@property (nonatomic, copy) NSIndexSet *literalIndexes;
+@end
+
+@implementation RKResponseDescriptorIndex
+
++ (instancetype)indexWithResponseDescriptors:(NSArray *)responseDescriptors
+{
+    return [[self alloc] initWithResponseDescriptors:responseDescriptors];
+}
+
+- (instancetype)initWithResponseDescriptors:(NSArray *)responseDescriptors
+{
+    NSParameterAssert(responseDescriptors);
+    self = [super init];
+    if (self) {
+        self.responseDescriptors = responseDescriptors;
+
+        NSMutableDictionary *treesByBaseURL = [NSMutableDictionary dictionary];
+        NSMutableArray *trees = [NSMutableArray array];
+        NSMutableIndexSet *literalIndexes = [NSMutableIndexSet indexSet];
+        [self.responseDescriptors enumerateObjectsUsingBlock:^(RKResponseDescriptor *responseDescriptor, NSUInteger idx, BOOL *stop) {
+            id key = [responseDescriptor.baseURL absoluteString] ?: [NSNull null];
+            RKResponseDescriptorIndexTree *tree = treesByBaseURL[key];
+            if (! tree) {
+                tree = [RKResponseDescriptorIndexTree new];
+                tree.baseURL = responseDescriptor.baseURL;
+                treesByBaseURL[key] = tree;
+                [trees addObject:tree];
+            }
+            [tree addResponseDescriptor:responseDescriptor atIndex:idx];
+            if (responseDescriptor.pathPattern && RKPathPatternIsLiteral(responseDescriptor.pathPattern)) [literalIndexes addIndex:idx];
+        }];
+        self.trees = trees;
+        self.literalIndexes = literalIndexes;
+    }
+
+    return self;
+}
+
+- (instancetype)init
+{
+    return [self initWithResponseDescriptors:@[]];
+}
+
+// Evaluates the candidates of a tree lookup, invoking the block with the index and parsed arguments of each matching descriptor
+- (void)enumerateResponseDescriptorsAtIndexes:(NSIndexSet *)indexes matchingPath:(NSString *)path method:(RKRequestMethod)method usingBlock:(void (^)(NSUInteger idx, NSDictionary *parsedArguments))block
+{
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop) {
+        RKResponseDescriptor *responseDescriptor = self.responseDescriptors[idx];
+        if (! (responseDescriptor.method & method)) return;
+
+        if (! responseDescriptor.pathPattern || ! path) {
+            block(idx, nil);
+        } else if ([self.literalIndexes containsIndex:idx]) {
+            // The tree has already compared every segment of a literal pattern
+            block(idx, @{});
+        } else {
+            NSDictionary *parsedArguments = nil;
+            if ([responseDescriptor matchesPath:path parsedArguments:&parsedArguments]) block(idx, parsedArguments);
+        }
+    }];
+}
+
+- (NSArray *)responseDescriptorsMatchingPath:(NSString *)path method:(RKRequestMethod)method
+{
+    NSMutableIndexSet *matchingIndexes = [NSMutableIndexSet indexSet];
+    for (RKResponseDescriptorIndexTree *tree in self.trees) {
+        [self enumerateResponseDescriptorsAtIndexes:[tree candidateIndexesForPath:path method:method] matchingPath:path method:method usingBlock:^(NSUInteger idx, NSDictionary *parsedArguments) {
+            [matchingIndexes addIndex:idx];
+        }];
+    }
+
+    return [self.responseDescriptors objectsAtIndexes:matchingIndexes];
+}
+
+- (NSArray *)responseDescriptorsMatchingResponse:(NSHTTPURLResponse *)response method:(RKRequestMethod)method parsedArguments:(NSArray **)parsedArguments
+{
+    NSMutableIndexSet *matchingIndexes = [NSMutableIndexSet indexSet];
+    NSMutableDictionary *parsedArgumentsByIndex = [NSMutableDictionary dictionary];
+    for (RKResponseDescriptorIndexTree *tree in self.trees) {
+        if (tree.baseURL && !RKURLIsRelativeToURL(response.URL, tree.baseURL)) continue;
+
+        NSString *path = RKPathAndQueryStringFromURLRelativeToURL(response.URL, tree.baseURL);
+        [self enumerateResponseDescriptorsAtIndexes:[tree candidateIndexesForPath:path method:method] matchingPath:path method:method usingBlock:^(NSUInteger idx, NSDictionary *arguments) {
+            NSIndexSet *statusCodes = [self.responseDescriptors[idx] statusCodes];
+            if (statusCodes && ![statusCodes containsIndex:response.statusCode]) return;
+
+            [matchingIndexes addIndex:idx];
+            parsedArgumentsByIndex[@(idx)] = arguments ?: [NSNull null];
+        }];
+    }
+
+    if (parsedArguments) {
+        NSMutableArray *matchingParsedArguments = [NSMutableArray arrayWithCapacity:[matchingIndexes count]];
+        [matchingIndexes enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop) {
+            [matchingParsedArguments addObject:parsedArgumentsByIndex[@(idx)]];
+        }];
+        *parsedArguments = matchingParsedArguments;
+    }
+
+    return [self.responseDescriptors objectsAtIndexes:matchingIndexes];
+}
+
+@end
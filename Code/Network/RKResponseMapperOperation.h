@@ -21,6 +21,7 @@
 #import "RKMappingOperationDataSource.h"
 #import "RKMapperOperation.h"
 #import "RKMappingResult.h"
+#import "RKResponseDescriptorIndex.h"
 
 #ifdef _COREDATADEFINES_H
 @protocol RKManagedObjectCaching;
@@ -63,6 +64,8 @@
 /**
  Initializes and returns a newly created response mapper operation with the given request, HTTP response, response data, and an array of `RKResponseDescriptor` objects.
  
+ The response descriptors are indexed for the receiver. When mapping many responses with the same response descriptors, create a single `RKResponseDescriptorIndex` and initialize each operation with `initWithRequest:response:data:responseDescriptorIndex:` instead.
+ 
  @param request The request object for which the response was loaded.
  @param response The HTTP response object to be used for object mapping.
  @param data The data loaded for the response body.
@@ -72,7 +75,23 @@
 - (instancetype)initWithRequest:(NSURLRequest *)request
              response:(NSHTTPURLResponse *)response
                  data:(NSData *)data
-  responseDescriptors:(NSArray *)responseDescriptors NS_DESIGNATED_INITIALIZER;
+  responseDescriptors:(NSArray *)responseDescriptors;
+
+/**
+ Initializes and returns a newly created response mapper operation with the given request, HTTP response, response data, and an index of `RKResponseDescriptor` objects.
+ 
+ This is the designated initializer.
+ 
+ @param request The request object for which the response was loaded.
+ @param response The HTTP response object to be used for object mapping.
+ @param data The data loaded for the response body.
+ @param responseDescriptorIndex An index of the `RKResponseDescriptor` objects specifying object mapping configurations that may be applied to the response.
+ @return The receiver, initialized with the response, data, and indexed response descriptor objects.
+ */
+- (instancetype)initWithRequest:(NSURLRequest *)request
+                 response:(NSHTTPURLResponse *)response
+                     data:(NSData *)data
+  responseDescriptorIndex:(RKResponseDescriptorIndex *)responseDescriptorIndex NS_DESIGNATED_INITIALIZER;
 
 ///-----------------------------------------------
 /// @name Accessing HTTP Request and Response Data
@@ -169,6 +188,26 @@
 /// @name Configuring Callbacks
 ///----------------------------
 
+///------------------------------------------
+/// @name Mapping the Response Incrementally
+///------------------------------------------
+
+/**
+ Appends a chunk of the response body to the receiver while the response is still being loaded. The receiver must have been initialized with `nil` data.
+ 
+ If the receiver is capable of incremental mapping (see `mappingIncrementally`), the chunk is fed to an incremental parser and the complete elements of any top-level collections it contains are object mapped on a background queue right away, while the remainder of the response is still arriving. When the operation is eventually started, it waits for the outstanding incremental mapping work, maps the remainder of the response and merges both into the `mappingResult`. Otherwise, the chunk is buffered and the response is deserialized and mapped in its entirety when the operation is started.
+ 
+ Incremental mapping is performed for responses deserialized by `RKNSJSONSerialization` when the matching response descriptors have a `nil` key path (mapping the elements of a root array) or a single key of the root dictionary (mapping the elements of an array value of that key). It is not performed when mapping onto a `targetObject` or when a `willMapDeserializedResponseBlock` has been set, as both require the complete representation. All of the batches and the remainder of the response are mapped with a single mapping operation data source and `@metadata.mapping.collectionIndex` continues across batches. The `mapperDelegate` is sent `mapperWillStartMapping:` and `mapperDidFinishMapping:` once for the response, with the per mapping operation callbacks being sent for each of its elements in between.
+ 
+ @param data The next chunk of the response body. Chunks must be appended serially and in order.
+ */
+- (void)appendResponseData:(NSData *)data;
+
+/**
+ Returns a Boolean value indicating whether the receiver is object mapping its response incrementally, as chunks are appended via `appendResponseData:`.
+ */
+@property (nonatomic, readonly, getter=isMappingIncrementally) BOOL mappingIncrementally;
+
 /**
  Sets a block to be executed before the response mapper operation begins mapping the deserialized response body, providing an opportunity to manipulate the mappable representation input before mapping begins.
  
@@ -197,8 +236,78 @@
  */
 + (void)registerMappingOperationDataSourceClass:(Class<RKMappingOperationDataSource>)dataSourceClass;
 
+///-------------------------------------------
+/// @name Configuring Response Deserialization
+///-------------------------------------------
+
+/**
+ Sets the maximum number of response bodies that may be deserialized concurrently across all response mapper operations.
+ 
+ The limit applies to responses handled by serialization classes that declare themselves thread-safe by returning `YES` from `[RKSerialization supportsConcurrentDeserialization]`. All other responses are deserialized one at a time on a shared serial queue.
+ 
+ **Default:** The number of active processors.
+ 
+ @param count The maximum number of concurrent deserializations. Must be greater than zero.
+ */
++ (void)setMaxConcurrentDeserializationCount:(NSUInteger)count;
+
+/**
+ Returns the maximum number of response bodies that may be deserialized concurrently by thread-safe serialization classes.
+ 
+ @return The maximum number of concurrent deserializations.
+ */
++ (NSUInteger)maxConcurrentDeserializationCount;
+
+/**
+ Returns a snapshot of the metrics collected for the deserialization of response bodies by all response mapper operations, measuring the contention for deserialization.
+ 
+ The keys of the dictionary are described in the "Deserialization Metrics Keys" section below.
+ 
+ @return A dictionary of `NSNumber` objects.
+ */
++ (NSDictionary *)deserializationMetrics;
+
+/**
+ Resets the deserialization metrics.
+ */
++ (void)resetDeserializationMetrics;
+
+/**
+ The time, in seconds, that the receiver waited for its turn to deserialize the response body. Zero if the response has not been deserialized.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval deserializationWaitTime;
+
 @end
 
+///-----------------------------------
+/// @name Deserialization Metrics Keys
+///-----------------------------------
+
+/**
+ The number of response bodies that have been deserialized.
+ */
+extern NSString * const RKDeserializationMetricsCountKey;
+
+/**
+ The number of response bodies that have been deserialized on the shared serial queue because their serialization class is not thread-safe.
+ */
+extern NSString * const RKDeserializationMetricsSerialCountKey;
+
+/**
+ The total time, in seconds, that response mapper operations have spent waiting to deserialize response bodies.
+ */
+extern NSString * const RKDeserializationMetricsTotalWaitTimeKey;
+
+/**
+ The longest time, in seconds, that a response mapper operation has spent waiting to deserialize a response body.
+ */
+extern NSString * const RKDeserializationMetricsMaximumWaitTimeKey;
+
+/**
+ The largest number of response bodies that have been deserialized concurrently by thread-safe serialization classes.
+ */
+extern NSString * const RKDeserializationMetricsPeakConcurrentCountKey;
+
 /**
  `RKObjectResponseMapperOperation` is an `RKResponseMapperOperation` subclass that provides support for performing object mapping for mappings that target `NSObject` derived classes. It does not require a data source to perform its work.
  */
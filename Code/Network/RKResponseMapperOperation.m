@@ -27,6 +27,9 @@
 #import "RKMappingErrors.h"
 #import "RKMIMETypeSerialization.h"
 #import "RKDictionaryUtilities.h"
+#import "RKIncrementalJSONParser.h"
+#import "RKNSJSONSerialization.h"
+#import "RKMapperOperation_Private.h"
 
 #ifdef _COREDATADEFINES_H
 #if __has_include("RKCoreData.h")
@@ -110,8 +113,14 @@ static NSString *RKFailureReasonErrorStringForResponseDescriptorsMismatchWithRes
     return failureReason;
 }
 
+NSString * const RKDeserializationMetricsCountKey = @"count";
+NSString * const RKDeserializationMetricsSerialCountKey = @"serialCount";
+NSString * const RKDeserializationMetricsTotalWaitTimeKey = @"totalWaitTime";
+NSString * const RKDeserializationMetricsMaximumWaitTimeKey = @"maximumWaitTime";
+NSString * const RKDeserializationMetricsPeakConcurrentCountKey = @"peakConcurrentCount";
+
 /**
- A serial dispatch queue used for all deserialization of response bodies
+ A serial dispatch queue used for deserialization of response bodies by serialization classes that are not thread-safe
  */
 static dispatch_queue_t RKResponseMapperSerializationQueue() {
     static dispatch_queue_t serializationQueue;
@@ -123,11 +132,122 @@ static dispatch_queue_t RKResponseMapperSerializationQueue() {
     return serializationQueue;
 }
 
+/**
+ The deserialization pool bounds the number of response bodies that are deserialized concurrently by thread-safe serialization classes. Deserialization is performed on the calling thread once a slot in the pool is available. The pool condition also guards the deserialization metrics.
+ */
+static NSUInteger RKDeserializationPoolMaxConcurrentCount = 0;
+static NSUInteger RKDeserializationPoolActiveCount = 0;
+static NSUInteger RKDeserializationMetricsCount = 0;
+static NSUInteger RKDeserializationMetricsSerialCount = 0;
+static NSUInteger RKDeserializationMetricsPeakConcurrentCount = 0;
+static NSTimeInterval RKDeserializationMetricsTotalWaitTime = 0;
+static NSTimeInterval RKDeserializationMetricsMaximumWaitTime = 0;
+
+static NSCondition *RKDeserializationPoolCondition() {
+    static NSCondition *condition;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        condition = [NSCondition new];
+        [condition setName:@"org.restkit.response-mapper.deserialization-pool"];
+        RKDeserializationPoolMaxConcurrentCount = MAX([[NSProcessInfo processInfo] activeProcessorCount], 1);
+    });
+    
+    return condition;
+}
+
+// NOTE: Must be invoked with the pool condition locked
+static void RKDeserializationMetricsRecordWaitTime(NSTimeInterval waitTime, BOOL serial)
+{
+    RKDeserializationMetricsCount++;
+    if (serial) RKDeserializationMetricsSerialCount++;
+    RKDeserializationMetricsTotalWaitTime += waitTime;
+    RKDeserializationMetricsMaximumWaitTime = MAX(RKDeserializationMetricsMaximumWaitTime, waitTime);
+}
+
+// Blocks until a slot in the pool is available and returns the time spent waiting for it
+static NSTimeInterval RKDeserializationPoolAcquire(void)
+{
+    NSCondition *condition = RKDeserializationPoolCondition();
+    CFAbsoluteTime startTime = CFAbsoluteTimeGetCurrent();
+    [condition lock];
+    while (RKDeserializationPoolActiveCount >= RKDeserializationPoolMaxConcurrentCount) {
+        [condition wait];
+    }
+    RKDeserializationPoolActiveCount++;
+    RKDeserializationMetricsPeakConcurrentCount = MAX(RKDeserializationMetricsPeakConcurrentCount, RKDeserializationPoolActiveCount);
+    NSTimeInterval waitTime = CFAbsoluteTimeGetCurrent() - startTime;
+    RKDeserializationMetricsRecordWaitTime(waitTime, NO);
+    [condition unlock];
+    
+    return waitTime;
+}
+
+static void RKDeserializationPoolRelease(void)
+{
+    NSCondition *condition = RKDeserializationPoolCondition();
+    [condition lock];
+    RKDeserializationPoolActiveCount--;
+    [condition signal];
+    [condition unlock];
+}
+
+// Forwards the delegate callbacks of the mapper operations of an incrementally mapped response, such that the delegate is informed of the start and finish of mapping once per response
+@interface RKIncrementalMapperOperationDelegate : NSObject <RKMapperOperationDelegate>
+@property (nonatomic, weak, readonly) id<RKMapperOperationDelegate> delegate;
+@property (nonatomic, assign) BOOL forwardsMappingCompletion;
+@property (nonatomic, assign) BOOL didStartMapping;
+- (instancetype)initWithDelegate:(id<RKMapperOperationDelegate>)delegate;
+@end
+
+@implementation RKIncrementalMapperOperationDelegate
+
+- (instancetype)initWithDelegate:(id<RKMapperOperationDelegate>)delegate
+{
+    self = [super init];
+    if (self) {
+        _delegate = delegate;
+    }
+    return self;
+}
+
+- (BOOL)respondsToSelector:(SEL)selector
+{
+    if ([self.delegate respondsToSelector:selector]) return YES;
+    if (selector == @selector(mapperWillStartMapping:) || selector == @selector(mapperDidFinishMapping:) || selector == @selector(mapperDidCancelMapping:)) return NO;
+    return [super respondsToSelector:selector];
+}
+
+- (id)forwardingTargetForSelector:(SEL)selector
+{
+    return self.delegate;
+}
+
+- (void)mapperWillStartMapping:(RKMapperOperation *)mapper
+{
+    if (self.didStartMapping) return;
+    self.didStartMapping = YES;
+    [self.delegate mapperWillStartMapping:mapper];
+}
+
+- (void)mapperDidFinishMapping:(RKMapperOperation *)mapper
+{
+    if (self.forwardsMappingCompletion) [self.delegate mapperDidFinishMapping:mapper];
+}
+
+- (void)mapperDidCancelMapping:(RKMapperOperation *)mapper
+{
+    if (self.forwardsMappingCompletion) [self.delegate mapperDidCancelMapping:mapper];
+}
+
+@end
+
 @interface RKResponseMapperOperation ()
 @property (nonatomic, strong, readwrite) NSURLRequest *request;
 @property (nonatomic, strong, readwrite) NSHTTPURLResponse *response;
 @property (nonatomic, strong, readwrite) NSData *data;
 @property (nonatomic, strong, readwrite) NSArray *responseDescriptors;
+@property (nonatomic, strong) RKResponseDescriptorIndex *responseDescriptorIndex;
+@property (nonatomic, strong) NSArray *matchingResponseDescriptorArguments;
 @property (nonatomic, strong, readwrite) RKMappingResult *mappingResult;
 @property (nonatomic, strong, readwrite) NSError *error;
 @property (nonatomic, strong, readwrite) NSArray *matchingResponseDescriptors;
@@ -136,11 +256,22 @@ static dispatch_queue_t RKResponseMapperSerializationQueue() {
 @property (nonatomic, strong) RKMapperOperation *mapperOperation;
 @property (nonatomic, copy) id (^willMapDeserializedResponseBlock)(id);
 @property (nonatomic, copy) void(^didFinishMappingBlock)(RKMappingResult *, NSError *);
+@property (nonatomic, strong) NSMutableData *bufferedData;
+@property (nonatomic, strong) RKIncrementalJSONParser *incrementalParser;
+@property (nonatomic, strong) NSOperationQueue *incrementalMappingQueue;
+@property (nonatomic, strong) NSMutableDictionary *incrementallyMappedObjects;
+@property (nonatomic, strong) NSError *incrementalMappingError;
+@property (nonatomic, strong) id<RKMappingOperationDataSource> incrementalMappingOperationDataSource;
+@property (nonatomic, strong) RKIncrementalMapperOperationDelegate *incrementalMapperDelegate;
+@property (nonatomic, strong) NSMutableDictionary *incrementalCollectionIndexOffsets;
+@property (nonatomic, assign, readwrite) NSTimeInterval deserializationWaitTime;
 @end
 
 @interface RKResponseMapperOperation (ForSubclassEyesOnly)
 - (id)parseResponseData:(NSError **)error;
 - (RKMappingResult *)performMappingWithObject:(id)sourceObject error:(NSError **)error;
+- (BOOL)canMapResponseIncrementally;
+- (NSArray *)mapIncrementalRepresentations:(NSArray *)representations atKeyPath:(id)keyPath error:(NSError **)error;
 @property (NS_NONATOMIC_IOSONLY, readonly) BOOL hasEmptyResponse;
 @end
 
@@ -171,23 +302,79 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
     }
 }
 
+#pragma mark Deserialization Pool
+
++ (void)setMaxConcurrentDeserializationCount:(NSUInteger)count
+{
+    NSParameterAssert(count > 0);
+    NSCondition *condition = RKDeserializationPoolCondition();
+    [condition lock];
+    RKDeserializationPoolMaxConcurrentCount = MAX(count, 1);
+    [condition broadcast];
+    [condition unlock];
+}
+
++ (NSUInteger)maxConcurrentDeserializationCount
+{
+    NSCondition *condition = RKDeserializationPoolCondition();
+    [condition lock];
+    NSUInteger count = RKDeserializationPoolMaxConcurrentCount;
+    [condition unlock];
+    return count;
+}
+
++ (NSDictionary *)deserializationMetrics
+{
+    NSCondition *condition = RKDeserializationPoolCondition();
+    [condition lock];
+    NSDictionary *metrics = @{ RKDeserializationMetricsCountKey: @(RKDeserializationMetricsCount),
+                               RKDeserializationMetricsSerialCountKey: @(RKDeserializationMetricsSerialCount),
+                               RKDeserializationMetricsTotalWaitTimeKey: @(RKDeserializationMetricsTotalWaitTime),
+                               RKDeserializationMetricsMaximumWaitTimeKey: @(RKDeserializationMetricsMaximumWaitTime),
+                               RKDeserializationMetricsPeakConcurrentCountKey: @(RKDeserializationMetricsPeakConcurrentCount) };
+    [condition unlock];
+    return metrics;
+}
+
++ (void)resetDeserializationMetrics
+{
+    NSCondition *condition = RKDeserializationPoolCondition();
+    [condition lock];
+    RKDeserializationMetricsCount = 0;
+    RKDeserializationMetricsSerialCount = 0;
+    RKDeserializationMetricsTotalWaitTime = 0;
+    RKDeserializationMetricsMaximumWaitTime = 0;
+    RKDeserializationMetricsPeakConcurrentCount = RKDeserializationPoolActiveCount;
+    [condition unlock];
+}
+
 #pragma mark 
 
 - (instancetype)initWithRequest:(NSURLRequest *)request
              response:(NSHTTPURLResponse *)response
                  data:(NSData *)data
   responseDescriptors:(NSArray *)responseDescriptors;
+{
+    NSParameterAssert(responseDescriptors);
+    return [self initWithRequest:request response:response data:data responseDescriptorIndex:[RKResponseDescriptorIndex indexWithResponseDescriptors:responseDescriptors]];
+}
+
+- (instancetype)initWithRequest:(NSURLRequest *)request
+                 response:(NSHTTPURLResponse *)response
+                     data:(NSData *)data
+  responseDescriptorIndex:(RKResponseDescriptorIndex *)responseDescriptorIndex
 {
     NSParameterAssert(request);
     NSParameterAssert(response);
-    NSParameterAssert(responseDescriptors);
+    NSParameterAssert(responseDescriptorIndex);
     
     self = [super init];
     if (self) {
         self.request = request;
         self.response = response;
         self.data = data;
-        self.responseDescriptors = responseDescriptors;
+        self.responseDescriptorIndex = responseDescriptorIndex;
+        self.responseDescriptors = responseDescriptorIndex.responseDescriptors;
         self.matchingResponseDescriptors = [self buildMatchingResponseDescriptors];
         self.responseMappingsDictionary = [self buildResponseMappingsDictionary];
         self.responseMappingArgumentsDictionary = [self buildResponseMappingArgumentsDictionary];
@@ -198,14 +385,50 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
     return self;
 }
 
+- (id)deserializeData:(NSData *)data MIMEType:(NSString *)MIMEType error:(NSError **)error
+{
+    Class<RKSerialization> serializationClass = [RKMIMETypeSerialization serializationClassForMIMEType:MIMEType];
+    BOOL supportsConcurrentDeserialization = [(Class)serializationClass respondsToSelector:@selector(supportsConcurrentDeserialization)] && [serializationClass supportsConcurrentDeserialization];
+    if (supportsConcurrentDeserialization) {
+        self.deserializationWaitTime = RKDeserializationPoolAcquire();
+        @try {
+            return [RKMIMETypeSerialization objectFromData:data MIMEType:MIMEType error:error];
+        }
+        @finally {
+            RKDeserializationPoolRelease();
+        }
+    }
+    
+    // Serialization classes that have not declared themselves thread-safe are serialized across all operations
+    __block id object = nil;
+    __block NSError *underlyingError = nil;
+    CFAbsoluteTime enqueueTime = CFAbsoluteTimeGetCurrent();
+    dispatch_sync(RKResponseMapperSerializationQueue(), ^{
+        NSTimeInterval waitTime = CFAbsoluteTimeGetCurrent() - enqueueTime;
+        NSCondition *condition = RKDeserializationPoolCondition();
+        [condition lock];
+        RKDeserializationMetricsRecordWaitTime(waitTime, YES);
+        [condition unlock];
+        self.deserializationWaitTime = waitTime;
+        
+        object = [RKMIMETypeSerialization objectFromData:data MIMEType:MIMEType error:&underlyingError];
+    });
+    if (! object && error) *error = underlyingError;
+    return object;
+}
+
 - (id)parseResponseData:(NSError **)error
 {
     NSString *MIMEType = [self.response MIMEType];
     __block NSError *underlyingError = nil;
     __block id object;
-    dispatch_sync(RKResponseMapperSerializationQueue(), ^{
-        object = [RKMIMETypeSerialization objectFromData:self.data MIMEType:MIMEType error:&underlyingError];
-    });    
+    if (self.incrementalParser) {
+        // The streamed collections have been parsed as they arrived, only the remainder of the document is left
+        [self.incrementalMappingQueue waitUntilAllOperationsAreFinished];
+        object = [self.incrementalParser finishParsing:&underlyingError];
+    } else {
+        object = [self deserializeData:self.data MIMEType:MIMEType error:&underlyingError];
+    }
     if (! object) {
         NSMutableDictionary *userInfo = [NSMutableDictionary dictionary];
         [userInfo setValue:[NSString stringWithFormat:@"Loaded an unprocessable response (%ld) with content type '%@'", (long) self.response.statusCode, MIMEType]
@@ -221,12 +444,124 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
     return object;
 }
 
-- (NSArray *)buildMatchingResponseDescriptors
+#pragma mark - Incremental Mapping
+
+- (BOOL)canMapResponseIncrementally
 {
-    NSIndexSet *indexSet = [self.responseDescriptors indexesOfObjectsPassingTest:^BOOL(RKResponseDescriptor *responseDescriptor, NSUInteger idx, BOOL *stop) {
-        return [responseDescriptor matchesResponse:self.response] && (RKRequestMethodFromString(self.request.HTTPMethod) & responseDescriptor.method);
+    return NO;
+}
+
+- (NSArray *)mapIncrementalRepresentations:(NSArray *)representations atKeyPath:(id)keyPath error:(NSError **)error
+{
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:[NSString stringWithFormat:@"%@ does not support incremental mapping.",
+                                           NSStringFromClass([self class])]
+                                 userInfo:nil];
+}
+
+- (BOOL)isMappingIncrementally
+{
+    return self.incrementalParser != nil;
+}
+
+// Returns the key paths whose collections can be mapped element by element without changing the mapping semantics
+- (NSSet *)incrementalKeyPaths
+{
+    NSArray *keyPaths = [self.responseMappingsDictionary allKeys];
+    
+    // A root mapping sees the entire document, so it can only be streamed when the document is an array
+    if ([keyPaths containsObject:[NSNull null]]) return [NSSet setWithObject:[NSNull null]];
+    
+    NSMutableSet *incrementalKeyPaths = [NSMutableSet set];
+    for (NSString *keyPath in keyPaths) {
+        if (! [keyPath isKindOfClass:[NSString class]] || [keyPath length] == 0 || [keyPath rangeOfString:@"."].location != NSNotFound) continue;
+        
+        // Nested key paths beneath the key are evaluated against the remainder of the document, which will not contain the streamed elements
+        NSString *prefix = [keyPath stringByAppendingString:@"."];
+        BOOL isPrefixOfOtherKeyPath = NO;
+        for (NSString *otherKeyPath in keyPaths) {
+            if ([otherKeyPath isKindOfClass:[NSString class]] && [otherKeyPath hasPrefix:prefix]) {
+                isPrefixOfOtherKeyPath = YES;
+                break;
+            }
+        }
+        if (! isPrefixOfOtherKeyPath) [incrementalKeyPaths addObject:keyPath];
+    }
+    
+    return incrementalKeyPaths;
+}
+
+- (void)setIncrementalMappingErrorIfNeeded:(NSError *)error
+{
+    @synchronized(self) {
+        if (! self.incrementalMappingError) self.incrementalMappingError = error;
+    }
+}
+
+- (void)appendResponseData:(NSData *)data
+{
+    NSAssert(self.data == nil || self.data == self.bufferedData, @"Cannot append response data to a response mapper operation initialized with data");
+    
+    if (! self.incrementalParser && ! self.bufferedData) {
+        NSSet *keyPaths = [self canMapResponseIncrementally] ? [self incrementalKeyPaths] : nil;
+        if ([keyPaths count]) {
+            self.incrementalParser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:keyPaths];
+            self.incrementallyMappedObjects = [NSMutableDictionary dictionary];
+            self.incrementalCollectionIndexOffsets = [NSMutableDictionary dictionary];
+            self.incrementalMappingQueue = [NSOperationQueue new];
+            [self.incrementalMappingQueue setName:[NSString stringWithFormat:@"Incremental Mapping Queue for '%@'", self]];
+            [self.incrementalMappingQueue setMaxConcurrentOperationCount:1];
+        } else {
+            self.bufferedData = [NSMutableData data];
+            self.data = self.bufferedData;
+        }
+    }
+    
+    if (self.bufferedData) {
+        [self.bufferedData appendData:data];
+        return;
+    }
+    
+    // NOTE: A parse error is retained by the parser and reported by `parseResponseData:`
+    NSDictionary *representationsByKeyPath = [self.incrementalParser parseData:data error:nil];
+    [representationsByKeyPath enumerateKeysAndObjectsUsingBlock:^(id keyPath, NSArray *representations, BOOL *stop) {
+        [self.incrementalMappingQueue addOperationWithBlock:^{
+            if ([self isCancelled] || self.incrementalMappingError) return;
+            
+            NSError *error = nil;
+            NSArray *mappedObjects = [self mapIncrementalRepresentations:representations atKeyPath:keyPath error:&error];
+            if (mappedObjects) {
+                NSMutableArray *objects = self.incrementallyMappedObjects[keyPath];
+                if (objects) {
+                    [objects addObjectsFromArray:mappedObjects];
+                } else {
+                    self.incrementallyMappedObjects[keyPath] = [mappedObjects mutableCopy];
+                }
+            } else if (error && error.code != RKMappingErrorNotFound) {
+                [self setIncrementalMappingErrorIfNeeded:error];
+            }
+        }];
     }];
-    return [self.responseDescriptors objectsAtIndexes:indexSet];
+}
+
+- (RKMappingResult *)mappingResultByMergingIncrementallyMappedObjectsWithMappingResult:(RKMappingResult *)mappingResult
+{
+    if ([self.incrementallyMappedObjects count] == 0) return mappingResult;
+    
+    // The remainder of the document contained empty collections in place of the streamed ones
+    NSMutableDictionary *dictionary = mappingResult ? [[mappingResult dictionary] mutableCopy] : [NSMutableDictionary dictionary];
+    [dictionary addEntriesFromDictionary:self.incrementallyMappedObjects];
+    return [[RKMappingResult alloc] initWithDictionary:dictionary];
+}
+
+#pragma mark -
+
+- (NSArray *)buildMatchingResponseDescriptors
+{
+    NSArray *parsedArguments = nil;
+    NSArray *matchingResponseDescriptors = [self.responseDescriptorIndex responseDescriptorsMatchingResponse:self.response method:RKRequestMethodFromString(self.request.HTTPMethod) parsedArguments:&parsedArguments];
+    self.matchingResponseDescriptorArguments = parsedArguments;
+    return matchingResponseDescriptors;
 }
 
 - (NSDictionary *)buildResponseMappingsDictionary
@@ -242,10 +577,11 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
 - (NSDictionary *)buildResponseMappingArgumentsDictionary
 {
     NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSUInteger index = 0;
     for (RKResponseDescriptor *responseDescriptor in self.matchingResponseDescriptors) {
-        
-        NSDictionary *arguments = [responseDescriptor parsedArgumentsFromResponse:self.response];
-        if (arguments)
+        // The arguments were parsed by the index while matching the response descriptors
+        id arguments = self.matchingResponseDescriptorArguments[index++];
+        if (arguments != [NSNull null])
         {
             // We don't add nil keypath at an [NSNull null] key, because that causes a crash later
             // in RKDictionaryByMergingDictionaryWithDictionary
@@ -277,8 +613,10 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
     static NSData *whitespaceData = nil;
     if (! whitespaceData) whitespaceData = [[NSData alloc] initWithBytes:" " length:1];
 
-    NSUInteger length = [self.data length];
-    return (length == 0 || (length == 1 && [self.data isEqualToData:whitespaceData]));
+    // When mapping incrementally, a single byte response can only ever be found in the skeleton
+    NSData *data = self.incrementalParser ? self.incrementalParser.skeletonData : self.data;
+    NSUInteger length = self.incrementalParser ? self.incrementalParser.length : [data length];
+    return (length == 0 || (length == 1 && [data isEqualToData:whitespaceData]));
 }
 
 - (void)setMappingMetadata:(NSDictionary *)mappingMetadata
@@ -300,6 +638,7 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
     
     [super cancel];
     [self.mapperOperation cancel];
+    [self.incrementalMappingQueue cancelAllOperations];
  
     // NOTE: If we are cancelled before being started, then `main` and the `completionBlock` are never executed. We must ensure that we invoke `didFinishMappingBlock`, see Github issue #1494
     if (cancelledBeforeExecution) {
@@ -371,6 +710,17 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
 
     // Object map the response
     self.mappingResult = [self performMappingWithObject:parsedBody error:&error];    
+    if (self.incrementalParser) {
+        if (self.isCancelled) return [self willFinish];
+        if (self.incrementalMappingError) {
+            self.mappingResult = nil;
+            error = self.incrementalMappingError;
+        } else if ([self.incrementallyMappedObjects count] && (self.mappingResult || error.code == RKMappingErrorNotFound)) {
+            // Nothing may be left to map once the streamed collections are stripped, but any other error fails the mapping
+            self.mappingResult = [self mappingResultByMergingIncrementallyMappedObjectsWithMappingResult:self.mappingResult];
+            error = nil;
+        }
+    }
     
     // If the response is a client error return either the mapping error or the mapped result to the caller as the error
     if (isErrorStatusCode) {
@@ -406,13 +756,24 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
 
 @implementation RKObjectResponseMapperOperation
 
-- (RKMappingResult *)performMappingWithObject:(id)sourceObject error:(NSError **)error
+- (id<RKMappingOperationDataSource>)newMappingOperationDataSource
 {
     Class dataSourceClass = RKRegisteredResponseMapperOperationDataSourceClasses[[self class]] ?: [RKObjectMappingOperationDataSource class];
-    id<RKMappingOperationDataSource> dataSource = [dataSourceClass new];
+    return [dataSourceClass new];
+}
+
+- (RKMappingResult *)performMappingWithObject:(id)sourceObject error:(NSError **)error
+{
+    id<RKMappingOperationDataSource> dataSource = self.incrementalMappingOperationDataSource ?: [self newMappingOperationDataSource];
     self.mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:sourceObject mappingsDictionary:self.responseMappingsDictionary];
     self.mapperOperation.mappingOperationDataSource = dataSource;
-    self.mapperOperation.delegate = self.mapperDelegate;
+    if (self.incrementalMapperDelegate) {
+        // The remainder of an incrementally mapped response completes the mapping of the response
+        self.incrementalMapperDelegate.forwardsMappingCompletion = YES;
+        self.mapperOperation.delegate = self.incrementalMapperDelegate;
+    } else {
+        self.mapperOperation.delegate = self.mapperDelegate;
+    }
     self.mapperOperation.metadata = self.mappingMetadata;
     if (NSLocationInRange(self.response.statusCode, RKStatusCodeRangeForClass(RKStatusCodeClassSuccessful))) {
         self.mapperOperation.targetObject = self.targetObject;
@@ -424,6 +785,33 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
     return self.mapperOperation.mappingResult;
 }
 
+- (BOOL)canMapResponseIncrementally
+{
+    // Mapping onto a target object or through a `willMapDeserializedResponseBlock` requires the complete representation
+    if (self.targetObject || self.willMapDeserializedResponseBlock) return NO;
+    
+    return [RKMIMETypeSerialization serializationClassForMIMEType:[self.response MIMEType]] == [RKNSJSONSerialization class];
+}
+
+- (NSArray *)mapIncrementalRepresentations:(NSArray *)representations atKeyPath:(id)keyPath error:(NSError **)error
+{
+    // All batches of the response share a data source and a delegate and are invoked serially on the incremental mapping queue
+    if (! self.incrementalMappingOperationDataSource) self.incrementalMappingOperationDataSource = [self newMappingOperationDataSource];
+    if (! self.incrementalMapperDelegate && self.mapperDelegate) self.incrementalMapperDelegate = [[RKIncrementalMapperOperationDelegate alloc] initWithDelegate:self.mapperDelegate];
+    
+    id representation = [keyPath isEqual:[NSNull null]] ? representations : @{ keyPath: representations };
+    RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:representation mappingsDictionary:@{ keyPath: self.responseMappingsDictionary[keyPath] }];
+    mapperOperation.mappingOperationDataSource = self.incrementalMappingOperationDataSource;
+    mapperOperation.delegate = self.incrementalMapperDelegate;
+    mapperOperation.metadata = self.mappingMetadata;
+    NSUInteger collectionIndexOffset = [self.incrementalCollectionIndexOffsets[keyPath] unsignedIntegerValue];
+    mapperOperation.collectionIndexOffset = collectionIndexOffset;
+    self.incrementalCollectionIndexOffsets[keyPath] = @(collectionIndexOffset + [representations count]);
+    [mapperOperation start];
+    if (error) *error = mapperOperation.error;
+    return [mapperOperation.mappingResult dictionary][keyPath];
+}
+
 @end
 
 #ifdef RKCoreDataIncluded
@@ -505,6 +893,8 @@ static inline NSManagedObjectID *RKObjectIDFromObjectIfManaged(id object)
             RKLogInfo(@"Non-successful status code encountered: performing mapping with nil target object.");
         }
 
+        // Resolve the existing objects for the entire payload with a fetch per entity rather than a fetch per representation
+        [dataSource prefetchManagedObjectsForRepresentation:sourceObject withMappingsDictionary:self.responseMappingsDictionary];
         [self.mapperOperation start];
         blockError = self.mapperOperation.error;
         mappingResult = self.mapperOperation.mappingResult;
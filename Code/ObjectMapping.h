@@ -19,6 +19,7 @@
 //
 
 #import "RKObjectMapping.h"
+#import "RKObjectMappingPlan.h"
 #import "RKAttributeMapping.h"
 #import "RKRelationshipMapping.h"
 #import "RKValueTransformers.h"
@@ -51,6 +51,8 @@
 
  When evaluated, the matchers will invoke `valueForKeyPath:@"gender"` against each dictionary in the array of object representations and apply the appropriate object mapping for each representation. This would return a mapping result containing an array of two objects, one an instance of the `Boy` class and the other an instance of the `Girl` class.
 
+ Consecutively registered matchers that compare the value at the same key path, such as the two matchers above or matchers created with `matcherWithKeyPath:expectedValueMap:`, are combined into a table mapping each expected value to its object mapping. The value at the key path is then read once per representation and the object mapping is selected with a single lookup, regardless of the number of matchers. Predicate, class and block matchers are evaluated in registration order between these tables.
+
  ## HTTP Integration
 
  Dynamic mappings can be used to map HTTP requests and responses by adding them to an `RKRequestDescriptor` or `RKResponseDescriptor` objects.
@@ -26,10 +26,31 @@
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitObjectMapping
 
+// Defined in RKObjectMappingMatcher.m
+NSDictionary *RKObjectMappingMatcherExpectedValueMap(RKObjectMappingMatcher *matcher, NSString **keyPath);
+
+/**
+ A dispatch table standing in for a run of consecutive matchers that compare the value at the same discriminator key path, so that the value is read once and resolved with a single lookup.
+ */
+@interface RKDynamicMappingDispatchTable : NSObject
+@property (nonatomic, copy) NSString *keyPath;
+@property (nonatomic, strong) NSMutableDictionary *valueToObjectMapping;
+@end
+
+@implementation RKDynamicMappingDispatchTable
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p when `%@` in '%@'>", NSStringFromClass([self class]), self, self.keyPath, [self.valueToObjectMapping allKeys]];
+}
+
+@end
+
 @interface RKDynamicMapping ()
 @property (nonatomic, strong) NSMutableArray *mutableMatchers;
 @property (nonatomic, strong) NSArray *possibleObjectMappings;
 @property (nonatomic, copy) RKObjectMapping *(^objectMappingForRepresentationBlock)(id representation);
+@property (nonatomic, copy) NSArray *dispatchSteps; // `RKObjectMappingMatcher` and `RKDynamicMappingDispatchTable` objects, in the order of the matchers
 @end
 
 @implementation RKDynamicMapping
@@ -40,6 +61,7 @@
     if (self) {
         self.mutableMatchers = [NSMutableArray new];
         self.possibleObjectMappings = [NSArray new];
+        self.dispatchSteps = @[];
     }
 
     return self;
@@ -69,6 +91,7 @@
             self.possibleObjectMappings = [self.possibleObjectMappings arrayByAddingObjectsFromArray:newPossibleMappings];
         }
     }
+    [self rebuildDispatchSteps];
 }
 
 - (void)removeMatcher:(RKObjectMappingMatcher *)matcher
@@ -85,9 +108,38 @@
         }
         self.possibleObjectMappings = [mappings copy];
         [self.mutableMatchers removeObject:matcher];
+        [self rebuildDispatchSteps];
     }
 }
 
+/**
+ Collapses each run of consecutive matchers comparing the value at the same key path into a dispatch table. Where several matchers of a run expect the same value, the first one registered takes precedence, as it would when the matchers are evaluated in order. All other matchers are evaluated in order between the tables.
+ */
+- (void)rebuildDispatchSteps
+{
+    NSMutableArray *dispatchSteps = [NSMutableArray arrayWithCapacity:[self.mutableMatchers count]];
+    for (RKObjectMappingMatcher *matcher in self.mutableMatchers) {
+        NSString *keyPath = nil;
+        NSDictionary *valueToObjectMapping = RKObjectMappingMatcherExpectedValueMap(matcher, &keyPath);
+        if (! valueToObjectMapping) {
+            [dispatchSteps addObject:matcher];
+            continue;
+        }
+
+        RKDynamicMappingDispatchTable *dispatchTable = [dispatchSteps lastObject];
+        if (! [dispatchTable isKindOfClass:[RKDynamicMappingDispatchTable class]] || ! [dispatchTable.keyPath isEqualToString:keyPath]) {
+            dispatchTable = [RKDynamicMappingDispatchTable new];
+            dispatchTable.keyPath = keyPath;
+            dispatchTable.valueToObjectMapping = [NSMutableDictionary dictionaryWithCapacity:[valueToObjectMapping count]];
+            [dispatchSteps addObject:dispatchTable];
+        }
+        [valueToObjectMapping enumerateKeysAndObjectsUsingBlock:^(id value, RKObjectMapping *objectMapping, BOOL *stop) {
+            if (! dispatchTable.valueToObjectMapping[value]) dispatchTable.valueToObjectMapping[value] = objectMapping;
+        }];
+    }
+    self.dispatchSteps = dispatchSteps;
+}
+
 - (RKObjectMapping *)objectMappingForRepresentation:(id)representation
 {
     RKObjectMapping *mapping = nil;
@@ -95,10 +147,21 @@
     RKLogTrace(@"Performing dynamic object mapping for object representation: %@", representation);
 
     // Consult the declarative matchers first
-    for (RKObjectMappingMatcher *matcher in self.mutableMatchers) {
-        if ([matcher matches:representation]) {
-            RKLogTrace(@"Found declarative match for matcher: %@.", matcher);
-            return matcher.objectMapping;
+    for (id dispatchStep in self.dispatchSteps) {
+        if ([dispatchStep isKindOfClass:[RKDynamicMappingDispatchTable class]]) {
+            RKDynamicMappingDispatchTable *dispatchTable = dispatchStep;
+            id value = [representation valueForKeyPath:dispatchTable.keyPath];
+            mapping = value ? dispatchTable.valueToObjectMapping[value] : nil;
+            if (mapping) {
+                RKLogTrace(@"Found declarative match for dispatch table: %@.", dispatchTable);
+                return mapping;
+            }
+        } else {
+            RKObjectMappingMatcher *matcher = dispatchStep;
+            if ([matcher matches:representation]) {
+                RKLogTrace(@"Found declarative match for matcher: %@.", matcher);
+                return matcher.objectMapping;
+            }
         }
     }
 
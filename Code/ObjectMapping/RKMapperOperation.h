@@ -72,6 +72,12 @@
 
  Please refer to the documentation accompanying `RKMappingOperation` for more details on metadata mapping.
 
+ ## Concurrent Collection Mapping
+
+ When a collection of representations is mapped with a plain `RKObjectMapping` and the default `RKObjectMappingOperationDataSource`, the representations are independent of one another and the mapper partitions the collection across the available processor cores once the number of representations reaches the `concurrentCollectionMappingThreshold`. Each representation is given its own `@metadata.mapping` object, mapped objects are returned in the order of their representations and errors are reported in the same order as they would be by a serial mapping. Cancellation of the mapper stops the mapping of any representations that have not yet been started.
+
+ Collections are always mapped serially on the calling thread when a `targetObject` is configured, when the mapping is an `RKDynamicMapping` or an `RKEntityMapping`, when a custom data source is in use or when the delegate implements any of the methods for tracking child mapping operations, as these are not guaranteed to be safe for concurrent use.
+
  ## Core Data
 
  `RKMapperOperation` supports mapping to Core Data target entities. To do so, it must be configured with an `RKManagedObjectMappingOperationDataSource` object as the data source.
@@ -150,6 +156,13 @@
  */
 @property (nonatomic, copy) NSDictionary *metadata;
 
+/**
+ The number of representations at or above which a collection is mapped concurrently, if eligible. Please see the above discussion for details about concurrent collection mapping.
+
+ **Default**: `256`. A value of `NSUIntegerMax` disables concurrent collection mapping.
+ */
+@property (nonatomic, assign) NSUInteger concurrentCollectionMappingThreshold;
+
 ///------------------------------
 /// @name Executing the Operation
 ///------------------------------
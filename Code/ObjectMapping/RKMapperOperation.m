@@ -76,6 +76,7 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
 @property (nonatomic, strong) id representation;
 @property (nonatomic, strong, readwrite) NSDictionary *mappingsDictionary;
 @property (nonatomic, strong) NSMutableDictionary *mutableMappingInfo;
+@property (nonatomic, assign) NSUInteger collectionIndexOffset;
 @end
 
 @implementation RKMapperOperation
@@ -87,6 +88,7 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
         self.representation = representation;
         self.mappingsDictionary = mappingsDictionary;
         self.mappingOperationDataSource = [RKObjectMappingOperationDataSource new];
+        self.concurrentCollectionMappingThreshold = 256;
     }
 
     return self;
@@ -223,6 +225,10 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
         }
     }
     
+    if ([self shouldMapRepresentationsConcurrently:objectsToMap usingMapping:mapping]) {
+        return [self mapRepresentationsConcurrently:objectsToMap atKeyPath:keyPath usingMapping:(RKObjectMapping *)mapping];
+    }
+
     RKMapperMetadata *mappingData = [RKMapperMetadata new];
     mappingData.rootKeyPath = keyPath;
     NSDictionary *metadata = @{ @"mapping": mappingData };
@@ -231,7 +237,7 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
     [objectsToMap enumerateObjectsUsingBlock:^(id mappableObject, NSUInteger index, BOOL *stop) {
         id destinationObject = [self objectForRepresentation:mappableObject withMapping:mapping];
         if (destinationObject) {
-            mappingData.collectionIndex = index;
+            mappingData.collectionIndex = self.collectionIndexOffset + index;
             BOOL success = [self mapRepresentation:mappableObject toObject:destinationObject isNew:YES atKeyPath:keyPath usingMapping:mapping metadataList:metadataList];
             if (success) [mappedObjects addObject:destinationObject];
         }
@@ -241,6 +247,75 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
     return mappedObjects;
 }
 
+- (BOOL)shouldMapRepresentationsConcurrently:(id)representations usingMapping:(RKMapping *)mapping
+{
+    if (! [representations isKindOfClass:[NSArray class]] || [representations count] < self.concurrentCollectionMappingThreshold) return NO;
+    if ([[NSProcessInfo processInfo] activeProcessorCount] < 2 || self.targetObject) return NO;
+
+    // Only plain object mappings with the stateless default data source yield independent mapping operations
+    if (! [mapping isMemberOfClass:[RKObjectMapping class]] || ! [self.mappingOperationDataSource isMemberOfClass:[RKObjectMappingOperationDataSource class]]) return NO;
+
+    id delegate = self.delegate;
+    return !([delegate respondsToSelector:@selector(mapper:willStartMappingOperation:forKeyPath:)] ||
+             [delegate respondsToSelector:@selector(mapper:didFinishMappingOperation:forKeyPath:)] ||
+             [delegate respondsToSelector:@selector(mapper:didFailMappingOperation:forKeyPath:withError:)]);
+}
+
+// Maps a collection of independent representations across all processor cores, preserving the order of the results
+- (NSArray *)mapRepresentationsConcurrently:(NSArray *)representations atKeyPath:(NSString *)keyPath usingMapping:(RKObjectMapping *)mapping
+{
+    NSUInteger count = [representations count];
+    NSUInteger chunkCount = MIN(count, [[NSProcessInfo processInfo] activeProcessorCount] * 4);
+    NSUInteger chunkSize = (count + chunkCount - 1) / chunkCount;
+    RKLogDebug(@"Mapping %lu representations at keyPath '%@' concurrently in %lu chunks...", (unsigned long)count, keyPath, (unsigned long)chunkCount);
+
+    __strong id *mappedObjects = (__strong id *)calloc(count, sizeof(id));
+    __strong NSError **mappingErrors = (__strong NSError **)calloc(count, sizeof(NSError *));
+    id<RKMappingOperationDataSource> dataSource = self.mappingOperationDataSource;
+    NSDictionary *userMetadata = self.metadata;
+
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+        NSUInteger end = MIN(count, (chunk + 1) * chunkSize);
+        for (NSUInteger index = chunk * chunkSize; index < end; index++) {
+            if ([self isCancelled]) return;
+
+            @autoreleasepool {
+                id representation = representations[index];
+                id destinationObject = [self objectForRepresentation:representation withMapping:mapping];
+                if (! destinationObject) continue;
+
+                // Each representation is given its own metadata as they are mapped simultaneously
+                RKMapperMetadata *mappingData = [RKMapperMetadata new];
+                mappingData.rootKeyPath = keyPath;
+                mappingData.collectionIndex = self.collectionIndexOffset + index;
+                NSArray *metadataList = [NSArray arrayWithObjects:@{ @"mapping": mappingData }, userMetadata, nil];
+
+                RKMappingOperation *mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:destinationObject mapping:mapping metadataList:metadataList];
+                mappingOperation.dataSource = dataSource;
+                mappingOperation.newDestinationObject = YES;
+                [mappingOperation start];
+                if (mappingOperation.error) {
+                    mappingErrors[index] = mappingOperation.error;
+                } else {
+                    mappedObjects[index] = destinationObject;
+                }
+            }
+        }
+    });
+
+    NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger index = 0; index < count; index++) {
+        if (mappingErrors[index]) [self addError:mappingErrors[index]];
+        if (mappedObjects[index]) [results addObject:mappedObjects[index]];
+        mappingErrors[index] = nil;
+        mappedObjects[index] = nil;
+    }
+    free(mappingErrors);
+    free(mappedObjects);
+
+    return results;
+}
+
 // The workhorse of this entire process. Emits object loading operations
 - (BOOL)mapRepresentation:(id)mappableObject toObject:(id)destinationObject isNew:(BOOL)newDestination atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadataList:(NSArray *)metadataList
 {
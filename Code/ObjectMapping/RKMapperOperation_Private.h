@@ -20,6 +20,9 @@
 
 @interface RKMapperOperation (Private)
 
+// The index of the first representation mapped by the receiver within a collection that is mapped by several operations
+@property (nonatomic, assign) NSUInteger collectionIndexOffset;
+
 - (id)mapRepresentation:(id)mappableObject atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping;
 - (NSArray *)mapRepresentations:(NSArray *)mappableObjects atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping;
 - (BOOL)mapRepresentation:(id)mappableObject toObject:(id)destinationObject isNew:(BOOL)isNew atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadataList:(NSArray *)metadata;
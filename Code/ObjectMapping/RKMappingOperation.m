@@ -32,6 +32,7 @@
 #import "RKObjectUtilities.h"
 #import "RKValueTransformers.h"
 #import "RKDictionaryUtilities.h"
+#import "RKObjectMappingPlan.h"
 
 // Set Logging Component
 #undef RKLogComponent
@@ -44,16 +45,12 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
 /**
  This function ensures that attribute mappings apply cleanly to an `NSMutableDictionary` target class to support mapping to nested keyPaths. See issue #882
  */
-static void RKSetIntermediateDictionaryValuesOnObjectForKeyPath(id object, NSString *keyPath)
+static void RKSetIntermediateDictionaryValuesOnObjectForKeyPaths(id object, NSArray *intermediateKeyPaths)
 {
-    if (! [object isKindOfClass:[NSMutableDictionary class]]) return;
-    NSArray *keyPathComponents = [keyPath componentsSeparatedByString:@"."];
-    if ([keyPathComponents count] > 1) {
-        for (NSUInteger index = 0; index < [keyPathComponents count] - 1; index++) {
-            NSString *intermediateKeyPath = [[keyPathComponents subarrayWithRange:NSMakeRange(0, index + 1)] componentsJoinedByString:@"."];
-            if (! [object valueForKeyPath:intermediateKeyPath]) {
-                [object setValue:[NSMutableDictionary dictionary] forKeyPath:intermediateKeyPath];
-            }
+    if (! [intermediateKeyPaths count] || ! [object isKindOfClass:[NSMutableDictionary class]]) return;
+    for (NSString *intermediateKeyPath in intermediateKeyPaths) {
+        if (! [object valueForKeyPath:intermediateKeyPath]) {
+            [object setValue:[NSMutableDictionary dictionary] forKeyPath:intermediateKeyPath];
         }
     }
 }
@@ -445,10 +442,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 @property (nonatomic, strong) id nestedAttributeSubstitutionValue;
 @property (nonatomic, strong, readwrite) NSError *error;
 @property (nonatomic, strong, readwrite) RKObjectMapping *objectMapping; // The concrete mapping
-@property (nonatomic, strong) NSArray *nestedAttributeMappings;
-@property (nonatomic, strong) NSArray *simpleAttributeMappings;
-@property (nonatomic, strong) NSArray *keyPathAttributeMappings;
-@property (nonatomic, strong) NSArray *relationshipMappings;
+@property (nonatomic, strong) RKObjectMappingPlan *executionPlan;
 @property (nonatomic, strong) RKMappingInfo *mappingInfo;
 @property (nonatomic, getter=isCancelled) BOOL cancelled;
 @property (nonatomic) BOOL collectsMappingInfo;
@@ -563,6 +557,11 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 }
 
 - (BOOL)shouldSetValue:(id *)value forKeyPath:(NSString *)keyPath usingMapping:(RKPropertyMapping *)propertyMapping
+{
+    return [self shouldSetValue:value forKeyPath:keyPath usingMapping:propertyMapping plan:[self.executionPlan planForPropertyMapping:propertyMapping]];
+}
+
+- (BOOL)shouldSetValue:(id *)value forKeyPath:(NSString *)keyPath usingMapping:(RKPropertyMapping *)propertyMapping plan:(RKPropertyMappingPlan *)plan
 {
     if ([self.delegate respondsToSelector:@selector(mappingOperation:shouldSetValue:forKeyPath:usingMapping:)]) {
         return [self.delegate mappingOperation:self shouldSetValue:*value forKeyPath:keyPath usingMapping:propertyMapping];
@@ -573,7 +572,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         return [self validateValue:value atKeyPath:keyPath];
     }
     
-    id currentValue = [self.destinationObject valueForKeyPath:keyPath];
+    id currentValue = plan ? [plan destinationValueOfObject:self.destinationObject] : [self.destinationObject valueForKeyPath:keyPath];
     if (currentValue == [NSNull null]) {
         currentValue = nil;
     }
@@ -609,87 +608,50 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return RKApplyNestingAttributeValueToMappings(self.nestedAttributeSubstitutionKey, self.nestedAttributeSubstitutionValue, propertyMappings);
 }
 
-- (void)cacheMappingsIfNeeded
+- (RKObjectMappingPlan *)executionPlan
 {
-    if (!_nestedAttributeMappings)
-    {
+    if (! _executionPlan) {
         RKObjectMapping *mapping = self.objectMapping;
 
         if (self.nestedAttributeSubstitutionKey == nil) {
-            _relationshipMappings = mapping.relationshipMappings;
-            _nestedAttributeMappings = mapping.attributeMappings;
-            _simpleAttributeMappings = mapping.keyAttributeMappings;
-            _keyPathAttributeMappings = mapping.keyPathAttributeMappings;
-        }
-        else {
-            _nestedAttributeMappings = [self applyNestingToMappings:mapping.attributeMappings];
-            _relationshipMappings = [self applyNestingToMappings:mapping.relationshipMappings];
-            NSMutableArray *simpleList = [[NSMutableArray alloc] initWithCapacity:[_nestedAttributeMappings count]];
-            NSMutableArray *keyPathList = [[NSMutableArray alloc] initWithCapacity:[_nestedAttributeMappings count]];
-            
+            _executionPlan = mapping.executionPlan;
+        } else {
             // The nested substitution may have changed which properties are simple vs keyPath, so we have to
-            // re-check based on the nesting result.
-            for (RKPropertyMapping *mapping in _nestedAttributeMappings) {
-                BOOL isSimple = [mapping.sourceKeyPath rangeOfString:@"." options:NSLiteralSearch].length == 0;
-                NSMutableArray *arrayToAdd = isSimple? simpleList : keyPathList;
-                [arrayToAdd addObject:mapping];
-            }
-            
-            _simpleAttributeMappings = simpleList;
-            _keyPathAttributeMappings = keyPathList;
+            // compile the substituted mappings on their own.
+            NSArray *propertyMappings = [[self applyNestingToMappings:mapping.attributeMappings] arrayByAddingObjectsFromArray:[self applyNestingToMappings:mapping.relationshipMappings]];
+            _executionPlan = [[RKObjectMappingPlan alloc] initWithObjectMapping:mapping propertyMappings:propertyMappings];
         }
     }
-}
-
-- (NSArray *)nestedAttributeMappings
-{
-    [self cacheMappingsIfNeeded];
-    return _nestedAttributeMappings;
-}
-
-- (NSArray *)simpleAttributeMappings
-{
-    [self cacheMappingsIfNeeded];
-    return _simpleAttributeMappings;
-}
-
-- (NSArray *)keyPathAttributeMappings
-{
-    [self cacheMappingsIfNeeded];
-    return _keyPathAttributeMappings;
-}
 
-- (NSArray *)relationshipMappings
-{
-    [self cacheMappingsIfNeeded];
-    return _relationshipMappings;
+    return _executionPlan;
 }
 
-- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue withPropertyMapping:(RKPropertyMapping *)propertyMapping error:(NSError *__autoreleasing *)error
+- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue withPlan:(RKPropertyMappingPlan *)plan error:(NSError *__autoreleasing *)error
 {
     if (! inputValue) {
         *outputValue = nil;
         // We only want to consider the transformation successful and assign nil if the mapping calls for it
-        return propertyMapping.objectMapping.assignsDefaultValueForMissingAttributes;
+        return plan.propertyMapping.objectMapping.assignsDefaultValueForMissingAttributes;
     }
-    Class transformedValueClass = propertyMapping.propertyValueClass ?: [self.objectMapping classForKeyPath:propertyMapping.destinationKeyPath];
+    Class transformedValueClass = plan.transformedValueClass;
     if (! transformedValueClass) {
         *outputValue = inputValue;
         return YES;
     }
-    RKLogTrace(@"Found transformable value at keyPath '%@'. Transforming from class '%@' to '%@'", propertyMapping.sourceKeyPath, NSStringFromClass([inputValue class]), NSStringFromClass(transformedValueClass));
-    BOOL success = [propertyMapping.valueTransformer transformValue:inputValue toValue:outputValue ofClass:transformedValueClass error:error];
-    if (! success) RKLogError(@"Failed transformation of value at keyPath '%@' to representation of type '%@': %@", propertyMapping.sourceKeyPath, transformedValueClass, *error);
+    RKLogTrace(@"Found transformable value at keyPath '%@'. Transforming from class '%@' to '%@'", plan.sourceKeyPath, NSStringFromClass([inputValue class]), NSStringFromClass(transformedValueClass));
+    BOOL success = [plan.valueTransformer transformValue:inputValue toValue:outputValue ofClass:transformedValueClass error:error];
+    if (! success) RKLogError(@"Failed transformation of value at keyPath '%@' to representation of type '%@': %@", plan.sourceKeyPath, transformedValueClass, *error);
     return success;
 }
 
-- (BOOL)applyAttributeMapping:(RKAttributeMapping *)attributeMapping withValue:(id)value
+- (BOOL)applyAttributeMappingPlan:(RKPropertyMappingPlan *)plan withValue:(id)value
 {
     id transformedValue = nil;
     NSError *error = nil;
-    if (! [self transformValue:value toValue:&transformedValue withPropertyMapping:attributeMapping error:&error]) return NO;
+    if (! [self transformValue:value toValue:&transformedValue withPlan:plan error:&error]) return NO;
 
-    NSString *destinationKeyPath = attributeMapping.destinationKeyPath;
+    RKAttributeMapping *attributeMapping = (RKAttributeMapping *)plan.propertyMapping;
+    NSString *destinationKeyPath = plan.destinationKeyPath;
     id destinationObject = self.destinationObject;
     id delegate = self.delegate;
 
@@ -699,23 +661,23 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     RKLogTrace(@"Mapping attribute value keyPath '%@' to '%@'", attributeMapping.sourceKeyPath, destinationKeyPath);
     
     // If we have a nil value for a primitive property, we need to coerce it into a KVC usable value or bail out
-    if (transformedValue == nil && RKPropertyInspectorIsPropertyAtKeyPathOfObjectPrimitive(destinationKeyPath, destinationObject)) {
+    if (transformedValue == nil && [plan isDestinationPrimitiveForObject:destinationObject]) {
         RKLogDebug(@"Detected `nil` value transformation for primitive property at keyPath '%@'", destinationKeyPath);
-        transformedValue = RKPrimitiveValueForNilValueOfClass([self.objectMapping classForKeyPath:destinationKeyPath]);
+        transformedValue = RKPrimitiveValueForNilValueOfClass(plan.destinationClass);
         if (! transformedValue) {
             RKLogTrace(@"Skipped mapping of attribute value from keyPath '%@ to keyPath '%@' -- Unable to transform `nil` into primitive value representation", attributeMapping.sourceKeyPath, destinationKeyPath);
             return NO;
         }
     }
 
-    RKSetIntermediateDictionaryValuesOnObjectForKeyPath(destinationObject, destinationKeyPath);
+    RKSetIntermediateDictionaryValuesOnObjectForKeyPaths(destinationObject, plan.intermediateDestinationKeyPaths);
     
     // Ensure that the value is different
-    if ([self shouldSetValue:&transformedValue forKeyPath:destinationKeyPath usingMapping:attributeMapping]) {
+    if ([self shouldSetValue:&transformedValue forKeyPath:destinationKeyPath usingMapping:attributeMapping plan:plan]) {
         RKLogTrace(@"Mapped attribute value from keyPath '%@' to '%@'. Value: %@", attributeMapping.sourceKeyPath, destinationKeyPath, transformedValue);
         
         if (destinationKeyPath) {
-            [destinationObject setValue:transformedValue forKeyPath:destinationKeyPath];
+            [plan setDestinationValue:transformedValue ofObject:destinationObject];
         } else {
             if ([destinationObject isKindOfClass:[NSMutableDictionary class]] && [transformedValue isKindOfClass:[NSDictionary class]]) {
                 [destinationObject setDictionary:transformedValue];
@@ -739,7 +701,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 }
 
 // Return YES if we mapped any attributes
-- (BOOL)applyAttributeMappings:(NSArray *)attributeMappings
+- (BOOL)applyAttributeMappingPlans:(NSArray *)attributeMappingPlans
 {
     // If we have a nesting substitution value, we have already succeeded
     BOOL appliedMappings = (self.nestedAttributeSubstitutionKey != nil);
@@ -750,18 +712,19 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
     id sourceObject = self.sourceObject;
 
-    for (RKAttributeMapping *attributeMapping in attributeMappings) {
+    for (RKPropertyMappingPlan *plan in attributeMappingPlans) {
         if ([self isCancelled]) return NO;
 
-        NSString *sourceKeyPath = attributeMapping.sourceKeyPath;
-        NSString *destinationKeyPath = attributeMapping.destinationKeyPath;
-        if ([sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName] || [destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) {
+        NSString *sourceKeyPath = plan.sourceKeyPath;
+        NSString *destinationKeyPath = plan.destinationKeyPath;
+        if (plan.isNestingAttribute) {
             RKLogTrace(@"Skipping attribute mapping for special keyPath '%@'", sourceKeyPath);
             continue;
         }
 
-        id value = (sourceKeyPath == nil) ? [sourceObject valueForKey:@"self"] : [self valueForIndexedKeyPath:sourceKeyPath forObject:sourceObject];
-        if ([self applyAttributeMapping:attributeMapping withValue:value]) {
+        RKAttributeMapping *attributeMapping = (RKAttributeMapping *)plan.propertyMapping;
+        id value = (sourceKeyPath == nil) ? [sourceObject valueForKey:@"self"] : [plan sourceValueOfObject:sourceObject];
+        if ([self applyAttributeMappingPlan:plan withValue:value]) {
             appliedMappings = YES;
         } else {
             id delegate = self.delegate;
@@ -787,70 +750,6 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return appliedMappings;
 }
 
-- (id)valueForIndexedKeyPath:(NSString *)keyPath forObject:(id)object
-{
-    //Try default KVC first, if it contains [\d+] then it won't match
-    id value = [object valueForKeyPath:keyPath];
-    if(value != nil){
-        return value;
-    }
-    
-    //Match all [\d+]
-    NSRegularExpression *testExpression = [NSRegularExpression regularExpressionWithPattern: @"\\[(\\d+)\\]" options:0 error:nil];
-    NSArray *matches = [testExpression matchesInString:keyPath
-                                               options:0
-                                                 range:NSMakeRange(0, [keyPath length])];
-    
-    //If no indexes found return nil
-    if(!matches.count){
-        return nil;
-    }
-    
-    value = object;
-    NSUInteger offset = 0;
-    int i = 0;
-    
-    for (NSTextCheckingResult *result in matches) {
-        NSRange range = [result rangeAtIndex:1];
-        
-        NSString *keyPathPart = [keyPath substringWithRange:NSMakeRange(offset, range.location - 1 - offset)];
-        
-        //Set the new offset in case there are more matches
-        offset = range.location + range.length+2; //+2 for ].
-        
-        //Get the regular KVC value
-        value = [value valueForKeyPath:keyPathPart];
-        
-        //If value is not an array, bail out
-        if(![value isKindOfClass:[NSArray class]]){
-            NSLog(@"Key Path %@ contains array access, but value is not an array: %@", keyPath, value);
-            value = nil;
-            break;
-        }
-        
-        //Ensure index exists in array
-        NSArray *array = (NSArray*)value;
-        NSUInteger index = [[keyPath substringWithRange:range] integerValue];
-        if(index >= array.count){
-            NSLog(@"Key Path %@ contains array access to index: %lu but array contains only %lu items. %@", keyPath, (unsigned long)index, (unsigned long)array.count, array);
-            value = nil;
-            break;
-        }
-        
-        //Assign new value as index of array
-        value = array[index];
-        
-        //If this is the last match, attempt to KVC the rest of the key path
-        if(i == matches.count-1){
-            value = [value valueForKeyPath:[keyPath substringWithRange:NSMakeRange(offset, keyPath.length - offset)]];
-        }
-        
-        i++;
-    }
-    
-    return value;
-}
-
 - (BOOL)mapNestedObject:(id)anObject toObject:(id)anotherObject parent:(id)parentSourceObject withRelationshipMapping:(RKRelationshipMapping *)relationshipMapping metadataList:(NSArray *)metadataList
 {
     NSAssert(anObject, @"Cannot map nested object without a nested source object");
@@ -1015,7 +914,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
     id valueForRelationship = nil;
     NSError *error = nil;
-    if (! [self transformValue:relationshipCollection toValue:&valueForRelationship withPropertyMapping:relationshipMapping error:&error]) return NO;
+    if (! [self transformValue:relationshipCollection toValue:&valueForRelationship withPlan:[self.executionPlan planForPropertyMapping:relationshipMapping] error:&error]) return NO;
 
     // If the relationship has changed, set it
     if ([self shouldSetValue:&valueForRelationship forKeyPath:destinationKeyPath usingMapping:relationshipMapping]) {
@@ -1043,9 +942,10 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     id destinationObject = self.destinationObject;
     id delegate = self.delegate;
 
-    for (RKRelationshipMapping *relationshipMapping in [self relationshipMappings]) {
+    for (RKPropertyMappingPlan *plan in self.executionPlan.relationshipPlans) {
         if ([self isCancelled]) return NO;
         
+        RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plan.propertyMapping;
         NSString *sourceKeyPath = relationshipMapping.sourceKeyPath;
         NSString *destinationKeyPath = relationshipMapping.destinationKeyPath;
         id value = nil;
@@ -1085,7 +985,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
         // nil out the property if necessary
         if (value == nil) {
-            Class relationshipClass = [parentObjectMapping classForKeyPath:destinationKeyPath];
+            Class relationshipClass = plan.destinationClass;
             BOOL mappingToCollection = RKClassIsCollection(relationshipClass);
             RKAssignmentPolicy assignmentPolicy = relationshipMapping.assignmentPolicy;
             if (assignmentPolicy == RKUnionAssignmentPolicy && mappingToCollection) {
@@ -1126,7 +1026,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         }
 
         // Handle case where incoming content is a single object, but we want a collection
-        Class relationshipClass = [parentObjectMapping classForKeyPath:destinationKeyPath];
+        Class relationshipClass = plan.destinationClass;
         BOOL mappingToCollection = RKClassIsCollection(relationshipClass);
         BOOL objectIsCollection = RKObjectIsCollection(value);
         if (mappingToCollection && !objectIsCollection) {
@@ -1178,7 +1078,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
             RKLogDebug(@"Found nesting value of '%@' for attribute '%@'", attributeValue, attributeMapping.destinationKeyPath);
             self.nestedAttributeSubstitutionKey = attributeMapping.destinationKeyPath;
             self.nestedAttributeSubstitutionValue = attributeValue;
-            [self applyAttributeMapping:attributeMapping withValue:attributeValue];
+            [self applyAttributeMappingPlan:[objectMapping.executionPlan planForPropertyMapping:attributeMapping] withValue:attributeValue];
         } else {
             RKLogWarning(@"Unable to find nesting value for attribute '%@'", attributeMapping.destinationKeyPath);
         }
@@ -1271,12 +1171,13 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     if (! canSkipMapping) {
         [self applyNestedMappings];
         if ([self isCancelled]) return;
-        BOOL mappedSimpleAttributes = [self applyAttributeMappings:[self simpleAttributeMappings]];
+        RKObjectMappingPlan *executionPlan = self.executionPlan;
+        BOOL mappedSimpleAttributes = [self applyAttributeMappingPlans:executionPlan.simpleAttributePlans];
         if ([self isCancelled]) return;
-        BOOL mappedRelationships = [[self relationshipMappings] count] ? [self applyRelationshipMappings] : NO;
+        BOOL mappedRelationships = [executionPlan.relationshipPlans count] ? [self applyRelationshipMappings] : NO;
         if ([self isCancelled]) return;
         // NOTE: We map key path attributes last to allow you to map across the object graphs for objects created/updated by the relationship mappings
-        BOOL mappedKeyPathAttributes = [self applyAttributeMappings:[self keyPathAttributeMappings]];
+        BOOL mappedKeyPathAttributes = [self applyAttributeMappingPlans:executionPlan.keyPathAttributePlans];
         
         if (!mappedSimpleAttributes && !mappedRelationships && !mappedKeyPathAttributes) {
             // We did not find anything to do
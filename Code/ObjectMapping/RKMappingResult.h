@@ -22,8 +22,10 @@
 
 /**
  The `RKMappingResult` class represents the aggregate object mapping results returned by an `RKMapperOperation` object. The mapping result provides a thin interface on top of an `NSDictionary` and provides convenient interfaces for accessing the mapping results in various representations.
+
+ Mapping results are immutable. The flattened array and set representations are computed the first time they are requested and are shared by subsequent requests, and the count is computed when the result is initialized. Enumerating a mapping result with fast enumeration visits the objects of the flattened array representation, walking the mapped collections directly rather than flattening them first.
  */
-@interface RKMappingResult : NSObject
+@interface RKMappingResult : NSObject <NSFastEnumeration>
 
 ///----------------------------------------
 /// @name Creating a Mapping Result
@@ -44,7 +46,7 @@
 /**
  Returns a representation of the mapping result as a dictionary.
 
- The keys of the returned dictionary will correspond to the mapped key paths in the source object representation and the values will be the mapped objects. The returned value is a copy of the dictionary that was used to initialize the mapping result.
+ The keys of the returned dictionary will correspond to the mapped key paths in the source object representation and the values will be the mapped objects. The returned value is an immutable copy of the dictionary that was used to initialize the mapping result.
 
  @return A dictionary containing the mapping results.
  */
@@ -62,7 +64,7 @@
 /**
  Returns a representation of the mapping result as an array of objects.
 
- The array returned is a flattened collection of all mapped object values contained in the underlying dictionary result representation. No guarantee is made as to the ordering of objects within the returned collection when more than one key path was mapped, as `NSDictionary` objects are unordered,
+ The array returned is a flattened collection of all mapped object values contained in the underlying dictionary result representation. No guarantee is made as to the ordering of objects within the returned collection when more than one key path was mapped, as `NSDictionary` objects are unordered. The array is computed once and the same immutable array is returned by subsequent invocations.
 
  @return An array containing the objects contained in the mapping result.
  */
@@ -71,7 +73,7 @@
 /**
  Returns a representation of the mapping result as a set of objects.
 
- The set returned is a flattened collection of all mapped object values contained in the underlying dictionary result representation.
+ The set returned is a flattened collection of all mapped object values contained in the underlying dictionary result representation. The set is computed once and the same set is returned by subsequent invocations.
 
  @return A set containing the objects contained in the mapping result.
  */
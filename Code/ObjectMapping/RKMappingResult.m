@@ -20,8 +20,21 @@
 
 #import "RKMappingResult.h"
 
+/**
+ Returns `YES` if the given mapped value contributes its members to the flattened representations of a mapping result rather than itself. Mapped dictionaries are not flattened.
+ */
+static BOOL RKMappingResultValueIsFlattened(id value)
+{
+    return (NO == [value isKindOfClass:[NSDictionary class]] && [value respondsToSelector:@selector(allObjects)]);
+}
+
 @interface RKMappingResult ()
 @property (nonatomic, strong) NSDictionary *keyPathToMappedObjects;
+@property (nonatomic, strong) NSArray *mappedValues;
+@property (nonatomic, assign, readwrite) NSUInteger count;
+@property (nonatomic, assign) BOOL enumeratesMappedValuesDirectly; // `YES` when every flattened value is an `NSArray` whose objects can be copied straight into an enumeration buffer
+@property (nonatomic, strong) NSArray *flattenedArray;
+@property (nonatomic, strong) NSSet *flattenedSet;
 @end
 
 @implementation RKMappingResult
@@ -31,7 +44,22 @@
     NSParameterAssert(dictionary);
     self = [self init];
     if (self) {
-        self.keyPathToMappedObjects = dictionary;
+        // The result is immutable, so the flattened representations can be computed once
+        self.keyPathToMappedObjects = [dictionary copy];
+        self.mappedValues = [self.keyPathToMappedObjects allValues];
+
+        NSUInteger count = 0;
+        BOOL enumeratesMappedValuesDirectly = YES;
+        for (id value in self.mappedValues) {
+            if (RKMappingResultValueIsFlattened(value)) {
+                count += [value respondsToSelector:@selector(count)] ? [value count] : [[value allObjects] count];
+                if (! [value isKindOfClass:[NSArray class]]) enumeratesMappedValuesDirectly = NO;
+            } else {
+                count++;
+            }
+        }
+        self.count = count;
+        self.enumeratesMappedValuesDirectly = enumeratesMappedValuesDirectly;
     }
 
     return self;
@@ -39,43 +67,89 @@
 
 - (NSDictionary *)dictionary
 {
-    return [self.keyPathToMappedObjects copy];
+    return self.keyPathToMappedObjects;
 }
 
 - (NSArray *)array
 {
-    // Flatten results down into a single array
-    NSMutableArray *collection = [NSMutableArray array];
-    for (id object in [self.keyPathToMappedObjects allValues]) {
-        // We don't want to strip the keys off of a mapped dictionary result
-        if (NO == [object isKindOfClass:[NSDictionary class]] && [object respondsToSelector:@selector(allObjects)]) {
-            [collection addObjectsFromArray:[object allObjects]];
-        } else {
-            [collection addObject:object];
+    @synchronized(self) {
+        if (! self.flattenedArray) {
+            // Flatten results down into a single array
+            NSMutableArray *collection = [NSMutableArray arrayWithCapacity:self.count];
+            for (id object in self.mappedValues) {
+                // We don't want to strip the keys off of a mapped dictionary result
+                if (RKMappingResultValueIsFlattened(object)) {
+                    [collection addObjectsFromArray:[object allObjects]];
+                } else {
+                    [collection addObject:object];
+                }
+            }
+            self.flattenedArray = [collection copy];
         }
+        return self.flattenedArray;
     }
-
-    return collection;
 }
 
 - (NSSet *)set
 {
-    return [NSSet setWithArray:[self array]];
+    NSArray *array = [self array];
+    @synchronized(self) {
+        if (! self.flattenedSet) self.flattenedSet = [NSSet setWithArray:array];
+        return self.flattenedSet;
+    }
 }
 
 - (id)firstObject
 {
-    return [[self array] firstObject];
+    if (! self.enumeratesMappedValuesDirectly) return [[self array] firstObject];
+
+    for (id value in self.mappedValues) {
+        if (! RKMappingResultValueIsFlattened(value)) return value;
+        if ([value count] > 0) return [value firstObject];
+    }
+    return nil;
 }
 
-- (NSString *)description
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length
 {
-    return [NSString stringWithFormat:@"<%@: %p, results=%@>", NSStringFromClass([self class]), self, self.keyPathToMappedObjects];
+    if (! self.enumeratesMappedValuesDirectly) return [[self array] countByEnumeratingWithState:state objects:buffer count:length];
+
+    // extra[0] holds the index of the current mapped value and extra[1] the offset of the next object within it
+    if (state->state == 0) {
+        state->state = 1;
+        state->mutationsPtr = &state->extra[4];
+        state->extra[0] = 0;
+        state->extra[1] = 0;
+    }
+
+    NSArray *mappedValues = self.mappedValues;
+    NSUInteger valueIndex = state->extra[0];
+    NSUInteger offset = state->extra[1];
+    NSUInteger count = 0;
+    while (count < length && valueIndex < [mappedValues count]) {
+        id value = mappedValues[valueIndex];
+        if (RKMappingResultValueIsFlattened(value)) {
+            NSUInteger objectCount = MIN([value count] - offset, length - count);
+            [(NSArray *)value getObjects:buffer + count range:NSMakeRange(offset, objectCount)];
+            count += objectCount;
+            offset += objectCount;
+            if (offset < [value count]) break;
+        } else {
+            buffer[count++] = value;
+        }
+        valueIndex++;
+        offset = 0;
+    }
+
+    state->extra[0] = valueIndex;
+    state->extra[1] = offset;
+    state->itemsPtr = buffer;
+    return count;
 }
 
-- (NSUInteger)count
+- (NSString *)description
 {
-    return [[self array] count];
+    return [NSString stringWithFormat:@"<%@: %p, results=%@>", NSStringFromClass([self class]), self, self.keyPathToMappedObjects];
 }
 
 @end
@@ -22,7 +22,7 @@
 #import "RKMapping.h"
 #import "RKValueTransformers.h"
 
-@class RKPropertyMapping, RKAttributeMapping, RKRelationshipMapping;
+@class RKPropertyMapping, RKAttributeMapping, RKRelationshipMapping, RKObjectMappingPlan;
 @protocol RKValueTransforming;
 
 /**
@@ -350,6 +350,24 @@
  */
 - (instancetype)inverseMappingWithPropertyMappingsPassingTest:(BOOL (^)(RKPropertyMapping *propertyMapping))predicate;
 
+///------------------------------
+/// @name Compiling the Mapping
+///------------------------------
+
+/**
+ An immutable, precompiled form of the receiver that is used by `RKMappingOperation` to map objects.
+
+ The plan is compiled on first access and shared by all mapping operations performed with the receiver until it is invalidated. Adding or removing property mappings, or changing the `valueTransformer` of the receiver or the `valueTransformer` or `propertyValueClass` of one of its property mappings, invalidates the plan automatically.
+ */
+@property (nonatomic, readonly) RKObjectMappingPlan *executionPlan;
+
+/**
+ Discards the compiled `executionPlan` of the receiver, causing it to be recompiled on next access.
+
+ This method only needs to be invoked after changing state that affects runtime introspection of the `objectClass`, such as adding properties to the class at runtime.
+ */
+- (void)invalidateExecutionPlan;
+
 ///---------------------------------------------------
 /// @name Obtaining Information About the Target Class
 ///---------------------------------------------------
@@ -22,6 +22,7 @@
 #import "RKObjectMapping.h"
 #import "RKRelationshipMapping.h"
 #import "RKPropertyInspector.h"
+#import "RKObjectMappingPlan.h"
 #import "RKLog.h"
 #import "RKAttributeMapping.h"
 #import "RKRelationshipMapping.h"
@@ -115,6 +116,7 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
 
 @property (nonatomic, weak, readonly) NSArray *mappedKeyPaths;
 @property (nonatomic, copy) RKSourceToDesinationKeyTransformationBlock sourceToDestinationKeyTransformationBlock;
+@property (atomic, strong) RKObjectMappingPlan *compiledExecutionPlan;
 @end
 
 @implementation RKObjectMapping
@@ -235,6 +237,29 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
     return _keyPathAttributeMappings;
 }
 
+- (RKObjectMappingPlan *)executionPlan
+{
+    // Concurrent first accesses may each compile a plan. They are equivalent, so the last one to be stored wins.
+    RKObjectMappingPlan *executionPlan = self.compiledExecutionPlan;
+    if (! executionPlan) {
+        executionPlan = [RKObjectMappingPlan planWithObjectMapping:self];
+        self.compiledExecutionPlan = executionPlan;
+    }
+
+    return executionPlan;
+}
+
+- (void)invalidateExecutionPlan
+{
+    self.compiledExecutionPlan = nil;
+}
+
+- (void)setValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    _valueTransformer = valueTransformer;
+    [self invalidateExecutionPlan];
+}
+
 static NSArray *RKAddProperty(NSArray *array, RKPropertyMapping *mapping)
 {
     return (array)? [array arrayByAddingObject:mapping] : @[mapping];
@@ -275,6 +300,7 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
     if (propertyMapping.propertyValueClass == Nil && ![self.objectClass isSubclassOfClass:[NSDictionary class]]) {
         propertyMapping.propertyValueClass = [self classForKeyPath:propertyMapping.destinationKeyPath];
     }
+    [self invalidateExecutionPlan];
 }
 
 - (void)addPropertyMappingsFromArray:(NSArray *)arrayOfPropertyMappings
@@ -366,6 +392,7 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
         self.keyPathAttributeMappings = RKRemoveProperty(self.keyPathAttributeMappings, attributeOrRelationshipMapping);
         [self.propertiesBySourceKeyPath removeObjectForKey:attributeOrRelationshipMapping.sourceKeyPath ?: [NSNull null]];
         [self.propertiesByDestinationKeyPath removeObjectForKey:attributeOrRelationshipMapping.destinationKeyPath];
+        [self invalidateExecutionPlan];
     }
 }
 
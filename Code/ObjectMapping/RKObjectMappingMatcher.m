@@ -53,6 +53,26 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+ Returns the object mappings of a matcher that matches by comparing the value at a key path for equality, keyed by the values they apply to, and sets the key path. Returns `nil` for all other matchers.
+ */
+NSDictionary *RKObjectMappingMatcherExpectedValueMap(RKObjectMappingMatcher *matcher, NSString **keyPath);
+NSDictionary *RKObjectMappingMatcherExpectedValueMap(RKObjectMappingMatcher *matcher, NSString **keyPath)
+{
+    if ([matcher isMemberOfClass:[RKKeyPathObjectMappingMatcher class]]) {
+        RKKeyPathObjectMappingMatcher *keyPathMatcher = (RKKeyPathObjectMappingMatcher *)matcher;
+        if (! [keyPathMatcher.expectedValue conformsToProtocol:@protocol(NSCopying)]) return nil;
+        *keyPath = keyPathMatcher.keyPath;
+        return @{ keyPathMatcher.expectedValue: keyPathMatcher.objectMapping };
+    } else if ([matcher isMemberOfClass:[RKKeyPathValueMapObjectMappingMatcher class]]) {
+        RKKeyPathValueMapObjectMappingMatcher *valueMapMatcher = (RKKeyPathValueMapObjectMappingMatcher *)matcher;
+        *keyPath = valueMapMatcher.keyPath;
+        return valueMapMatcher.valueMap;
+    }
+
+    return nil;
+}
+
 @implementation RKObjectMappingMatcher
 
 + (instancetype)matcherWithKeyPath:(NSString *)keyPath expectedValue:(id)expectedValue objectMapping:(RKObjectMapping *)objectMapping
@@ -0,0 +1,191 @@
+//
+//  RKObjectMappingPlan.h
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "RKValueTransformers.h"
+
+@class RKObjectMapping, RKPropertyMapping, RKAttributeMapping;
+
+/**
+ An `RKPropertyMappingPlan` object holds everything about a single `RKPropertyMapping` that can be resolved ahead of mapping time: its key paths in split form, the class of the destination property, the value transformer that will be applied and, where possible, the accessor implementations of the destination property.
+
+ Property mapping plans are immutable and are created by `RKObjectMappingPlan`.
+ */
+@interface RKPropertyMappingPlan : NSObject
+
+/**
+ The property mapping the receiver was compiled from.
+ */
+@property (nonatomic, strong, readonly) RKPropertyMapping *propertyMapping;
+
+/**
+ The source key path of the property mapping.
+ */
+@property (nonatomic, copy, readonly) NSString *sourceKeyPath;
+
+/**
+ The components of the source key path, split on the `.` character.
+ */
+@property (nonatomic, copy, readonly) NSArray *sourceKeyPathComponents;
+
+/**
+ The source key path parsed into its key path and array index segments if it contains array index subscripts such as `items[0].name`, else `nil`.
+
+ Segments are `NSString` key paths, evaluated with `valueForKeyPath:`, and `NSNumber` indexes into the `NSArray` produced by the preceding segment. The key path `items[0].name` is parsed into `@[ @"items", @0, @"name" ]`.
+ */
+@property (nonatomic, copy, readonly) NSArray *indexedSourceKeyPathSegments;
+
+/**
+ Returns the value at the source key path of the given object.
+
+ Indexed source key paths are evaluated against their pre-parsed segments. If that does not produce a value, or the source key path is not indexed, the source key path is evaluated with `valueForKeyPath:`.
+
+ @param object The source object.
+ @return The value at the source key path, or `nil` if there is none.
+ */
+- (id)sourceValueOfObject:(id)object;
+
+/**
+ The destination key path of the property mapping.
+ */
+@property (nonatomic, copy, readonly) NSString *destinationKeyPath;
+
+/**
+ The key paths of every intermediate object along the destination key path, from the shortest to the longest. For a destination key path of `@"a.b.c"` the intermediate key paths are `@"a"` and `@"a.b"`.
+ */
+@property (nonatomic, copy, readonly) NSArray *intermediateDestinationKeyPaths;
+
+/**
+ The class of the destination property as determined by runtime introspection of the object mapping's `objectClass`.
+ */
+@property (nonatomic, strong, readonly) Class destinationClass;
+
+/**
+ The class that source values are transformed into: the `propertyValueClass` of the property mapping if set, else the `destinationClass`.
+ */
+@property (nonatomic, strong, readonly) Class transformedValueClass;
+
+/**
+ Indicates whether the destination property of the object mapping's `objectClass` is of a primitive (non-object) type.
+ */
+@property (nonatomic, readonly, getter=isDestinationPrimitive) BOOL destinationPrimitive;
+
+/**
+ The value transformer with which source values are transformed into the `transformedValueClass`.
+ */
+@property (nonatomic, strong, readonly) id<RKValueTransforming> valueTransformer;
+
+/**
+ Indicates whether the property mapping targets the special nesting attribute key and is therefore skipped during attribute mapping.
+ */
+@property (nonatomic, readonly, getter=isNestingAttribute) BOOL nestingAttribute;
+
+/**
+ Returns the value of the destination property of the given object, invoking the cached getter implementation when the object is an instance of the compiled class.
+
+ @param object The destination object.
+ @return The value of the destination property.
+ */
+- (id)destinationValueOfObject:(id)object;
+
+/**
+ Sets the value of the destination property of the given object, invoking the cached setter implementation when the object is an instance of the compiled class.
+
+ @param value The value to set.
+ @param object The destination object.
+ */
+- (void)setDestinationValue:(id)value ofObject:(id)object;
+
+/**
+ Returns a Boolean value indicating whether the destination property of the given object is of a primitive type, consulting the compiled answer when the object is an instance of the compiled class.
+
+ @param object The destination object.
+ @return `YES` if the property is of a primitive type, else `NO`.
+ */
+- (BOOL)isDestinationPrimitiveForObject:(id)object;
+
+@end
+
+/**
+ An `RKObjectMappingPlan` object is an immutable, precompiled form of an `RKObjectMapping` that is consumed by `RKMappingOperation`.
+
+ Compiling a plan resolves, once per mapping rather than once per mapped object, the partitioning of property mappings into simple attributes, key path attributes and relationships, the destination class and value transformer of every property and the accessors of simple destination properties. Object mappings compile their plan lazily on first use and discard it whenever a property mapping is added or removed or a value transformer or property value class is changed, so a plan always reflects the current configuration of its mapping.
+
+ Plans are safe to share between threads.
+
+ @see `[RKObjectMapping executionPlan]`
+ */
+@interface RKObjectMappingPlan : NSObject
+
+///--------------------------------
+/// @name Compiling a Plan
+///--------------------------------
+
+/**
+ Compiles a plan for all property mappings of the given object mapping.
+
+ @param objectMapping The object mapping to compile.
+ @return A new plan for the object mapping.
+ */
++ (instancetype)planWithObjectMapping:(RKObjectMapping *)objectMapping;
+
+/**
+ Initializes the receiver by compiling the given property mappings against the `objectClass` of the given object mapping.
+
+ This is the designated initializer. It is used directly when the property mappings differ from those of the object mapping, for example after the substitution of a nesting attribute value.
+
+ @param objectMapping The object mapping whose destination class is to be introspected.
+ @param propertyMappings An array of `RKAttributeMapping` and `RKRelationshipMapping` objects to compile.
+ @return The receiver, initialized with the compiled property mappings.
+ */
+- (instancetype)initWithObjectMapping:(RKObjectMapping *)objectMapping propertyMappings:(NSArray *)propertyMappings NS_DESIGNATED_INITIALIZER;
+
+///--------------------------------
+/// @name Accessing the Plan
+///--------------------------------
+
+/**
+ The destination class the receiver was compiled for.
+ */
+@property (nonatomic, strong, readonly) Class objectClass;
+
+/**
+ The plans of the attribute mappings whose source key path consists of a single key, in the order they were added to the mapping.
+ */
+@property (nonatomic, copy, readonly) NSArray *simpleAttributePlans;
+
+/**
+ The plans of the attribute mappings whose source key path traverses more than one key, in the order they were added to the mapping.
+ */
+@property (nonatomic, copy, readonly) NSArray *keyPathAttributePlans;
+
+/**
+ The plans of the relationship mappings, in the order they were added to the mapping.
+ */
+@property (nonatomic, copy, readonly) NSArray *relationshipPlans;
+
+/**
+ Returns the plan compiled for the given property mapping.
+
+ @param propertyMapping A property mapping compiled into the receiver.
+ @return The plan for the property mapping, or `nil` if it was not compiled into the receiver.
+ */
+- (RKPropertyMappingPlan *)planForPropertyMapping:(RKPropertyMapping *)propertyMapping;
+
+@end
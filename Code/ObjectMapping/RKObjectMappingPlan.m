@@ -0,0 +1,303 @@
+//
+//  RKObjectMappingPlan.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <objc/runtime.h>
+#import "RKObjectMappingPlan.h"
+#import "RKObjectMapping.h"
+#import "RKAttributeMapping.h"
+#import "RKRelationshipMapping.h"
+#import "RKPropertyInspector.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitObjectMapping
+
+extern NSString * const RKObjectMappingNestingAttributeKeyName;
+
+typedef id (*RKGetterIMP)(id, SEL);
+typedef void (*RKSetterIMP)(id, SEL, id);
+
+static BOOL RKClassIsManagedObjectClass(Class objectClass)
+{
+    Class managedObjectClass = NSClassFromString(@"NSManagedObject");
+    return managedObjectClass && [objectClass isSubclassOfClass:managedObjectClass];
+}
+
+/**
+ Parses a key path containing array index subscripts into key path and index segments, i.e. `foo[1].bar[0].url` into `@[ @"foo", @1, @"bar", @0, @"url" ]`. Returns `nil` if the key path does not contain any index.
+ */
+static NSArray *RKIndexedKeyPathSegmentsFromKeyPath(NSString *keyPath)
+{
+    NSUInteger length = [keyPath length];
+    if (length == 0 || [keyPath rangeOfString:@"[" options:NSLiteralSearch].length == 0) return nil;
+
+    NSMutableArray *segments = [NSMutableArray array];
+    NSUInteger segmentStart = 0;
+    NSUInteger location = 0;
+    while (location < length) {
+        if ([keyPath characterAtIndex:location] != '[') {
+            location++;
+            continue;
+        }
+
+        // Only a run of decimal digits closed by a bracket is an index, anything else is part of the key
+        NSUInteger cursor = location + 1;
+        NSUInteger index = 0;
+        while (cursor < length && [keyPath characterAtIndex:cursor] >= '0' && [keyPath characterAtIndex:cursor] <= '9') {
+            index = index * 10 + ([keyPath characterAtIndex:cursor] - '0');
+            cursor++;
+        }
+        if (cursor == location + 1 || cursor >= length || [keyPath characterAtIndex:cursor] != ']') {
+            location++;
+            continue;
+        }
+
+        NSString *keySegment = [keyPath substringWithRange:NSMakeRange(segmentStart, location - segmentStart)];
+        if ([keySegment hasPrefix:@"."]) keySegment = [keySegment substringFromIndex:1];
+        if ([keySegment length]) [segments addObject:keySegment];
+        [segments addObject:@(index)];
+        location = segmentStart = cursor + 1;
+    }
+    if (! [segments count]) return nil;
+
+    NSString *remainder = [keyPath substringFromIndex:segmentStart];
+    if ([remainder hasPrefix:@"."]) remainder = [remainder substringFromIndex:1];
+    if ([remainder length]) [segments addObject:remainder];
+
+    return segments;
+}
+
+// Returns YES if the method exists and the given type encoding of its argument or return value is an object
+static BOOL RKMethodTypeIsObject(Method method, BOOL returnType)
+{
+    if (! method) return NO;
+    char *type = returnType ? method_copyReturnType(method) : method_copyArgumentType(method, 2);
+    BOOL isObject = (type && type[0] == '@');
+    free(type);
+    return isObject;
+}
+
+@interface RKPropertyMappingPlan ()
+@property (nonatomic, strong, readwrite) RKPropertyMapping *propertyMapping;
+@property (nonatomic, copy, readwrite) NSString *sourceKeyPath;
+@property (nonatomic, copy, readwrite) NSArray *sourceKeyPathComponents;
+@property (nonatomic, copy, readwrite) NSArray *indexedSourceKeyPathSegments;
+@property (nonatomic, copy, readwrite) NSString *destinationKeyPath;
+@property (nonatomic, copy, readwrite) NSArray *intermediateDestinationKeyPaths;
+@property (nonatomic, strong, readwrite) Class destinationClass;
+@property (nonatomic, strong, readwrite) Class transformedValueClass;
+@property (nonatomic, readwrite, getter=isDestinationPrimitive) BOOL destinationPrimitive;
+@property (nonatomic, strong, readwrite) id<RKValueTransforming> valueTransformer;
+@property (nonatomic, readwrite, getter=isNestingAttribute) BOOL nestingAttribute;
+@property (nonatomic, strong) Class objectClass;
+@property (nonatomic, assign) BOOL usesCompiledIntrospection;
+@end
+
+@implementation RKPropertyMappingPlan {
+    SEL _getter;
+    SEL _setter;
+    RKGetterIMP _getterIMP;
+    RKSetterIMP _setterIMP;
+}
+
+- (instancetype)initWithPropertyMapping:(RKPropertyMapping *)propertyMapping objectMapping:(RKObjectMapping *)objectMapping
+{
+    self = [super init];
+    if (self) {
+        self.propertyMapping = propertyMapping;
+        self.sourceKeyPath = propertyMapping.sourceKeyPath;
+        self.sourceKeyPathComponents = [propertyMapping.sourceKeyPath componentsSeparatedByString:@"."];
+        self.indexedSourceKeyPathSegments = RKIndexedKeyPathSegmentsFromKeyPath(propertyMapping.sourceKeyPath);
+        self.destinationKeyPath = propertyMapping.destinationKeyPath;
+        self.nestingAttribute = ([propertyMapping.sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName] ||
+                                 [propertyMapping.destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]);
+        self.valueTransformer = propertyMapping.valueTransformer;
+        self.objectClass = objectMapping.objectClass;
+
+        NSArray *destinationKeyPathComponents = [propertyMapping.destinationKeyPath componentsSeparatedByString:@"."];
+        NSMutableArray *intermediateKeyPaths = [NSMutableArray array];
+        for (NSUInteger index = 1; index < [destinationKeyPathComponents count]; index++) {
+            [intermediateKeyPaths addObject:[[destinationKeyPathComponents subarrayWithRange:NSMakeRange(0, index)] componentsJoinedByString:@"."]];
+        }
+        self.intermediateDestinationKeyPaths = intermediateKeyPaths;
+
+        self.destinationClass = [objectMapping classForKeyPath:propertyMapping.destinationKeyPath];
+        self.transformedValueClass = propertyMapping.propertyValueClass ?: self.destinationClass;
+        [self compileIntrospectionForClass:objectMapping.objectClass keyPathComponents:destinationKeyPathComponents];
+    }
+
+    return self;
+}
+
+- (void)compileIntrospectionForClass:(Class)objectClass keyPathComponents:(NSArray *)keyPathComponents
+{
+    // Managed objects are introspected via their entity and dictionaries are not introspectable, so both fall back to KVC
+    if (! objectClass || ! self.destinationKeyPath || RKClassIsManagedObjectClass(objectClass) || [objectClass isSubclassOfClass:[NSDictionary class]]) return;
+
+    BOOL isPrimitive = NO;
+    RKPropertyInspector *inspector = [RKPropertyInspector sharedInspector];
+    Class propertyClass = objectClass;
+    for (NSString *property in keyPathComponents) {
+        propertyClass = [inspector classForPropertyNamed:property ofClass:propertyClass isPrimitive:&isPrimitive];
+        if (! propertyClass) break;
+    }
+    self.destinationPrimitive = isPrimitive;
+    self.usesCompiledIntrospection = YES;
+
+    // Only object valued properties of the destination class itself can bypass KVC
+    if ([keyPathComponents count] != 1 || isPrimitive || ! propertyClass) return;
+    NSString *key = self.destinationKeyPath;
+    if ([key length] == 0) return;
+    NSString *capitalizedKey = [[[key substringToIndex:1] uppercaseString] stringByAppendingString:[key substringFromIndex:1]];
+
+    // Mirror the accessor search order of `setValue:forKey:` and `valueForKey:`
+    SEL setter = NSSelectorFromString([NSString stringWithFormat:@"set%@:", capitalizedKey]);
+    if (RKMethodTypeIsObject(class_getInstanceMethod(objectClass, setter), NO)) {
+        _setter = setter;
+        _setterIMP = (RKSetterIMP)class_getMethodImplementation(objectClass, setter);
+    }
+    SEL getter = NSSelectorFromString(key);
+    if (! [objectClass instancesRespondToSelector:NSSelectorFromString([NSString stringWithFormat:@"get%@", capitalizedKey])] &&
+        RKMethodTypeIsObject(class_getInstanceMethod(objectClass, getter), YES)) {
+        _getter = getter;
+        _getterIMP = (RKGetterIMP)class_getMethodImplementation(objectClass, getter);
+    }
+}
+
+- (id)sourceValueOfObject:(id)object
+{
+    NSArray *segments = self.indexedSourceKeyPathSegments;
+    if (! segments) return [object valueForKeyPath:self.sourceKeyPath];
+
+    id value = object;
+    for (id segment in segments) {
+        if (! [segment isKindOfClass:[NSNumber class]]) {
+            value = [value valueForKeyPath:segment];
+            if (! value) break;
+            continue;
+        }
+
+        if (! [value isKindOfClass:[NSArray class]]) {
+            RKLogDebug(@"Key path '%@' contains array access, but value is not an array: %@", self.sourceKeyPath, value);
+            value = nil;
+            break;
+        }
+        NSUInteger index = [segment unsignedIntegerValue];
+        if (index >= [value count]) {
+            RKLogDebug(@"Key path '%@' contains array access to index %lu, but array contains only %lu items", self.sourceKeyPath, (unsigned long)index, (unsigned long)[value count]);
+            value = nil;
+            break;
+        }
+        value = [value objectAtIndex:index];
+    }
+
+    // Fall back to plain KVC in case the subscripts are part of a literal key
+    return value ?: [object valueForKeyPath:self.sourceKeyPath];
+}
+
+- (id)destinationValueOfObject:(id)object
+{
+    // Objects observed via KVO have an isa-swizzled class and must go through KVC to emit change notifications
+    if (_getterIMP && object_getClass(object) == _objectClass) return _getterIMP(object, _getter);
+    return [object valueForKeyPath:self.destinationKeyPath];
+}
+
+- (void)setDestinationValue:(id)value ofObject:(id)object
+{
+    if (_setterIMP && object_getClass(object) == _objectClass) {
+        _setterIMP(object, _setter, value);
+    } else {
+        [object setValue:value forKeyPath:self.destinationKeyPath];
+    }
+}
+
+- (BOOL)isDestinationPrimitiveForObject:(id)object
+{
+    if (self.usesCompiledIntrospection && [object class] == _objectClass) return self.destinationPrimitive;
+    return RKPropertyInspectorIsPropertyAtKeyPathOfObjectPrimitive(self.destinationKeyPath, object);
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p %@ => %@ (%@)>", [self class], self, self.sourceKeyPath, self.destinationKeyPath, NSStringFromClass(self.transformedValueClass)];
+}
+
+@end
+
+@interface RKObjectMappingPlan ()
+@property (nonatomic, strong, readwrite) Class objectClass;
+@property (nonatomic, copy, readwrite) NSArray *simpleAttributePlans;
+@property (nonatomic, copy, readwrite) NSArray *keyPathAttributePlans;
+@property (nonatomic, copy, readwrite) NSArray *relationshipPlans;
+@property (nonatomic, strong) NSMapTable *plansByPropertyMapping;
+@end
+
+@implementation RKObjectMappingPlan
+
++ (instancetype)planWithObjectMapping:(RKObjectMapping *)objectMapping
+{
+    return [[self alloc] initWithObjectMapping:objectMapping propertyMappings:objectMapping.propertyMappings];
+}
+
+- (instancetype)initWithObjectMapping:(RKObjectMapping *)objectMapping propertyMappings:(NSArray *)propertyMappings
+{
+    self = [super init];
+    if (self) {
+        self.objectClass = objectMapping.objectClass;
+        self.plansByPropertyMapping = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+
+        NSMutableArray *simpleAttributePlans = [NSMutableArray arrayWithCapacity:[propertyMappings count]];
+        NSMutableArray *keyPathAttributePlans = [NSMutableArray array];
+        NSMutableArray *relationshipPlans = [NSMutableArray array];
+        for (RKPropertyMapping *propertyMapping in propertyMappings) {
+            RKPropertyMappingPlan *plan = [[RKPropertyMappingPlan alloc] initWithPropertyMapping:propertyMapping objectMapping:objectMapping];
+            [self.plansByPropertyMapping setObject:plan forKey:propertyMapping];
+            if ([propertyMapping isMemberOfClass:[RKRelationshipMapping class]]) {
+                [relationshipPlans addObject:plan];
+            } else if ([propertyMapping isMemberOfClass:[RKAttributeMapping class]]) {
+                BOOL isSimple = [propertyMapping.sourceKeyPath rangeOfString:@"." options:NSLiteralSearch].length == 0;
+                [(isSimple ? simpleAttributePlans : keyPathAttributePlans) addObject:plan];
+            }
+        }
+        self.simpleAttributePlans = simpleAttributePlans;
+        self.keyPathAttributePlans = keyPathAttributePlans;
+        self.relationshipPlans = relationshipPlans;
+    }
+
+    return self;
+}
+
+- (instancetype)init
+{
+    return [self initWithObjectMapping:nil propertyMappings:nil];
+}
+
+- (RKPropertyMappingPlan *)planForPropertyMapping:(RKPropertyMapping *)propertyMapping
+{
+    return propertyMapping ? [self.plansByPropertyMapping objectForKey:propertyMapping] : nil;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p objectClass=%@ simpleAttributePlans=%@ keyPathAttributePlans=%@ relationshipPlans=%@>",
+            [self class], self, NSStringFromClass(self.objectClass), self.simpleAttributePlans, self.keyPathAttributePlans, self.relationshipPlans];
+}
+
+@end
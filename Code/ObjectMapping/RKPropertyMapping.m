@@ -39,6 +39,8 @@ static NSString *RKStringByReplacingUnderscoresWithBraces(NSString *string)
 
 @implementation RKPropertyMapping
 
+@synthesize valueTransformer = _valueTransformer;
+
 - (id)copyWithZone:(NSZone *)zone
 {
     RKPropertyMapping *copy = [[[self class] allocWithZone:zone] init];
@@ -74,4 +76,16 @@ static NSString *RKStringByReplacingUnderscoresWithBraces(NSString *string)
     return _valueTransformer ?: [self.objectMapping valueTransformer];
 }
 
+- (void)setValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    _valueTransformer = valueTransformer;
+    [self.objectMapping invalidateExecutionPlan];
+}
+
+- (void)setPropertyValueClass:(Class)propertyValueClass
+{
+    _propertyValueClass = propertyValueClass;
+    [self.objectMapping invalidateExecutionPlan];
+}
+
 @end
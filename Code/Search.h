@@ -22,5 +22,7 @@
 
 #ifdef _COREDATADEFINES_H
 #import "RKSearchIndexer.h"
+#import "RKSearchPrefixIndex.h"
+#import "RKSearchRankingIndex.h"
 #import "RKManagedObjectStore+RKSearchAdditions.h"
 #endif
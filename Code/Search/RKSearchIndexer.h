@@ -121,12 +121,45 @@ extern NSString * const RKSearchableAttributeNamesUserInfoKey;
 /**
  Tells the receiver to index a given managed object instance.
 
+ Unless the delegate implements `searchIndexer:searchWordForWord:inManagedObjectContext:error:`, the receiver resolves the words of the object to existing `RKSearchWord` objects using a search word table that maps each word to the object ID of its search word. The table is loaded with a single fetch the first time an object is indexed in a given managed object context and is kept up to date as search words are inserted and saved, so that subsequent words are resolved without executing any fetch requests. The table is discarded when the context is deallocated.
+
+ Indexing an object that has already been indexed does not replace its `searchWords` relationship. The words of the object are compared against its current search words and only the words that were added or removed are linked or unlinked, so the search words that are unchanged are not modified by the subsequent save. When indexing the changed objects of a context with `indexChangedObjectsInManagedObjectContext:waitUntilFinished:`, only the searchable attributes with changed values are tokenized.
+
  @param managedObject The managed object that is to be indexed.
  @return A count of the number of search words that were indexed from the given object's searchable attributes.
  @raises `NSInvalidArgumentException` Raised if the given managed object is not for a searchable entity.
  */
 - (NSUInteger)indexManagedObject:(NSManagedObject *)managedObject;
 
+///------------------------------------
+/// @name Reindexing a Persistent Store
+///------------------------------------
+
+/**
+ Builds the search index for all of the existing objects of the given searchable entities in a persistent store, indexing the objects in parallel. This method blocks the current thread until the reindexing has completed, failed or been stopped.
+
+ The object ID's of each entity are sorted and divided into partitions of `batchSize` consecutive objects. The partitions are indexed by worker contexts with the `NSPrivateQueueConcurrencyType`, one for each active processor, that are connected directly to the given persistent store coordinator. Each worker fetches the objects of a partition with their search words prefetched, indexes them, saves and resets itself before taking the next partition, so the memory used by the reindexing is bounded by the batch size rather than by the size of the store. Search words inserted by workers indexing concurrently are merged once all partitions have been indexed.
+
+ When a checkpoint URL is given, the ranges of object ID's that have been indexed and saved are written to it after each partition. Reindexing the same persistent store with the same checkpoint URL after an interruption skips the objects within those ranges. The checkpoint is removed once the reindexing has completed successfully. Objects inserted into the store after the reindexing has started are expected to be indexed as they are saved, for example by a context observed with `startObservingManagedObjectContext:`.
+
+ The delegate is consulted with `searchIndexer:shouldIndexManagedObject:` and notified with `searchIndexer:didIndexManagedObject:` for each object, from the queue of the worker context that is indexing it. Changes saved by the workers are not merged into other managed object contexts by the receiver.
+
+ @param entities An array of `NSEntityDescription` objects for the searchable entities to reindex, or `nil` to reindex all searchable entities of the managed object model of the persistent store coordinator. Objects of subentities are only reindexed if their entities are searchable.
+ @param persistentStoreCoordinator The persistent store coordinator of the persistent store to reindex. Cannot be `nil`.
+ @param batchSize The number of objects indexed by a worker context between saves, or `0` to use the default batch size of 500 objects.
+ @param checkpointURL A file URL at which to persist the progress of the reindexing, or `nil` if the reindexing is not to be resumable.
+ @param progressBlock A block to be invoked after each partition has been indexed and saved. The block has no return value and takes three arguments: the number of objects that have been indexed, including those skipped because of a checkpoint, the total number of objects to index and a pointer to a Boolean value that can be set to `YES` to stop the reindexing. The block is invoked serially on an arbitrary thread. Pass `nil` if you do not need progress updates.
+ @param error A pointer to an error object that is set if the reindexing failed or was stopped. A stopped reindexing results in an error in the `RKErrorDomain` with the code `RKOperationCancelledError`.
+ @return `YES` if all of the objects were indexed successfully, else `NO`.
+ @raises `NSInvalidArgumentException` Raised if one of the given entities is not searchable.
+ */
+- (BOOL)reindexEntities:(NSArray *)entities
+inPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator
+              batchSize:(NSUInteger)batchSize
+          checkpointURL:(NSURL *)checkpointURL
+          progressBlock:(void (^)(NSUInteger indexedObjectCount, NSUInteger totalObjectCount, BOOL *stop))progressBlock
+                  error:(NSError **)error;
+
 ///-----------------------------------
 /// @name Managing Indexing Operations
 ///-----------------------------------
@@ -165,7 +198,7 @@ extern NSString * const RKSearchableAttributeNamesUserInfoKey;
 /**
  Asks the delegate for an existing search word object for a given word in the managed object context being indexed. If no search word is found for the given word, then `nil` is to be returned.
  
- By default, the search indexer creates and executes a fetch request against the context being indexed for each word during indexing. For large data-sets, this can wind up taking a significant amount of time. By providing an implementation of `searchIndexer:searchWordForWord:inManagedObjectContext:error:`, the delegate can be used to implement a caching scheme to reduce the overhead associated with the execution of these fetch requests.
+ By default, the search indexer resolves each word against a table of the existing search words that is loaded once for the context being indexed (see `indexManagedObject:`). By providing an implementation of `searchIndexer:searchWordForWord:inManagedObjectContext:error:`, the delegate can replace this lookup with an alternate retrieval scheme. The search word table is not consulted or maintained for delegates implementing this method.
  
  @param searchIndexer The search indexer object performing the indexing.
  @param word The search word for which to retrieve an existing
@@ -25,6 +25,7 @@
 #import "RKStringTokenizer.h"
 #import "NSManagedObjectContext+RKAdditions.h"
 #import "RKObjectUtilities.h"
+#import "RKErrors.h"
 
 // Set Logging Component
 #undef RKLogComponent
@@ -32,9 +33,138 @@
 
 NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttributes";
 
+static NSString * const RKSearchWordObjectIDExpressionName = @"objectID";
+
+/**
+ Returns the strings to be tokenized for the value of a searchable attribute. Collections contribute each of their string and number members, numbers are converted to their string value and any other values are ignored.
+ */
+NSArray *RKSearchableStringsFromAttributeValue(id attributeValue);
+NSArray *RKSearchableStringsFromAttributeValue(id attributeValue)
+{
+    id collectionOfStrings = RKObjectIsCollection(attributeValue) ? attributeValue : (attributeValue ? @[attributeValue] : @[]);
+    NSMutableArray *strings = [NSMutableArray arrayWithCapacity:[collectionOfStrings count]];
+    for (id object in collectionOfStrings) {
+        if ([object isKindOfClass:[NSString class]]) {
+            [strings addObject:object];
+        } else if ([object isKindOfClass:[NSNumber class]]) {
+            [strings addObject:[(NSNumber *)object stringValue]];
+        }
+    }
+    return strings;
+}
+
+/**
+ Returns the search word registered for the given word in a search word table, faulting it into the given context if necessary. Entries whose search word no longer exists are evicted from the table.
+ */
+static RKSearchWord *RKSearchWordFromSearchWordTable(NSMutableDictionary *searchWordTable, NSString *word, NSManagedObjectContext *managedObjectContext)
+{
+    NSManagedObjectID *objectID = searchWordTable[word];
+    if (! objectID) return nil;
+
+    NSError *error = nil;
+    RKSearchWord *searchWord = (RKSearchWord *)[managedObjectContext existingObjectWithID:objectID error:&error];
+    if (! searchWord || [searchWord isDeleted]) {
+        RKLogTrace(@"Search word '%@' is no longer available in managed object context %@: evicting from search word table.", word, managedObjectContext);
+        [searchWordTable removeObjectForKey:word];
+        return nil;
+    }
+
+    return searchWord;
+}
+
+/**
+ Adds the words of the searchable strings of each of the given attribute values to a set.
+ */
+static void RKAddSearchableWordsFromAttributeValues(NSMutableSet *words, NSDictionary *attributeValues, RKStringTokenizer *stringTokenizer)
+{
+    for (id attributeValue in [attributeValues objectEnumerator]) {
+        for (NSString *string in RKSearchableStringsFromAttributeValue(attributeValue)) {
+            [stringTokenizer tokenizeString:string intoSet:words];
+        }
+    }
+}
+
+static NSUInteger const RKSearchIndexerDefaultReindexingBatchSize = 500;
+static NSString * const RKSearchIndexerCheckpointStoreIdentifiersKey = @"storeIdentifiers";
+static NSString * const RKSearchIndexerCheckpointCompletedRangesKey = @"completedRanges";
+
+/**
+ Orders the URI representations of object ID's so that the permanent ID's of a SQLite store follow the order of their primary keys.
+ */
+static NSComparisonResult RKCompareObjectIDURIStrings(NSString *URIString, NSString *otherURIString)
+{
+    return [URIString compare:otherURIString options:NSNumericSearch];
+}
+
+/**
+ Merges a list of closed ranges of object ID URI strings, each an array of its first and last URI string, into the equivalent sorted list of disjoint ranges.
+ */
+static NSArray *RKMergedObjectIDRanges(NSArray *ranges)
+{
+    NSArray *sortedRanges = [ranges sortedArrayUsingComparator:^NSComparisonResult(NSArray *range, NSArray *otherRange) {
+        return RKCompareObjectIDURIStrings(range[0], otherRange[0]);
+    }];
+    NSMutableArray *mergedRanges = [NSMutableArray arrayWithCapacity:[sortedRanges count]];
+    for (NSArray *range in sortedRanges) {
+        NSArray *lastRange = [mergedRanges lastObject];
+        if (lastRange && RKCompareObjectIDURIStrings(range[0], lastRange[1]) != NSOrderedDescending) {
+            if (RKCompareObjectIDURIStrings(range[1], lastRange[1]) == NSOrderedDescending) {
+                mergedRanges[[mergedRanges count] - 1] = @[ lastRange[0], range[1] ];
+            }
+        } else {
+            [mergedRanges addObject:range];
+        }
+    }
+    return mergedRanges;
+}
+
+/**
+ A partition of consecutive objects of a single entity indexed by one worker context during a reindex.
+ */
+@interface RKSearchReindexingPartition : NSObject
+@property (nonatomic, copy) NSString *entityName;
+@property (nonatomic, copy) NSArray *objectURIStrings;
+@end
+
+@implementation RKSearchReindexingPartition
+@end
+
+/**
+ Returns the ranges of object ID URI strings covered by the completed partitions and the previously completed ranges, keyed by entity name. Runs of consecutive completed partitions of the same entity are collapsed into a single range, so the number of ranges stays close to the number of workers.
+ */
+static NSDictionary *RKCompletedObjectIDRangesByEntityName(NSDictionary *previousRangesByEntityName, NSArray *partitions, NSIndexSet *completedPartitionIndexes)
+{
+    NSMutableDictionary *rangesByEntityName = [NSMutableDictionary dictionaryWithCapacity:[previousRangesByEntityName count]];
+    [previousRangesByEntityName enumerateKeysAndObjectsUsingBlock:^(NSString *entityName, NSArray *ranges, BOOL *stop) {
+        rangesByEntityName[entityName] = [ranges mutableCopy];
+    }];
+    [completedPartitionIndexes enumerateRangesUsingBlock:^(NSRange range, BOOL *stop) {
+        NSUInteger runStartIndex = range.location;
+        for (NSUInteger index = range.location; index < NSMaxRange(range); index++) {
+            RKSearchReindexingPartition *partition = partitions[index];
+            BOOL endsRun = (index + 1 == NSMaxRange(range)) || ! [[partitions[index + 1] entityName] isEqualToString:partition.entityName];
+            if (! endsRun) continue;
+
+            NSMutableArray *ranges = rangesByEntityName[partition.entityName];
+            if (! ranges) {
+                ranges = [NSMutableArray array];
+                rangesByEntityName[partition.entityName] = ranges;
+            }
+            [ranges addObject:@[ [partitions[runStartIndex] objectURIStrings][0], [partition.objectURIStrings lastObject] ]];
+            runStartIndex = index + 1;
+        }
+    }];
+    for (NSString *entityName in [rangesByEntityName allKeys]) {
+        rangesByEntityName[entityName] = RKMergedObjectIDRanges(rangesByEntityName[entityName]);
+    }
+    return rangesByEntityName;
+}
+
 @interface RKSearchIndexer ()
 @property (nonatomic, strong) NSOperationQueue *operationQueue;
 @property (nonatomic, assign) NSUInteger totalIndexingOperationCount;
+@property (nonatomic, strong) NSMapTable *searchWordTables; // Keys are `NSManagedObjectContext` objects, values are `NSMutableDictionary` objects mapping words to the `NSManagedObjectID` of their search word
+@property (nonatomic, strong) NSMapTable *stringTokenizers; // Keys are `NSManagedObjectContext` objects, values are `RKStringTokenizer` objects used on the queue of the context
 @end
 
 @implementation RKSearchIndexer
@@ -112,6 +242,14 @@ NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttr
         self.operationQueue = [NSOperationQueue new];
         self.operationQueue.maxConcurrentOperationCount = 1;
         [self.operationQueue addObserver:self forKeyPath:@"operationCount" options:0 context:NULL];
+
+        // Search word tables are discarded along with the contexts they were loaded in
+        self.searchWordTables = [NSMapTable weakToStrongObjectsMapTable];
+        self.stringTokenizers = [NSMapTable weakToStrongObjectsMapTable];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(handleSearchWordTableManagedObjectContextDidSaveNotification:)
+                                                     name:NSManagedObjectContextDidSaveNotification
+                                                   object:nil];
     }
     
     return self;
@@ -146,7 +284,15 @@ NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttr
     [[NSNotificationCenter defaultCenter] removeObserver:self name:nil object:managedObjectContext];
 }
 
-- (NSUInteger)indexManagedObject:(NSManagedObject *)managedObject withProgressBlock:(void (^)(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop))progressBlock;
+- (NSUInteger)indexManagedObject:(NSManagedObject *)managedObject withProgressBlock:(void (^)(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop))progressBlock
+{
+    return [self indexManagedObject:managedObject changedAttributesOnly:NO withProgressBlock:progressBlock];
+}
+
+/**
+ Brings the `searchWords` relationship of the given object up to date by linking the words that are missing and unlinking the words that are no longer present, leaving the links of unchanged words untouched. When `changedAttributesOnly` is `YES` and the object has already been indexed, only the searchable attributes with uncommitted changes are tokenized: the words of their committed values that are not among the words of their current values are unlinked, unless they still occur in one of the unchanged attributes.
+ */
+- (NSUInteger)indexManagedObject:(NSManagedObject *)managedObject changedAttributesOnly:(BOOL)changedAttributesOnly withProgressBlock:(void (^)(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop))progressBlock
 {
     @autoreleasepool {
 
@@ -157,10 +303,8 @@ NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttr
             return NSNotFound;
         }
 
-        RKStringTokenizer *searchTokenizer = [RKStringTokenizer new];
-        searchTokenizer.stopWords = self.stopWords;
-
-        __block NSUInteger searchWordCount;
+        __block NSUInteger searchWordCount = 0;
+        BOOL delegateRetrievesSearchWords = [self.delegate respondsToSelector:@selector(searchIndexer:searchWordForWord:inManagedObjectContext:error:)];
         NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
         fetchRequest.fetchLimit = 1;
         NSPredicate *predicateTemplate = [NSPredicate predicateWithFormat:@"%K == $SEARCH_WORD", RKSearchWordAttributeName];
@@ -168,70 +312,109 @@ NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttr
         __block BOOL stop = NO;
         
         [managedObjectContext performBlockAndWait:^{
-            NSMutableSet *searchWords = [NSMutableSet set];
-            for (NSString *searchableAttribute in searchableAttributes) {
-                NSString *attributeValue = [managedObject valueForKey:searchableAttribute];
-                id collectionOfStrings = RKObjectIsCollection(attributeValue) ? attributeValue : (attributeValue ? @[attributeValue] : @[]);
-                for (id object in collectionOfStrings) {
-                    if ([object isKindOfClass:[NSString class]]) {
-                        attributeValue = object;
-                    } else if ([object isKindOfClass:[NSNumber class]]) {
-                        attributeValue = [(NSNumber *)object stringValue];
-                    } else {
-                        attributeValue = nil;
-                    }
-                    
-                    if (attributeValue) {
-                        RKLogTrace(@"Generating search words for searchable attribute: %@", searchableAttribute);
-                        NSSet *tokens = [searchTokenizer tokenize:attributeValue];
-                        for (NSString *word in tokens) {
-                            if (word && [word length] > 0) {
-                                RKSearchWord *searchWord = nil;
-                                NSError *error = nil;
-                                if ([self.delegate respondsToSelector:@selector(searchIndexer:searchWordForWord:inManagedObjectContext:error:)]) {
-                                    // Let our delegate retrieve an existing search word
-                                    searchWord = [self.delegate searchIndexer:self searchWordForWord:word inManagedObjectContext:managedObjectContext error:&error];
-                                } else {
-                                    // Fall back to vanilla fetch request
-                                    fetchRequest.predicate = [predicateTemplate predicateWithSubstitutionVariables:@{ @"SEARCH_WORD" : word }];
-                                    NSArray *results = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
-                                    searchWord = ([results count] > 0) ? results[0] : nil;
-                                }
-                                if (error == nil) {
-                                    if (! searchWord) {
-                                        if ([self.delegate respondsToSelector:@selector(searchIndexer:shouldInsertSearchWordForWord:inManagedObjectContext:)]) {
-                                            if (! [self.delegate searchIndexer:self shouldInsertSearchWordForWord:word inManagedObjectContext:managedObjectContext]) {
-                                                continue;
-                                            }
-                                        }
-                                        searchWord = [NSEntityDescription insertNewObjectForEntityForName:RKSearchWordEntityName inManagedObjectContext:managedObjectContext];
-                                        searchWord.word = word;
-                                        
-                                        if ([self.delegate respondsToSelector:@selector(searchIndexer:didInsertSearchWord:forWord:inManagedObjectContext:)]) {
-                                            [self.delegate searchIndexer:self didInsertSearchWord:searchWord forWord:word inManagedObjectContext:managedObjectContext];
-                                        }
-                                    }
-                                    
-                                    NSAssert([[searchWord managedObjectContext] isEqual:managedObjectContext], @"Serious Core Data error: Expected `NSManagedObject` for the 'RKSearchWord' entity in context %@, but got one in %@", managedObject, [searchWord managedObjectContext]);
-                                    [searchWords addObject:searchWord];
-                                    
-                                    if (progressBlock) progressBlock(managedObject, searchWord, &stop);
-                                } else {
-                                    RKLogError(@"Failed to retrieve search word: %@", error);
-                                }
+            RKStringTokenizer *searchTokenizer = [self stringTokenizerForManagedObjectContext:managedObjectContext];
+            NSMutableDictionary *searchWordTable = delegateRetrievesSearchWords ? nil : [self searchWordTableForManagedObjectContext:managedObjectContext];
+            NSDictionary *existingSearchWordsByWord = [self searchWordsByWordForManagedObject:managedObject];
+
+            NSMutableArray *changedAttributes = nil;
+            if (changedAttributesOnly && ! [managedObject isInserted] && [existingSearchWordsByWord count] > 0) {
+                NSDictionary *changedValues = [managedObject changedValues];
+                changedAttributes = [NSMutableArray arrayWithCapacity:[searchableAttributes count]];
+                for (NSString *searchableAttribute in searchableAttributes) {
+                    if (changedValues[searchableAttribute]) [changedAttributes addObject:searchableAttribute];
+                }
+                if ([changedAttributes count] == 0) changedAttributes = nil;
+            }
+
+            NSMutableSet *wordsToAdd = [NSMutableSet set];
+            NSMutableSet *wordsToRemove = nil;
+            if (changedAttributes) {
+                RKLogTrace(@"Generating search words for changed searchable attributes: %@", changedAttributes);
+                RKAddSearchableWordsFromAttributeValues(wordsToAdd, [managedObject dictionaryWithValuesForKeys:changedAttributes], searchTokenizer);
+                wordsToRemove = [NSMutableSet set];
+                RKAddSearchableWordsFromAttributeValues(wordsToRemove, [managedObject committedValuesForKeys:changedAttributes], searchTokenizer);
+                [wordsToRemove minusSet:wordsToAdd];
+                if ([wordsToRemove count] > 0) {
+                    // Words that still occur in an unchanged attribute remain linked
+                    NSMutableArray *unchangedAttributes = [searchableAttributes mutableCopy];
+                    [unchangedAttributes removeObjectsInArray:changedAttributes];
+                    NSMutableSet *retainedWords = [NSMutableSet set];
+                    RKAddSearchableWordsFromAttributeValues(retainedWords, [managedObject dictionaryWithValuesForKeys:unchangedAttributes], searchTokenizer);
+                    [wordsToRemove minusSet:retainedWords];
+                }
+            } else {
+                RKLogTrace(@"Generating search words for searchable attributes: %@", searchableAttributes);
+                RKAddSearchableWordsFromAttributeValues(wordsToAdd, [managedObject dictionaryWithValuesForKeys:searchableAttributes], searchTokenizer);
+                wordsToRemove = [NSMutableSet setWithArray:[existingSearchWordsByWord allKeys]];
+                [wordsToRemove minusSet:wordsToAdd];
+            }
+            [wordsToAdd minusSet:[NSSet setWithArray:[existingSearchWordsByWord allKeys]]];
+            [wordsToAdd removeObject:@""];
+
+            // The progress block is invoked for every word of the object, including those whose links are left untouched
+            if (progressBlock) {
+                for (NSString *word in existingSearchWordsByWord) {
+                    if ([wordsToRemove containsObject:word]) continue;
+                    progressBlock(managedObject, existingSearchWordsByWord[word], &stop);
+                    if (stop) break;
+                }
+            }
+
+            NSMutableSet *searchWordsToAdd = [NSMutableSet setWithCapacity:[wordsToAdd count]];
+            for (NSString *word in wordsToAdd) {
+                if (stop) break;
+                RKSearchWord *searchWord = nil;
+                NSError *error = nil;
+                if (delegateRetrievesSearchWords) {
+                    // Let our delegate retrieve an existing search word
+                    searchWord = [self.delegate searchIndexer:self searchWordForWord:word inManagedObjectContext:managedObjectContext error:&error];
+                } else if (searchWordTable) {
+                    // Resolve the word against the search word table without fetching
+                    searchWord = RKSearchWordFromSearchWordTable(searchWordTable, word, managedObjectContext);
+                } else {
+                    // Fall back to vanilla fetch request
+                    fetchRequest.predicate = [predicateTemplate predicateWithSubstitutionVariables:@{ @"SEARCH_WORD" : word }];
+                    NSArray *results = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
+                    searchWord = ([results count] > 0) ? results[0] : nil;
+                }
+                if (error == nil) {
+                    if (! searchWord) {
+                        if ([self.delegate respondsToSelector:@selector(searchIndexer:shouldInsertSearchWordForWord:inManagedObjectContext:)]) {
+                            if (! [self.delegate searchIndexer:self shouldInsertSearchWordForWord:word inManagedObjectContext:managedObjectContext]) {
+                                continue;
                             }
                         }
+                        searchWord = [NSEntityDescription insertNewObjectForEntityForName:RKSearchWordEntityName inManagedObjectContext:managedObjectContext];
+                        searchWord.word = word;
+                        searchWordTable[word] = [searchWord objectID];
                         
-                        if (stop) break;
+                        if ([self.delegate respondsToSelector:@selector(searchIndexer:didInsertSearchWord:forWord:inManagedObjectContext:)]) {
+                            [self.delegate searchIndexer:self didInsertSearchWord:searchWord forWord:word inManagedObjectContext:managedObjectContext];
+                        }
                     }
+                    
+                    NSAssert([[searchWord managedObjectContext] isEqual:managedObjectContext], @"Serious Core Data error: Expected `NSManagedObject` for the 'RKSearchWord' entity in context %@, but got one in %@", managedObject, [searchWord managedObjectContext]);
+                    [searchWordsToAdd addObject:searchWord];
+                    
+                    if (progressBlock) progressBlock(managedObject, searchWord, &stop);
+                    if (stop) break;
+                } else {
+                    RKLogError(@"Failed to retrieve search word: %@", error);
                 }
-                
-                if (stop) break;
             }
 
             if (! stop) {
-                [managedObject setValue:searchWords forKey:RKSearchWordsRelationshipName];
-                RKLogTrace(@"Indexed search words: %@", [searchWords valueForKey:RKSearchWordAttributeName]);
+                // Only the links of added and removed words are changed, so unchanged search words are not dirtied by the save
+                NSMutableSet *searchWords = [managedObject mutableSetValueForKey:RKSearchWordsRelationshipName];
+                NSMutableSet *searchWordsToRemove = [NSMutableSet setWithCapacity:[wordsToRemove count]];
+                for (NSString *word in wordsToRemove) {
+                    RKSearchWord *searchWord = existingSearchWordsByWord[word];
+                    if (searchWord) [searchWordsToRemove addObject:searchWord];
+                }
+                [searchWordsToRemove minusSet:searchWordsToAdd];
+                if ([searchWordsToRemove count] > 0) [searchWords minusSet:searchWordsToRemove];
+                if ([searchWordsToAdd count] > 0) [searchWords unionSet:searchWordsToAdd];
+                RKLogTrace(@"Indexed search words: added %@, removed %@", wordsToAdd, [searchWordsToRemove valueForKey:RKSearchWordAttributeName]);
                 searchWordCount = [searchWords count];
                 
                 if ([self.delegate respondsToSelector:@selector(searchIndexer:didIndexManagedObject:)]) {
@@ -263,31 +446,36 @@ NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttr
     if (wait) {
         // Synchronous indexing
         NSUInteger totalObjects = [objectsToIndex count];
-        __block NSMutableSet *indexedIDs = [NSMutableSet setWithCapacity:totalObjects];
+        NSUInteger indexedObjectCount = 0;
         for (NSManagedObject *managedObject in objectsToIndex) {
             if ([self.delegate respondsToSelector:@selector(searchIndexer:shouldIndexManagedObject:)]) {
                 if (! [self.delegate searchIndexer:self shouldIndexManagedObject:managedObject]) continue;
             }
-            [self indexManagedObject:managedObject withProgressBlock:^(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop) {
-                if (totalObjects < 250) return;
-                if ([indexedIDs containsObject:[managedObject objectID]]) return;
-                [indexedIDs addObject:[managedObject objectID]];
-                double percentage = (((float)[indexedIDs count]) / (float)totalObjects) * 100;
-                if ([indexedIDs count] % 250 == 0 || percentage >= 100.0) RKLogInfo(@"Indexing object %ld of %ld (%.2f%% complete)", (unsigned long) [indexedIDs count], (unsigned long) totalObjects, percentage);
-            }];
+            [self indexManagedObject:managedObject changedAttributesOnly:YES withProgressBlock:nil];
+            indexedObjectCount++;
+            if (totalObjects < 250) continue;
+            double percentage = (((float)indexedObjectCount) / (float)totalObjects) * 100;
+            if (indexedObjectCount % 250 == 0 || percentage >= 100.0) RKLogInfo(@"Indexing object %ld of %ld (%.2f%% complete)", (unsigned long) indexedObjectCount, (unsigned long) totalObjects, percentage);
         }
                 
         if (totalObjects >= 250) RKLogInfo(@"Finished indexing.");
     } else {
         // Perform asynchronous indexing
-        [self.operationQueue addOperationWithBlock:^{
+        NSBlockOperation *indexingOperation = [NSBlockOperation new];
+        __weak NSBlockOperation *weakIndexingOperation = indexingOperation;
+        [indexingOperation addExecutionBlock:^{
             for (NSManagedObject *managedObject in objectsToIndex) {
+                if ([weakIndexingOperation isCancelled]) return;
                 if ([self.delegate respondsToSelector:@selector(searchIndexer:shouldIndexManagedObject:)]) {
                     if (! [self.delegate searchIndexer:self shouldIndexManagedObject:managedObject]) continue;
                 }
-                [self indexManagedObject:managedObject];
+                [self indexManagedObject:managedObject withProgressBlock:^(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop) {
+                    // Stop the indexing process if we have been cancelled
+                    if ([weakIndexingOperation isCancelled]) *stop = YES;
+                }];
             }
         }];
+        [self.operationQueue addOperation:indexingOperation];
         self.totalIndexingOperationCount = [self.operationQueue operationCount];
     }
 }
@@ -353,6 +541,204 @@ NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttr
     self.totalIndexingOperationCount = [self.operationQueue operationCount];
 }
 
+- (BOOL)reindexEntities:(NSArray *)entities
+inPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator
+              batchSize:(NSUInteger)batchSize
+          checkpointURL:(NSURL *)checkpointURL
+          progressBlock:(void (^)(NSUInteger indexedObjectCount, NSUInteger totalObjectCount, BOOL *stop))progressBlock
+                  error:(NSError **)error
+{
+    NSParameterAssert(persistentStoreCoordinator);
+    if (batchSize == 0) batchSize = RKSearchIndexerDefaultReindexingBatchSize;
+
+    NSArray *entitiesToReindex = entities ?: [[persistentStoreCoordinator.managedObjectModel entities] filteredArrayUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(NSEntityDescription *entity, NSDictionary *bindings) {
+        return (entity.userInfo)[RKSearchableAttributeNamesUserInfoKey] != nil;
+    }]];
+    for (NSEntityDescription *entity in entitiesToReindex) {
+        if (! (entity.userInfo)[RKSearchableAttributeNamesUserInfoKey]) {
+            [NSException raise:NSInvalidArgumentException format:@"The given entity (%@) does not define any searchable attributes. Perhaps you forgot to invoke addSearchIndexingToEntity:onAttributes:?", entity.name];
+        }
+    }
+
+    // Only resume from a checkpoint that was written for the same persistent stores
+    NSArray *storeIdentifiers = [[persistentStoreCoordinator persistentStores] valueForKey:@"identifier"];
+    NSDictionary *previousRangesByEntityName = @{};
+    if (checkpointURL) {
+        NSDictionary *checkpoint = [NSDictionary dictionaryWithContentsOfURL:checkpointURL];
+        if ([checkpoint[RKSearchIndexerCheckpointStoreIdentifiersKey] isEqualToArray:storeIdentifiers]) {
+            previousRangesByEntityName = checkpoint[RKSearchIndexerCheckpointCompletedRangesKey] ?: @{};
+            RKLogInfo(@"Resuming reindexing from checkpoint at %@", checkpointURL);
+        } else if (checkpoint) {
+            RKLogWarning(@"Ignoring reindexing checkpoint at %@: it was written for different persistent stores.", checkpointURL);
+        }
+    }
+
+    // Partition the sorted object ID's of each entity, skipping the ranges completed by a previous reindex
+    NSMutableArray *partitions = [NSMutableArray array];
+    __block NSUInteger totalObjectCount = 0;
+    __block NSUInteger indexedObjectCount = 0;
+    __block NSError *listingError = nil;
+    NSManagedObjectContext *listingContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    listingContext.persistentStoreCoordinator = persistentStoreCoordinator;
+    [listingContext performBlockAndWait:^{
+        for (NSEntityDescription *entity in entitiesToReindex) {
+            NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:entity.name];
+            fetchRequest.resultType = NSManagedObjectIDResultType;
+            fetchRequest.includesSubentities = NO;
+            NSError *fetchError = nil;
+            NSArray *objectIDs = [listingContext executeFetchRequest:fetchRequest error:&fetchError];
+            if (! objectIDs) {
+                listingError = fetchError;
+                return;
+            }
+
+            NSMutableArray *objectURIStrings = [NSMutableArray arrayWithCapacity:[objectIDs count]];
+            for (NSManagedObjectID *objectID in objectIDs) {
+                [objectURIStrings addObject:[[objectID URIRepresentation] absoluteString]];
+            }
+            [objectURIStrings sortUsingComparator:^NSComparisonResult(NSString *URIString, NSString *otherURIString) {
+                return RKCompareObjectIDURIStrings(URIString, otherURIString);
+            }];
+            totalObjectCount += [objectURIStrings count];
+
+            NSArray *completedRanges = RKMergedObjectIDRanges(previousRangesByEntityName[entity.name] ?: @[]);
+            NSUInteger rangeIndex = 0;
+            NSMutableArray *remainingURIStrings = [NSMutableArray arrayWithCapacity:[objectURIStrings count]];
+            for (NSString *URIString in objectURIStrings) {
+                while (rangeIndex < [completedRanges count] && RKCompareObjectIDURIStrings(completedRanges[rangeIndex][1], URIString) == NSOrderedAscending) rangeIndex++;
+                if (rangeIndex < [completedRanges count] && RKCompareObjectIDURIStrings(completedRanges[rangeIndex][0], URIString) != NSOrderedDescending) {
+                    indexedObjectCount++;
+                    continue;
+                }
+                [remainingURIStrings addObject:URIString];
+            }
+
+            for (NSUInteger location = 0; location < [remainingURIStrings count]; location += batchSize) {
+                RKSearchReindexingPartition *partition = [RKSearchReindexingPartition new];
+                partition.entityName = entity.name;
+                partition.objectURIStrings = [remainingURIStrings subarrayWithRange:NSMakeRange(location, MIN(batchSize, [remainingURIStrings count] - location))];
+                [partitions addObject:partition];
+            }
+        }
+    }];
+    if (listingError) {
+        if (error) *error = listingError;
+        return NO;
+    }
+    RKLogInfo(@"Reindexing %ld objects in %ld partitions (%ld objects previously indexed)", (unsigned long) (totalObjectCount - indexedObjectCount), (unsigned long) [partitions count], (unsigned long) indexedObjectCount);
+
+    NSMutableIndexSet *completedPartitionIndexes = [NSMutableIndexSet indexSet];
+    __block NSUInteger nextPartitionIndex = 0;
+    __block NSError *reindexingError = nil;
+    __block BOOL stopped = NO;
+    NSUInteger workerCount = MAX(MIN([[NSProcessInfo processInfo] activeProcessorCount], [partitions count]), 1);
+    NSOperationQueue *reindexingQueue = [NSOperationQueue new];
+    reindexingQueue.maxConcurrentOperationCount = workerCount;
+    for (NSUInteger worker = 0; worker < workerCount; worker++) {
+        [reindexingQueue addOperationWithBlock:^{
+            // Each worker keeps its context, and with it the search word table of the context, for all of its partitions
+            NSManagedObjectContext *workerContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+            workerContext.persistentStoreCoordinator = persistentStoreCoordinator;
+            workerContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+            workerContext.undoManager = nil;
+
+            while (YES) {
+                NSUInteger partitionIndex = NSNotFound;
+                @synchronized(completedPartitionIndexes) {
+                    if (stopped || reindexingError || nextPartitionIndex >= [partitions count]) break;
+                    partitionIndex = nextPartitionIndex++;
+                }
+
+                RKSearchReindexingPartition *partition = partitions[partitionIndex];
+                __block NSError *partitionError = nil;
+                [workerContext performBlockAndWait:^{
+                    @autoreleasepool {
+                        NSMutableArray *objectIDs = [NSMutableArray arrayWithCapacity:[partition.objectURIStrings count]];
+                        for (NSString *URIString in partition.objectURIStrings) {
+                            NSManagedObjectID *objectID = [persistentStoreCoordinator managedObjectIDForURIRepresentation:[NSURL URLWithString:URIString]];
+                            if (objectID) [objectIDs addObject:objectID];
+                        }
+
+                        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:partition.entityName];
+                        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"SELF IN %@", objectIDs];
+                        fetchRequest.includesSubentities = NO;
+                        fetchRequest.relationshipKeyPathsForPrefetching = @[ RKSearchWordsRelationshipName ];
+                        NSError *fetchError = nil;
+                        NSArray *managedObjects = [workerContext executeFetchRequest:fetchRequest error:&fetchError];
+                        if (! managedObjects) {
+                            partitionError = fetchError;
+                            return;
+                        }
+
+                        for (NSManagedObject *managedObject in managedObjects) {
+                            if ([self.delegate respondsToSelector:@selector(searchIndexer:shouldIndexManagedObject:)]) {
+                                if (! [self.delegate searchIndexer:self shouldIndexManagedObject:managedObject]) continue;
+                            }
+                            [self indexManagedObject:managedObject];
+                        }
+
+                        NSError *saveError = nil;
+                        if ([workerContext hasChanges] && ! [workerContext save:&saveError]) {
+                            partitionError = saveError;
+                            return;
+                        }
+                        [workerContext reset];
+                    }
+                }];
+
+                @synchronized(completedPartitionIndexes) {
+                    if (partitionError) {
+                        RKLogError(@"Failed reindexing of %ld objects of entity '%@' with error: %@", (unsigned long) [partition.objectURIStrings count], partition.entityName, partitionError);
+                        if (! reindexingError) reindexingError = partitionError;
+                        break;
+                    }
+
+                    [completedPartitionIndexes addIndex:partitionIndex];
+                    indexedObjectCount += [partition.objectURIStrings count];
+                    if (checkpointURL) {
+                        NSDictionary *checkpoint = @{ RKSearchIndexerCheckpointStoreIdentifiersKey: storeIdentifiers,
+                                                      RKSearchIndexerCheckpointCompletedRangesKey: RKCompletedObjectIDRangesByEntityName(previousRangesByEntityName, partitions, completedPartitionIndexes) };
+                        if (! [checkpoint writeToURL:checkpointURL atomically:YES]) {
+                            RKLogWarning(@"Failed to write reindexing checkpoint to %@", checkpointURL);
+                        }
+                    }
+                    if (progressBlock) {
+                        BOOL stop = NO;
+                        progressBlock(indexedObjectCount, totalObjectCount, &stop);
+                        if (stop) stopped = YES;
+                    }
+                }
+            }
+        }];
+    }
+    [reindexingQueue waitUntilAllOperationsAreFinished];
+
+    // Workers indexing concurrently may each have inserted a search word for the same word, including in the partitions saved before a failure or stop
+    NSError *mergeError = nil;
+    BOOL merged = [self mergeDuplicateSearchWordsInPersistentStoreCoordinator:persistentStoreCoordinator error:&mergeError];
+    if ((reindexingError || stopped) && ! merged) {
+        RKLogError(@"Failed to merge duplicate search words of the partially completed reindexing with error: %@", mergeError);
+    }
+
+    if (reindexingError) {
+        if (error) *error = reindexingError;
+        return NO;
+    }
+    if (stopped) {
+        RKLogInfo(@"Reindexing stopped after indexing %ld of %ld objects.", (unsigned long) indexedObjectCount, (unsigned long) totalObjectCount);
+        if (error) *error = [NSError errorWithDomain:RKErrorDomain code:RKOperationCancelledError userInfo:@{ NSLocalizedDescriptionKey: @"The reindexing was stopped before all objects were indexed." }];
+        return NO;
+    }
+    if (! merged) {
+        if (error) *error = mergeError;
+        return NO;
+    }
+
+    if (checkpointURL) [[NSFileManager defaultManager] removeItemAtURL:checkpointURL error:nil];
+    RKLogInfo(@"Finished reindexing %ld objects.", (unsigned long) totalObjectCount);
+    return YES;
+}
+
 - (void)cancelAllIndexingOperations
 {
     [self.operationQueue cancelAllOperations];
@@ -365,6 +751,266 @@ NSString * const RKSearchableAttributeNamesUserInfoKey = @"RestKitSearchableAttr
 
 #pragma mark - Private
 
+/**
+ Tokenizers are not thread-safe, so one is kept for each context and is only used on the queue of that context.
+ */
+- (RKStringTokenizer *)stringTokenizerForManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    RKStringTokenizer *stringTokenizer = nil;
+    @synchronized(self.stringTokenizers) {
+        stringTokenizer = [self.stringTokenizers objectForKey:managedObjectContext];
+        if (! stringTokenizer) {
+            stringTokenizer = [RKStringTokenizer new];
+            [self.stringTokenizers setObject:stringTokenizer forKey:managedObjectContext];
+        }
+    }
+    // Assigning stop words folds them, so only do so when they have changed
+    if (stringTokenizer.stopWords != self.stopWords) stringTokenizer.stopWords = self.stopWords;
+
+    return stringTokenizer;
+}
+
+/**
+ Returns the search words currently linked to the given object keyed by their word. Search words that are faults are materialized with a single fetch rather than firing a fault for each of them.
+ */
+- (NSDictionary *)searchWordsByWordForManagedObject:(NSManagedObject *)managedObject
+{
+    NSSet *searchWords = [managedObject valueForKey:RKSearchWordsRelationshipName];
+    if ([searchWords count] == 0) return @{};
+
+    for (RKSearchWord *searchWord in searchWords) {
+        if ([searchWord isFault]) {
+            NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+            fetchRequest.predicate = [NSPredicate predicateWithFormat:@"SELF IN %@", searchWords];
+            fetchRequest.returnsObjectsAsFaults = NO;
+            NSError *error = nil;
+            if (! [managedObject.managedObjectContext executeFetchRequest:fetchRequest error:&error]) {
+                RKLogWarning(@"Failed to fetch the search words of managed object %@: faults will be fired individually. Error: %@", managedObject, error);
+            }
+            break;
+        }
+    }
+
+    NSMutableDictionary *searchWordsByWord = [NSMutableDictionary dictionaryWithCapacity:[searchWords count]];
+    for (RKSearchWord *searchWord in searchWords) {
+        if (searchWord.word) searchWordsByWord[searchWord.word] = searchWord;
+    }
+    return searchWordsByWord;
+}
+
+- (NSMutableDictionary *)searchWordTableForManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSMutableDictionary *searchWordTable = nil;
+    @synchronized(self.searchWordTables) {
+        searchWordTable = [self.searchWordTables objectForKey:managedObjectContext];
+    }
+    if (searchWordTable) return searchWordTable;
+
+    // Load the words and object ID's of all persisted search words with a single fetch
+    NSExpressionDescription *objectIDExpressionDescription = [NSExpressionDescription new];
+    objectIDExpressionDescription.name = RKSearchWordObjectIDExpressionName;
+    objectIDExpressionDescription.expression = [NSExpression expressionForEvaluatedObject];
+    objectIDExpressionDescription.expressionResultType = NSObjectIDAttributeType;
+
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+    fetchRequest.resultType = NSDictionaryResultType;
+    fetchRequest.propertiesToFetch = @[ RKSearchWordAttributeName, objectIDExpressionDescription ];
+    NSError *error = nil;
+    NSArray *results = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
+    if (! results) {
+        RKLogError(@"Failed to load search word table: falling back to fetching search words individually. Error: %@", error);
+        return nil;
+    }
+
+    searchWordTable = [NSMutableDictionary dictionaryWithCapacity:[results count]];
+    for (NSDictionary *result in results) {
+        NSString *word = result[RKSearchWordAttributeName];
+        if (word) searchWordTable[word] = result[RKSearchWordObjectIDExpressionName];
+    }
+
+    // Dictionary results do not include unsaved changes, so pick up search words pending insertion in the context
+    for (NSManagedObject *insertedObject in [managedObjectContext insertedObjects]) {
+        if (! [insertedObject isKindOfClass:[RKSearchWord class]]) continue;
+        NSString *word = [(RKSearchWord *)insertedObject word];
+        if (word) searchWordTable[word] = [insertedObject objectID];
+    }
+
+    RKLogDebug(@"Loaded search word table containing %ld words for managed object context %@", (unsigned long) [searchWordTable count], managedObjectContext);
+    @synchronized(self.searchWordTables) {
+        [self.searchWordTables setObject:searchWordTable forKey:managedObjectContext];
+    }
+
+    return searchWordTable;
+}
+
+/**
+ Keeps the search word tables coherent with the persistent store. The entries of deleted search words are removed from all tables. Search words inserted by the saved context are registered under their new object ID's in its own table. Other contexts sharing its persistent store coordinator learn of them once they have permanent object ID's, which take precedence over temporary ones, while the parent of a child context also learns of their temporary object ID's.
+ */
+- (void)handleSearchWordTableManagedObjectContextDidSaveNotification:(NSNotification *)notification
+{
+    NSManagedObjectContext *savedContext = [notification object];
+    NSArray *managedObjectContexts = nil;
+    @synchronized(self.searchWordTables) {
+        managedObjectContexts = [[self.searchWordTables keyEnumerator] allObjects];
+    }
+    if ([managedObjectContexts count] == 0) return;
+
+    // The notification is posted on the queue of the saved context, so the inserted objects can be safely read here
+    NSMutableDictionary *insertedObjectIDsByWord = [NSMutableDictionary dictionary];
+    for (NSManagedObject *insertedObject in [notification userInfo][NSInsertedObjectsKey]) {
+        if (! [insertedObject isKindOfClass:[RKSearchWord class]]) continue;
+        NSString *word = [(RKSearchWord *)insertedObject word];
+        if (word) insertedObjectIDsByWord[word] = [insertedObject objectID];
+    }
+    NSMutableSet *deletedObjectIDs = [NSMutableSet set];
+    for (NSManagedObject *deletedObject in [notification userInfo][NSDeletedObjectsKey]) {
+        if ([deletedObject isKindOfClass:[RKSearchWord class]]) [deletedObjectIDs addObject:[deletedObject objectID]];
+    }
+    if ([insertedObjectIDsByWord count] == 0 && [deletedObjectIDs count] == 0) return;
+
+    for (NSManagedObjectContext *managedObjectContext in managedObjectContexts) {
+        if (managedObjectContext.persistentStoreCoordinator != savedContext.persistentStoreCoordinator) continue;
+
+        BOOL isSavedContext = (managedObjectContext == savedContext);
+        BOOL isParentContext = (managedObjectContext == savedContext.parentContext);
+        void (^updateSearchWordTable)(void) = ^{
+            NSMutableDictionary *searchWordTable = nil;
+            @synchronized(self.searchWordTables) {
+                searchWordTable = [self.searchWordTables objectForKey:managedObjectContext];
+            }
+            if ([deletedObjectIDs count] > 0) {
+                NSSet *deletedWords = [searchWordTable keysOfEntriesPassingTest:^BOOL(NSString *word, NSManagedObjectID *objectID, BOOL *stop) {
+                    return [deletedObjectIDs containsObject:objectID];
+                }];
+                [searchWordTable removeObjectsForKeys:[deletedWords allObjects]];
+            }
+            if (isSavedContext) {
+                // Replace the temporary object ID's of the newly saved search words
+                [searchWordTable addEntriesFromDictionary:insertedObjectIDsByWord];
+            } else {
+                // Temporary object ID's can only be resolved by the parent of the saved context, while permanent object ID's replace temporary ones
+                [insertedObjectIDsByWord enumerateKeysAndObjectsUsingBlock:^(NSString *word, NSManagedObjectID *objectID, BOOL *stop) {
+                    NSManagedObjectID *existingObjectID = searchWordTable[word];
+                    if ([objectID isTemporaryID]) {
+                        if (isParentContext && ! existingObjectID) searchWordTable[word] = objectID;
+                    } else if (! existingObjectID || [existingObjectID isTemporaryID]) {
+                        searchWordTable[word] = objectID;
+                    }
+                }];
+            }
+        };
+        if (isSavedContext) updateSearchWordTable();
+        else [managedObjectContext performBlock:updateSearchWordTable];
+    }
+}
+
+/**
+ Merges search words that were inserted for the same word by different contexts into a single search word, linking the indexed objects of the duplicates to it and deleting the duplicates. The search word tables are then pointed at the search words the duplicates were merged into.
+ */
+- (BOOL)mergeDuplicateSearchWordsInPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator error:(NSError **)error
+{
+    __block BOOL success = YES;
+    __block NSError *mergeError = nil;
+    NSMutableDictionary *mergedObjectIDsByWord = [NSMutableDictionary dictionary];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+    managedObjectContext.undoManager = nil;
+    [managedObjectContext performBlockAndWait:^{
+        NSExpressionDescription *objectIDExpressionDescription = [NSExpressionDescription new];
+        objectIDExpressionDescription.name = RKSearchWordObjectIDExpressionName;
+        objectIDExpressionDescription.expression = [NSExpression expressionForEvaluatedObject];
+        objectIDExpressionDescription.expressionResultType = NSObjectIDAttributeType;
+
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+        fetchRequest.resultType = NSDictionaryResultType;
+        fetchRequest.propertiesToFetch = @[ RKSearchWordAttributeName, objectIDExpressionDescription ];
+        NSArray *results = [managedObjectContext executeFetchRequest:fetchRequest error:&mergeError];
+        if (! results) {
+            success = NO;
+            return;
+        }
+
+        NSMutableDictionary *objectIDsByWord = [NSMutableDictionary dictionaryWithCapacity:[results count]];
+        NSMutableArray *duplicateResults = [NSMutableArray array];
+        for (NSDictionary *result in results) {
+            NSString *word = result[RKSearchWordAttributeName];
+            if (! word) continue;
+            if (objectIDsByWord[word]) [duplicateResults addObject:result];
+            else objectIDsByWord[word] = result[RKSearchWordObjectIDExpressionName];
+        }
+        if ([duplicateResults count] == 0) return;
+
+        RKLogInfo(@"Merging %ld duplicate search words...", (unsigned long) [duplicateResults count]);
+        NSEntityDescription *searchWordEntity = [NSEntityDescription entityForName:RKSearchWordEntityName inManagedObjectContext:managedObjectContext];
+        NSArray *indexedEntityRelationships = [[[searchWordEntity relationshipsByName] allValues] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"inverseRelationship.name == %@", RKSearchWordsRelationshipName]];
+
+        // Fetch the duplicates and the search words they are merged into along with their indexed objects
+        NSMutableArray *searchWordObjectIDs = [NSMutableArray arrayWithCapacity:[duplicateResults count] * 2];
+        for (NSDictionary *result in duplicateResults) {
+            NSString *word = result[RKSearchWordAttributeName];
+            [searchWordObjectIDs addObject:result[RKSearchWordObjectIDExpressionName]];
+            [searchWordObjectIDs addObject:objectIDsByWord[word]];
+            mergedObjectIDsByWord[word] = objectIDsByWord[word];
+        }
+        NSMutableDictionary *searchWordsByObjectID = [NSMutableDictionary dictionaryWithCapacity:[searchWordObjectIDs count]];
+        for (NSUInteger location = 0; location < [searchWordObjectIDs count]; location += RKFetchRequestInPredicateBatchSize) {
+            NSFetchRequest *searchWordsFetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+            searchWordsFetchRequest.predicate = [NSPredicate predicateWithFormat:@"SELF IN %@", [searchWordObjectIDs subarrayWithRange:NSMakeRange(location, MIN(RKFetchRequestInPredicateBatchSize, [searchWordObjectIDs count] - location))]];
+            searchWordsFetchRequest.returnsObjectsAsFaults = NO;
+            searchWordsFetchRequest.relationshipKeyPathsForPrefetching = [indexedEntityRelationships valueForKey:@"name"];
+            NSArray *searchWords = [managedObjectContext executeFetchRequest:searchWordsFetchRequest error:&mergeError];
+            if (! searchWords) {
+                success = NO;
+                return;
+            }
+            for (RKSearchWord *searchWord in searchWords) {
+                searchWordsByObjectID[[searchWord objectID]] = searchWord;
+            }
+        }
+
+        for (NSDictionary *result in duplicateResults) {
+            RKSearchWord *searchWord = searchWordsByObjectID[objectIDsByWord[result[RKSearchWordAttributeName]]];
+            RKSearchWord *duplicateSearchWord = searchWordsByObjectID[result[RKSearchWordObjectIDExpressionName]];
+            if (! searchWord || ! duplicateSearchWord) continue;
+
+            // Relink the indexed objects of the duplicate by walking its inverse relationships
+            for (NSRelationshipDescription *relationship in indexedEntityRelationships) {
+                id indexedObjects = [duplicateSearchWord valueForKey:[relationship name]];
+                if (! [relationship isToMany]) indexedObjects = indexedObjects ? @[ indexedObjects ] : @[];
+                for (NSManagedObject *indexedObject in [indexedObjects copy]) {
+                    NSMutableSet *searchWords = [indexedObject mutableSetValueForKey:RKSearchWordsRelationshipName];
+                    [searchWords removeObject:duplicateSearchWord];
+                    [searchWords addObject:searchWord];
+                }
+            }
+            [managedObjectContext deleteObject:duplicateSearchWord];
+        }
+
+        success = [managedObjectContext save:&mergeError];
+    }];
+
+    if (success && [mergedObjectIDsByWord count] > 0) {
+        // Saving has evicted the duplicates from the search word tables, so point their words at the search words they were merged into rather than let them be inserted again
+        NSArray *managedObjectContexts = nil;
+        @synchronized(self.searchWordTables) {
+            managedObjectContexts = [[self.searchWordTables keyEnumerator] allObjects];
+        }
+        for (NSManagedObjectContext *searchWordTableContext in managedObjectContexts) {
+            if (searchWordTableContext.persistentStoreCoordinator != persistentStoreCoordinator) continue;
+            [searchWordTableContext performBlock:^{
+                NSMutableDictionary *searchWordTable = nil;
+                @synchronized(self.searchWordTables) {
+                    searchWordTable = [self.searchWordTables objectForKey:searchWordTableContext];
+                }
+                [searchWordTable addEntriesFromDictionary:mergedObjectIDsByWord];
+            }];
+        }
+    }
+
+    if (! success && error) *error = mergeError;
+    return success;
+}
+
 - (void)handleManagedObjectContextWillSaveNotification:(NSNotification *)notification
 {
     NSManagedObjectContext *managedObjectContext = [notification object];
@@ -20,6 +20,8 @@
 
 #import <Foundation/Foundation.h>
 
+@class RKSearchPrefixIndex;
+
 /**
  `RKSearchPredicate` is a subclass of `NSCompoundPredicate` used to represent textual search operations against entities indexed by an instance of `RKSearchIndexer`.
 
@@ -40,6 +42,19 @@
  */
 + (NSPredicate *)searchPredicateWithText:(NSString *)searchText type:(NSCompoundPredicateType)type;
 
+/**
+ Creates and returns a new predicate for performing a full text search, evaluating the search against the given prefix index if one is provided.
+
+ When a prefix index is given the search is performed in memory by the index and the returned predicate matches the resulting objects by object ID, avoiding the scan of the `searchWords` relationship performed by the persistent store for each search term. When `prefixIndex` is `nil`, this method is equivalent to `searchPredicateWithText:type:`.
+
+ @param searchText A string of text with which to construct subpredicates for searching.
+ @param type The type of compound search to perform. Must be `NSAndPredicateType` or `NSOrPredicateType` when a prefix index is given.
+ @param prefixIndex An optional search prefix index for the searchable entity.
+ @return A new predicate for performing a full text search with the given search text and type.
+ @see `RKSearchPrefixIndex`
+ */
++ (NSPredicate *)searchPredicateWithText:(NSString *)searchText type:(NSCompoundPredicateType)type prefixIndex:(RKSearchPrefixIndex *)prefixIndex;
+
 /**
  Initializes the receiver with a string of search text and a compound predicate type.
 
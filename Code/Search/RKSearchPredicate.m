@@ -8,6 +8,22 @@
 
 #import "RKSearchPredicate.h"
 #import "RKStringTokenizer.h"
+#import "RKSearchPrefixIndex.h"
+
+static NSString * const RKSearchPredicateStringTokenizerThreadDictionaryKey = @"RKSearchPredicateStringTokenizer";
+
+// Tokenizers are not thread-safe, so each thread building search predicates reuses its own
+RKStringTokenizer *RKSearchPredicateStringTokenizerForCurrentThread(void);
+RKStringTokenizer *RKSearchPredicateStringTokenizerForCurrentThread(void)
+{
+    NSMutableDictionary *threadDictionary = [[NSThread currentThread] threadDictionary];
+    RKStringTokenizer *tokenizer = threadDictionary[RKSearchPredicateStringTokenizerThreadDictionaryKey];
+    if (! tokenizer) {
+        tokenizer = [RKStringTokenizer new];
+        threadDictionary[RKSearchPredicateStringTokenizerThreadDictionaryKey] = tokenizer;
+    }
+    return tokenizer;
+}
 
 @implementation RKSearchPredicate
 
@@ -16,10 +32,15 @@
     return [[self alloc] initWithSearchText:searchText type:type];
 }
 
++ (NSPredicate *)searchPredicateWithText:(NSString *)searchText type:(NSCompoundPredicateType)type prefixIndex:(RKSearchPrefixIndex *)prefixIndex
+{
+    if (! prefixIndex) return [self searchPredicateWithText:searchText type:type];
+    return [prefixIndex predicateWithSearchText:searchText type:type];
+}
+
 - (instancetype)initWithSearchText:(NSString *)searchText type:(NSCompoundPredicateType)type
 {
-    RKStringTokenizer *tokenizer = [RKStringTokenizer new];
-    NSSet *searchWords = [tokenizer tokenize:searchText];
+    NSSet *searchWords = [RKSearchPredicateStringTokenizerForCurrentThread() tokenize:searchText];
 
     NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:[searchWords count]];
     for (NSString *searchWord in searchWords) {
@@ -0,0 +1,120 @@
+//
+//  RKSearchPrefixIndex.h
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <CoreData/CoreData.h>
+
+/**
+ The `RKSearchPrefixIndex` class provides an optional in-memory index for evaluating full text searches against an entity indexed by an instance of `RKSearchIndexer` without querying the persistent store.
+
+ A search predicate created by `RKSearchPredicate` is evaluated by Core Data by scanning the `searchWords` relationship of each candidate object once per search term, so its cost grows with the size of the store. A prefix index instead keeps the search words of the indexed entity in a sorted array, each word mapped to the sorted list of the objects that contain it. Matching a search term becomes a binary search for the range of words beginning with the term, and combining terms is performed by intersecting (`NSAndPredicateType`) or merging (`NSOrPredicateType`) the sorted lists of matching objects. The result is returned as a set of managed object ID's or as a predicate that can be used to fetch the matching objects.
+
+ The index is a snapshot of the search words at the time it was loaded. It can be kept up to date by invoking `indexManagedObject:` after objects have been indexed by the search indexer and `removeManagedObjectWithID:` after objects have been deleted, or it can be loaded again. Objects that have only been assigned temporary object ID's are not indexed.
+
+ Prefix indexes are thread-safe. Searching may be performed from any thread while the index is being updated.
+
+ @see `RKSearchPredicate`
+ */
+@interface RKSearchPrefixIndex : NSObject
+
+///-------------------------------------
+/// @name Creating a Search Prefix Index
+///-------------------------------------
+
+/**
+ Initializes the receiver with the searchable entity whose objects are to be indexed.
+
+ @param entity The entity whose objects are to be indexed. Must have been made searchable with `[RKSearchIndexer addSearchIndexingToEntity:onAttributes:]`. Objects of subentities of the given entity are indexed as well.
+ @return The receiver, initialized with the given entity.
+ */
+- (instancetype)initWithEntity:(NSEntityDescription *)entity;
+
+/**
+ The entity whose objects are indexed by the receiver.
+ */
+@property (nonatomic, strong, readonly) NSEntityDescription *entity;
+
+///------------------------
+/// @name Loading the Index
+///------------------------
+
+/**
+ Discards the contents of the receiver and loads the search words of all objects of the indexed entity that are available in the given managed object context.
+
+ The objects are fetched in batches with their search words prefetched, so loading executes a small, fixed number of fetch requests per batch of objects regardless of the number of search words.
+
+ @param managedObjectContext The managed object context from which to load the search words. Cannot be `nil`.
+ @param error A pointer to an error object that is set if the search words could not be fetched.
+ @return `YES` if the receiver was loaded successfully, else `NO`.
+ */
+- (BOOL)loadFromManagedObjectContext:(NSManagedObjectContext *)managedObjectContext error:(NSError **)error;
+
+/**
+ Adds the given managed object to the receiver or replaces the words it is indexed under with the current contents of its `searchWords` relationship.
+
+ This method must be invoked on the queue of the managed object context of the given object.
+
+ @param managedObject The managed object to index. Must be an instance of the indexed entity.
+ */
+- (void)indexManagedObject:(NSManagedObject *)managedObject;
+
+/**
+ Removes the managed object with the given ID from the receiver.
+
+ @param objectID The ID of the managed object to remove.
+ */
+- (void)removeManagedObjectWithID:(NSManagedObjectID *)objectID;
+
+/**
+ The number of distinct words contained in the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger wordCount;
+
+/**
+ The number of managed objects indexed by the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger objectCount;
+
+///--------------------------
+/// @name Searching the Index
+///--------------------------
+
+/**
+ Returns the IDs of the managed objects matching a given search text.
+
+ The search text is tokenized and normalized in the same way as by `RKSearchPredicate`. An object matches a search term if any of its search words begins with the term.
+
+ @param searchText The text to search for.
+ @param type The type of compound search to perform. Either `NSAndPredicateType` to match objects matching all of the terms of the search text or `NSOrPredicateType` to match objects matching any of them.
+ @return A set of `NSManagedObjectID` objects for the matching managed objects.
+ */
+- (NSSet *)objectIDsMatchingSearchText:(NSString *)searchText type:(NSCompoundPredicateType)type;
+
+/**
+ Returns a predicate matching the managed objects that match a given search text.
+
+ The returned predicate matches objects by their object ID (`SELF IN %@`) and is suitable for use in a fetch request for the indexed entity.
+
+ @param searchText The text to search for.
+ @param type The type of compound search to perform. Either `NSAndPredicateType` or `NSOrPredicateType`.
+ @return A predicate matching the managed objects matching the search text.
+ @see `objectIDsMatchingSearchText:type:`
+ */
+- (NSPredicate *)predicateWithSearchText:(NSString *)searchText type:(NSCompoundPredicateType)type;
+
+@end
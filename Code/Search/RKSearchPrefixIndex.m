@@ -0,0 +1,400 @@
+//
+//  RKSearchPrefixIndex.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKSearchPrefixIndex.h"
+#import "RKSearchIndexer.h"
+#import "RKSearchWordEntity.h"
+#import "RKSearchWord.h"
+#import "RKStringTokenizer.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitSearch
+
+// Defined in RKSearchPredicate.m
+RKStringTokenizer *RKSearchPredicateStringTokenizerForCurrentThread(void);
+
+static NSUInteger const RKSearchPrefixIndexLoadBatchSize = 500;
+static NSString * const RKSearchPrefixIndexObjectIDExpressionName = @"objectID";
+
+static NSComparisonResult (^RKSearchPrefixIndexWordComparator)(NSString *, NSString *) = ^NSComparisonResult(NSString *word, NSString *otherWord) {
+    // Literal ordering keeps all words sharing a prefix in a contiguous range
+    return [word compare:otherWord options:NSLiteralSearch];
+};
+
+/**
+ Intersects two index sets by walking their sorted indexes in step.
+ */
+static NSIndexSet *RKIndexSetByIntersectingIndexSets(NSIndexSet *indexSet, NSIndexSet *otherIndexSet)
+{
+    NSMutableIndexSet *intersection = [NSMutableIndexSet indexSet];
+    NSUInteger count = [indexSet count];
+    NSUInteger otherCount = [otherIndexSet count];
+    if (count == 0 || otherCount == 0) return intersection;
+
+    NSUInteger *indexes = malloc(count * sizeof(NSUInteger));
+    NSUInteger *otherIndexes = malloc(otherCount * sizeof(NSUInteger));
+    if (indexes && otherIndexes) {
+        [indexSet getIndexes:indexes maxCount:count inIndexRange:NULL];
+        [otherIndexSet getIndexes:otherIndexes maxCount:otherCount inIndexRange:NULL];
+        NSUInteger position = 0, otherPosition = 0;
+        while (position < count && otherPosition < otherCount) {
+            if (indexes[position] < otherIndexes[otherPosition]) {
+                position++;
+            } else if (indexes[position] > otherIndexes[otherPosition]) {
+                otherPosition++;
+            } else {
+                [intersection addIndex:indexes[position]];
+                position++;
+                otherPosition++;
+            }
+        }
+    }
+    free(indexes);
+    free(otherIndexes);
+
+    return intersection;
+}
+
+@interface RKSearchPrefixIndex ()
+@property (nonatomic, strong, readwrite) NSEntityDescription *entity;
+@property (nonatomic, strong) NSMutableArray *sortedWords;
+@property (nonatomic, strong) NSMutableDictionary *objectOrdinalsByWord; // Word -> NSMutableIndexSet of object ordinals
+@property (nonatomic, strong) NSMutableArray *objectIDs; // Object ordinal -> NSManagedObjectID, or NSNull once removed until the ordinals are compacted
+@property (nonatomic, strong) NSMutableArray *wordsByObjectOrdinal; // Object ordinal -> NSSet of words
+@property (nonatomic, strong) NSMutableDictionary *objectOrdinalsByObjectID;
+@property (nonatomic, assign) NSUInteger removedObjectCount;
+#if OS_OBJECT_USE_OBJC
+@property (nonatomic, strong) dispatch_queue_t queue;
+#else
+@property (nonatomic, assign) dispatch_queue_t queue;
+#endif
+@end
+
+@implementation RKSearchPrefixIndex
+
+- (instancetype)initWithEntity:(NSEntityDescription *)entity
+{
+    NSParameterAssert(entity);
+    NSAssert(entity.userInfo[RKSearchableAttributeNamesUserInfoKey], @"Cannot create a search prefix index for the '%@' entity: the entity is not searchable. Perhaps you forgot to invoke addSearchIndexingToEntity:onAttributes:?", entity.name);
+    self = [super init];
+    if (self) {
+        self.entity = entity;
+        self.queue = dispatch_queue_create("org.restkit.search.prefix-index-queue", DISPATCH_QUEUE_CONCURRENT);
+        [self removeAllObjects];
+    }
+
+    return self;
+}
+
+- (instancetype)init
+{
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:[NSString stringWithFormat:@"%@ Failed to call designated initializer. Invoke initWithEntity: instead.",
+                                           NSStringFromClass([self class])]
+                                 userInfo:nil];
+}
+
+- (void)dealloc
+{
+#if !OS_OBJECT_USE_OBJC
+    if (_queue) dispatch_release(_queue);
+#endif
+    _queue = NULL;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p entity=%@ wordCount=%ld objectCount=%ld>",
+            NSStringFromClass([self class]), self, self.entity.name, (unsigned long) self.wordCount, (unsigned long) self.objectCount];
+}
+
+#pragma mark - Loading
+
+// Must be invoked with exclusive access to the queue
+- (void)removeAllObjects
+{
+    self.sortedWords = [NSMutableArray array];
+    self.objectOrdinalsByWord = [NSMutableDictionary dictionary];
+    self.objectIDs = [NSMutableArray array];
+    self.wordsByObjectOrdinal = [NSMutableArray array];
+    self.objectOrdinalsByObjectID = [NSMutableDictionary dictionary];
+    self.removedObjectCount = 0;
+}
+
+// Must be invoked with exclusive access to the queue. Objects are assigned the ordinal of their position and the words are sorted once rather than inserted one by one
+- (void)replaceObjectIDs:(NSArray *)objectIDs wordsByObjectOrdinal:(NSArray *)wordsByObjectOrdinal
+{
+    [self removeAllObjects];
+    [self.objectIDs addObjectsFromArray:objectIDs];
+    [self.wordsByObjectOrdinal addObjectsFromArray:wordsByObjectOrdinal];
+    [objectIDs enumerateObjectsUsingBlock:^(NSManagedObjectID *objectID, NSUInteger ordinal, BOOL *stop) {
+        self.objectOrdinalsByObjectID[objectID] = @(ordinal);
+        for (NSString *word in wordsByObjectOrdinal[ordinal]) {
+            NSMutableIndexSet *objectOrdinals = self.objectOrdinalsByWord[word];
+            if (! objectOrdinals) {
+                objectOrdinals = [NSMutableIndexSet indexSet];
+                self.objectOrdinalsByWord[word] = objectOrdinals;
+            }
+            [objectOrdinals addIndex:ordinal];
+        }
+    }];
+    [self.sortedWords addObjectsFromArray:[[self.objectOrdinalsByWord allKeys] sortedArrayUsingComparator:RKSearchPrefixIndexWordComparator]];
+}
+
+// Must be invoked with exclusive access to the queue. Renumbers the remaining objects once more objects have been removed than remain, so the cost of compacting is paid for by the removals preceding it
+- (void)compactObjectOrdinalsIfNeeded
+{
+    if (self.removedObjectCount <= [self.objectOrdinalsByObjectID count]) return;
+
+    NSMutableArray *objectIDs = [NSMutableArray arrayWithCapacity:[self.objectOrdinalsByObjectID count]];
+    NSMutableArray *wordsByObjectOrdinal = [NSMutableArray arrayWithCapacity:[self.objectOrdinalsByObjectID count]];
+    [self.objectIDs enumerateObjectsUsingBlock:^(id objectID, NSUInteger ordinal, BOOL *stop) {
+        if (objectID == [NSNull null]) return;
+        [objectIDs addObject:objectID];
+        [wordsByObjectOrdinal addObject:self.wordsByObjectOrdinal[ordinal]];
+    }];
+    [self replaceObjectIDs:objectIDs wordsByObjectOrdinal:wordsByObjectOrdinal];
+}
+
+// Must be invoked with exclusive access to the queue
+- (void)setWords:(NSSet *)words forObjectWithID:(NSManagedObjectID *)objectID
+{
+    NSNumber *ordinalNumber = self.objectOrdinalsByObjectID[objectID];
+    NSUInteger ordinal;
+    NSSet *previousWords = nil;
+    if (ordinalNumber) {
+        ordinal = [ordinalNumber unsignedIntegerValue];
+        previousWords = self.wordsByObjectOrdinal[ordinal];
+    } else {
+        ordinal = [self.objectIDs count];
+        [self.objectIDs addObject:objectID];
+        [self.wordsByObjectOrdinal addObject:[NSSet set]];
+        self.objectOrdinalsByObjectID[objectID] = @(ordinal);
+    }
+
+    for (NSString *word in previousWords) {
+        if ([words containsObject:word]) continue;
+        NSMutableIndexSet *objectOrdinals = self.objectOrdinalsByWord[word];
+        [objectOrdinals removeIndex:ordinal];
+        if ([objectOrdinals count] == 0) {
+            [self.objectOrdinalsByWord removeObjectForKey:word];
+            NSUInteger index = [self.sortedWords indexOfObject:word inSortedRange:NSMakeRange(0, [self.sortedWords count]) options:NSBinarySearchingFirstEqual usingComparator:RKSearchPrefixIndexWordComparator];
+            if (index != NSNotFound) [self.sortedWords removeObjectAtIndex:index];
+        }
+    }
+
+    for (NSString *word in words) {
+        NSMutableIndexSet *objectOrdinals = self.objectOrdinalsByWord[word];
+        if (! objectOrdinals) {
+            objectOrdinals = [NSMutableIndexSet indexSet];
+            self.objectOrdinalsByWord[word] = objectOrdinals;
+            NSUInteger index = [self.sortedWords indexOfObject:word inSortedRange:NSMakeRange(0, [self.sortedWords count]) options:NSBinarySearchingInsertionIndex usingComparator:RKSearchPrefixIndexWordComparator];
+            [self.sortedWords insertObject:word atIndex:index];
+        }
+        [objectOrdinals addIndex:ordinal];
+    }
+
+    self.wordsByObjectOrdinal[ordinal] = [words copy];
+}
+
+- (BOOL)loadFromManagedObjectContext:(NSManagedObjectContext *)managedObjectContext error:(NSError **)error
+{
+    NSParameterAssert(managedObjectContext);
+
+    __block NSMutableDictionary *wordsByObjectID = nil;
+    __block NSError *localError = nil;
+    [managedObjectContext performBlockAndWait:^{
+        // Resolve search words to their text with a single fetch rather than by firing the fault of each search word
+        NSExpressionDescription *objectIDExpressionDescription = [NSExpressionDescription new];
+        objectIDExpressionDescription.name = RKSearchPrefixIndexObjectIDExpressionName;
+        objectIDExpressionDescription.expression = [NSExpression expressionForEvaluatedObject];
+        objectIDExpressionDescription.expressionResultType = NSObjectIDAttributeType;
+        NSFetchRequest *searchWordFetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+        searchWordFetchRequest.resultType = NSDictionaryResultType;
+        searchWordFetchRequest.propertiesToFetch = @[ RKSearchWordAttributeName, objectIDExpressionDescription ];
+        NSArray *searchWordResults = [managedObjectContext executeFetchRequest:searchWordFetchRequest error:&localError];
+        if (! searchWordResults) return;
+        NSMutableDictionary *wordsBySearchWordID = [NSMutableDictionary dictionaryWithCapacity:[searchWordResults count]];
+        for (NSDictionary *result in searchWordResults) {
+            NSString *word = result[RKSearchWordAttributeName];
+            if (word) wordsBySearchWordID[result[RKSearchPrefixIndexObjectIDExpressionName]] = word;
+        }
+
+        NSFetchRequest *fetchRequest = [NSFetchRequest new];
+        fetchRequest.entity = self.entity;
+        fetchRequest.fetchBatchSize = RKSearchPrefixIndexLoadBatchSize;
+        fetchRequest.relationshipKeyPathsForPrefetching = @[ RKSearchWordsRelationshipName ];
+        NSArray *managedObjects = [managedObjectContext executeFetchRequest:fetchRequest error:&localError];
+        if (! managedObjects) return;
+
+        wordsByObjectID = [NSMutableDictionary dictionaryWithCapacity:[managedObjects count]];
+        NSUInteger count = [managedObjects count];
+        for (NSUInteger batchStart = 0; batchStart < count; batchStart += RKSearchPrefixIndexLoadBatchSize) {
+            @autoreleasepool {
+                NSArray *batch = [managedObjects subarrayWithRange:NSMakeRange(batchStart, MIN(RKSearchPrefixIndexLoadBatchSize, count - batchStart))];
+                for (NSManagedObject *managedObject in batch) {
+                    if ([[managedObject objectID] isTemporaryID]) continue;
+                    NSSet *searchWords = [managedObject valueForKey:RKSearchWordsRelationshipName];
+                    NSMutableSet *words = [NSMutableSet setWithCapacity:[searchWords count]];
+                    for (RKSearchWord *searchWord in searchWords) {
+                        NSString *word = wordsBySearchWordID[[searchWord objectID]] ?: searchWord.word;
+                        if (word) [words addObject:word];
+                    }
+                    wordsByObjectID[[managedObject objectID]] = words;
+
+                    // Turn loaded objects back into faults to bound the memory used by large loads
+                    if (! [managedObject hasChanges]) [managedObjectContext refreshObject:managedObject mergeChanges:NO];
+                }
+            }
+        }
+    }];
+
+    if (! wordsByObjectID) {
+        RKLogError(@"Failed to load search prefix index for entity '%@': %@", self.entity.name, localError);
+        if (error) *error = localError;
+        return NO;
+    }
+
+    dispatch_barrier_sync(self.queue, ^{
+        NSArray *objectIDs = [wordsByObjectID allKeys];
+        [self replaceObjectIDs:objectIDs wordsByObjectOrdinal:[wordsByObjectID objectsForKeys:objectIDs notFoundMarker:[NSSet set]]];
+    });
+    RKLogDebug(@"Loaded search prefix index for entity '%@' containing %ld words for %ld objects", self.entity.name, (unsigned long) self.wordCount, (unsigned long) self.objectCount);
+
+    return YES;
+}
+
+- (void)indexManagedObject:(NSManagedObject *)managedObject
+{
+    NSParameterAssert(managedObject);
+    NSAssert([managedObject.entity isKindOfEntity:self.entity], @"Cannot index managed object %@: expected an instance of the '%@' entity.", managedObject, self.entity.name);
+    NSManagedObjectID *objectID = [managedObject objectID];
+    if ([objectID isTemporaryID]) {
+        RKLogDebug(@"Skipping indexing of managed object %@ in search prefix index: object has a temporary object ID.", managedObject);
+        return;
+    }
+
+    NSSet *words = [[managedObject valueForKey:RKSearchWordsRelationshipName] valueForKey:RKSearchWordAttributeName];
+    dispatch_barrier_sync(self.queue, ^{
+        [self setWords:words ?: [NSSet set] forObjectWithID:objectID];
+    });
+}
+
+- (void)removeManagedObjectWithID:(NSManagedObjectID *)objectID
+{
+    NSParameterAssert(objectID);
+    dispatch_barrier_sync(self.queue, ^{
+        NSNumber *ordinalNumber = self.objectOrdinalsByObjectID[objectID];
+        if (! ordinalNumber) return;
+        [self setWords:[NSSet set] forObjectWithID:objectID];
+        self.objectIDs[[ordinalNumber unsignedIntegerValue]] = [NSNull null];
+        [self.objectOrdinalsByObjectID removeObjectForKey:objectID];
+        self.removedObjectCount++;
+        [self compactObjectOrdinalsIfNeeded];
+    });
+}
+
+- (NSUInteger)wordCount
+{
+    __block NSUInteger wordCount;
+    dispatch_sync(self.queue, ^{
+        wordCount = [self.sortedWords count];
+    });
+    return wordCount;
+}
+
+- (NSUInteger)objectCount
+{
+    __block NSUInteger objectCount;
+    dispatch_sync(self.queue, ^{
+        objectCount = [self.objectOrdinalsByObjectID count];
+    });
+    return objectCount;
+}
+
+#pragma mark - Searching
+
+// Must be invoked on the queue
+- (NSIndexSet *)objectOrdinalsMatchingPrefix:(NSString *)prefix
+{
+    NSMutableIndexSet *objectOrdinals = [NSMutableIndexSet indexSet];
+    NSUInteger count = [self.sortedWords count];
+    NSUInteger index = [self.sortedWords indexOfObject:prefix inSortedRange:NSMakeRange(0, count) options:NSBinarySearchingInsertionIndex | NSBinarySearchingFirstEqual usingComparator:RKSearchPrefixIndexWordComparator];
+    for (; index < count; index++) {
+        NSString *word = self.sortedWords[index];
+        if (! [word hasPrefix:prefix]) break;
+        [objectOrdinals addIndexes:self.objectOrdinalsByWord[word]];
+    }
+
+    return objectOrdinals;
+}
+
+- (NSSet *)objectIDsMatchingSearchText:(NSString *)searchText type:(NSCompoundPredicateType)type
+{
+    NSAssert(type == NSAndPredicateType || type == NSOrPredicateType, @"Search prefix indexes only support `NSAndPredicateType` and `NSOrPredicateType` searches.");
+    NSSet *searchWords = [RKSearchPredicateStringTokenizerForCurrentThread() tokenize:searchText];
+
+    __block NSMutableSet *objectIDs = nil;
+    dispatch_sync(self.queue, ^{
+        NSMutableArray *objectOrdinalsByTerm = [NSMutableArray arrayWithCapacity:[searchWords count]];
+        for (NSString *searchWord in searchWords) {
+            [objectOrdinalsByTerm addObject:[self objectOrdinalsMatchingPrefix:searchWord]];
+        }
+
+        NSMutableIndexSet *matchingOrdinals = nil;
+        if (type == NSAndPredicateType) {
+            if ([objectOrdinalsByTerm count] == 0) {
+                // Consistent with a compound AND predicate without subpredicates, which matches everything
+                objectIDs = [NSMutableSet setWithArray:[self.objectOrdinalsByObjectID allKeys]];
+                return;
+            }
+            // Intersect the smallest lists first so that the intermediate results stay small
+            [objectOrdinalsByTerm sortUsingComparator:^NSComparisonResult(NSIndexSet *objectOrdinals, NSIndexSet *otherObjectOrdinals) {
+                return [@([objectOrdinals count]) compare:@([otherObjectOrdinals count])];
+            }];
+            NSIndexSet *intersection = objectOrdinalsByTerm[0];
+            for (NSUInteger index = 1; index < [objectOrdinalsByTerm count] && [intersection count] > 0; index++) {
+                intersection = RKIndexSetByIntersectingIndexSets(intersection, objectOrdinalsByTerm[index]);
+            }
+            matchingOrdinals = [intersection mutableCopy];
+        } else {
+            matchingOrdinals = [NSMutableIndexSet indexSet];
+            for (NSIndexSet *objectOrdinals in objectOrdinalsByTerm) {
+                [matchingOrdinals addIndexes:objectOrdinals];
+            }
+        }
+
+        objectIDs = [NSMutableSet setWithCapacity:[matchingOrdinals count]];
+        [matchingOrdinals enumerateIndexesUsingBlock:^(NSUInteger ordinal, BOOL *stop) {
+            [objectIDs addObject:self.objectIDs[ordinal]];
+        }];
+    });
+
+    return objectIDs;
+}
+
+- (NSPredicate *)predicateWithSearchText:(NSString *)searchText type:(NSCompoundPredicateType)type
+{
+    NSSet *objectIDs = [self objectIDsMatchingSearchText:searchText type:type];
+    return [NSPredicate predicateWithFormat:@"SELF IN %@", objectIDs];
+}
+
+@end
@@ -0,0 +1,163 @@
+//
+//  RKSearchRankingIndex.h
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <CoreData/CoreData.h>
+
+/**
+ The ranking functions with which an `RKSearchRankingIndex` can score matching objects.
+ */
+typedef NS_ENUM(NSInteger, RKSearchRankingFunction) {
+    /**
+     Okapi BM25, which saturates the contribution of repeated terms and normalizes by the length of the searchable text of each object.
+     */
+    RKSearchRankingFunctionBM25,
+
+    /**
+     Classic TF-IDF, weighting the logarithm of the term frequency by the inverse document frequency of the term.
+     */
+    RKSearchRankingFunctionTFIDF
+};
+
+/**
+ The `RKSearchRankingIndex` class provides relevance-ranked full text search of an entity indexed by an instance of `RKSearchIndexer`.
+
+ Where `RKSearchPredicate` and `RKSearchPrefixIndex` only determine whether an object matches a search, a ranking index scores each matching object and returns the best matches in order of relevance. The index tokenizes the searchable attributes of each object in the same way as the search indexer, recording how often each word occurs within the object (the term frequency), how many objects contain each word (the document frequency) and the total number of words of each object. Term frequencies are kept in compact postings lists of packed integers, one list per word.
+
+ A search expands each term of the search text to all of the indexed words that begin with it, accumulates the score of every object in the postings of those words and selects the top results with a heap bounded by the requested limit, so that the full set of matching objects is never sorted.
+
+ The index can be loaded from a managed object context and kept up to date by invoking `indexManagedObject:` for objects that have been indexed, for example from the `searchIndexer:didIndexManagedObject:` delegate callback of the search indexer, and `removeManagedObjectWithID:` for objects that have been deleted. Objects that have only been assigned temporary object ID's are not indexed.
+
+ Ranking indexes are thread-safe.
+
+ @see `RKSearchIndexer`
+ @see `RKSearchPrefixIndex`
+ */
+@interface RKSearchRankingIndex : NSObject
+
+///--------------------------------------
+/// @name Creating a Search Ranking Index
+///--------------------------------------
+
+/**
+ Initializes the receiver with the searchable entity whose objects are to be ranked.
+
+ @param entity The entity whose objects are to be indexed. Must have been made searchable with `[RKSearchIndexer addSearchIndexingToEntity:onAttributes:]`. Objects of subentities of the given entity are indexed as well.
+ @return The receiver, initialized with the given entity.
+ */
+- (instancetype)initWithEntity:(NSEntityDescription *)entity;
+
+/**
+ The entity whose objects are indexed by the receiver.
+ */
+@property (nonatomic, strong, readonly) NSEntityDescription *entity;
+
+///------------------------------
+/// @name Configuring the Ranking
+///------------------------------
+
+/**
+ The set of stop words that are excluded from the index and ignored when searching. Should match the stop words of the search indexer.
+
+ Changing the stop words does not affect objects that have already been indexed.
+
+ Defaults to `nil`.
+ */
+@property (nonatomic, copy) NSSet *stopWords;
+
+/**
+ The function with which matching objects are scored.
+
+ Defaults to `RKSearchRankingFunctionBM25`.
+ */
+@property (nonatomic, assign) RKSearchRankingFunction rankingFunction;
+
+/**
+ The term frequency saturation parameter (k1) of the BM25 ranking function.
+
+ Defaults to `1.2`.
+ */
+@property (nonatomic, assign) double termFrequencySaturation;
+
+/**
+ The length normalization parameter (b) of the BM25 ranking function, between `0` (no normalization) and `1` (full normalization).
+
+ Defaults to `0.75`.
+ */
+@property (nonatomic, assign) double lengthNormalization;
+
+///------------------------
+/// @name Loading the Index
+///------------------------
+
+/**
+ Discards the contents of the receiver and indexes all objects of the indexed entity that are available in the given managed object context.
+
+ @param managedObjectContext The managed object context from which to load the objects. Cannot be `nil`.
+ @param error A pointer to an error object that is set if the objects could not be fetched.
+ @return `YES` if the receiver was loaded successfully, else `NO`.
+ */
+- (BOOL)loadFromManagedObjectContext:(NSManagedObjectContext *)managedObjectContext error:(NSError **)error;
+
+/**
+ Adds the given managed object to the receiver or replaces its postings with the current values of its searchable attributes.
+
+ This method must be invoked on the queue of the managed object context of the given object.
+
+ @param managedObject The managed object to index. Must be an instance of the indexed entity.
+ */
+- (void)indexManagedObject:(NSManagedObject *)managedObject;
+
+/**
+ Removes the managed object with the given ID from the receiver.
+
+ @param objectID The ID of the managed object to remove.
+ */
+- (void)removeManagedObjectWithID:(NSManagedObjectID *)objectID;
+
+/**
+ The number of distinct words contained in the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger wordCount;
+
+/**
+ The number of managed objects indexed by the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger objectCount;
+
+///---------------------------------
+/// @name Performing Ranked Searches
+///---------------------------------
+
+/**
+ Returns the IDs of the managed objects that best match a given search text, in descending order of relevance.
+
+ Objects with equal scores are returned in the order in which they were indexed.
+
+ @param searchText The text to search for.
+ @param type The type of compound search to perform. Either `NSAndPredicateType` to only rank objects matching all of the terms of the search text or `NSOrPredicateType` to rank objects matching any of them.
+ @param limit The maximum number of results to return. Must be greater than zero.
+ @param scores On return, an array of `NSNumber` objects containing the score of each returned object. Pass `NULL` if you do not need the scores.
+ @return An array of `NSManagedObjectID` objects for the highest ranked matching objects.
+ */
+- (NSArray *)rankedObjectIDsMatchingSearchText:(NSString *)searchText
+                                          type:(NSCompoundPredicateType)type
+                                         limit:(NSUInteger)limit
+                                        scores:(NSArray **)scores;
+
+@end
@@ -0,0 +1,531 @@
+//
+//  RKSearchRankingIndex.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKSearchRankingIndex.h"
+#import "RKSearchIndexer.h"
+#import "RKStringTokenizer.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitSearch
+
+// Defined in RKSearchPredicate.m
+RKStringTokenizer *RKSearchPredicateStringTokenizerForCurrentThread(void);
+
+// Defined in RKSearchIndexer.m
+NSArray *RKSearchableStringsFromAttributeValue(id attributeValue);
+
+static NSUInteger const RKSearchRankingIndexLoadBatchSize = 500;
+
+/**
+ An entry in the postings list of a word. Postings lists are kept sorted by object ordinal.
+ */
+typedef struct {
+    uint32_t objectOrdinal;
+    uint32_t termFrequency;
+} RKSearchPosting;
+
+typedef struct {
+    double score;
+    uint32_t objectOrdinal;
+} RKSearchRankedEntry;
+
+static NSComparisonResult (^RKSearchRankingIndexWordComparator)(NSString *, NSString *) = ^NSComparisonResult(NSString *word, NSString *otherWord) {
+    return [word compare:otherWord options:NSLiteralSearch];
+};
+
+// Returns the index of the first posting with an object ordinal greater than or equal to the given ordinal
+static NSUInteger RKSearchPostingLowerBound(const RKSearchPosting *postings, NSUInteger count, uint32_t objectOrdinal)
+{
+    NSUInteger low = 0, high = count;
+    while (low < high) {
+        NSUInteger middle = low + (high - low) / 2;
+        if (postings[middle].objectOrdinal < objectOrdinal) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+// Lower scores rank worse, ties are broken in favor of the object indexed first
+static BOOL RKSearchRankedEntryIsWorse(RKSearchRankedEntry entry, RKSearchRankedEntry otherEntry)
+{
+    if (entry.score != otherEntry.score) return entry.score < otherEntry.score;
+    return entry.objectOrdinal > otherEntry.objectOrdinal;
+}
+
+static int RKSearchRankedEntryCompareDescending(const void *entry, const void *otherEntry)
+{
+    RKSearchRankedEntry first = *(const RKSearchRankedEntry *)entry;
+    RKSearchRankedEntry second = *(const RKSearchRankedEntry *)otherEntry;
+    if (RKSearchRankedEntryIsWorse(first, second)) return 1;
+    if (RKSearchRankedEntryIsWorse(second, first)) return -1;
+    return 0;
+}
+
+// Restores the min-heap ordering (worst entry at the root) below the given position
+static void RKSearchRankedHeapSiftDown(RKSearchRankedEntry *heap, NSUInteger count, NSUInteger position)
+{
+    while (YES) {
+        NSUInteger worst = position;
+        NSUInteger left = 2 * position + 1;
+        NSUInteger right = left + 1;
+        if (left < count && RKSearchRankedEntryIsWorse(heap[left], heap[worst])) worst = left;
+        if (right < count && RKSearchRankedEntryIsWorse(heap[right], heap[worst])) worst = right;
+        if (worst == position) return;
+        RKSearchRankedEntry entry = heap[position];
+        heap[position] = heap[worst];
+        heap[worst] = entry;
+        position = worst;
+    }
+}
+
+static void RKSearchRankedHeapSiftUp(RKSearchRankedEntry *heap, NSUInteger position)
+{
+    while (position > 0) {
+        NSUInteger parent = (position - 1) / 2;
+        if (! RKSearchRankedEntryIsWorse(heap[position], heap[parent])) return;
+        RKSearchRankedEntry entry = heap[position];
+        heap[position] = heap[parent];
+        heap[parent] = entry;
+        position = parent;
+    }
+}
+
+@interface RKSearchRankingIndex ()
+@property (nonatomic, strong, readwrite) NSEntityDescription *entity;
+@property (nonatomic, strong) NSSet *foldedStopWords;
+@property (nonatomic, strong) NSMutableArray *sortedWords;
+@property (nonatomic, strong) NSMutableDictionary *postingsByWord; // Word -> NSMutableData of RKSearchPosting structs
+@property (nonatomic, strong) NSMutableArray *objectIDs; // Object ordinal -> NSManagedObjectID, or NSNull once removed
+@property (nonatomic, strong) NSMutableArray *wordsByObjectOrdinal; // Object ordinal -> NSSet of words
+@property (nonatomic, strong) NSMutableData *objectLengths; // Object ordinal -> uint32_t count of indexed words
+@property (nonatomic, strong) NSMutableDictionary *objectOrdinalsByObjectID;
+@property (nonatomic, assign) unsigned long long totalObjectLength;
+@property (nonatomic, assign) NSUInteger removedObjectCount;
+#if OS_OBJECT_USE_OBJC
+@property (nonatomic, strong) dispatch_queue_t queue;
+#else
+@property (nonatomic, assign) dispatch_queue_t queue;
+#endif
+@end
+
+@implementation RKSearchRankingIndex
+
+- (instancetype)initWithEntity:(NSEntityDescription *)entity
+{
+    NSParameterAssert(entity);
+    NSAssert(entity.userInfo[RKSearchableAttributeNamesUserInfoKey], @"Cannot create a search ranking index for the '%@' entity: the entity is not searchable. Perhaps you forgot to invoke addSearchIndexingToEntity:onAttributes:?", entity.name);
+    self = [super init];
+    if (self) {
+        self.entity = entity;
+        self.rankingFunction = RKSearchRankingFunctionBM25;
+        self.termFrequencySaturation = 1.2;
+        self.lengthNormalization = 0.75;
+        self.queue = dispatch_queue_create("org.restkit.search.ranking-index-queue", DISPATCH_QUEUE_CONCURRENT);
+        [self removeAllObjects];
+    }
+
+    return self;
+}
+
+- (instancetype)init
+{
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:[NSString stringWithFormat:@"%@ Failed to call designated initializer. Invoke initWithEntity: instead.",
+                                           NSStringFromClass([self class])]
+                                 userInfo:nil];
+}
+
+- (void)dealloc
+{
+#if !OS_OBJECT_USE_OBJC
+    if (_queue) dispatch_release(_queue);
+#endif
+    _queue = NULL;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p entity=%@ wordCount=%ld objectCount=%ld>",
+            NSStringFromClass([self class]), self, self.entity.name, (unsigned long) self.wordCount, (unsigned long) self.objectCount];
+}
+
+- (void)setStopWords:(NSSet *)stopWords
+{
+    _stopWords = [stopWords copy];
+    // Normalize the stop words exactly as indexed and searched text is normalized
+    self.foldedStopWords = [RKSearchPredicateStringTokenizerForCurrentThread() tokenizeStrings:stopWords];
+}
+
+#pragma mark - Indexing
+
+// Must be invoked with exclusive access to the queue
+- (void)removeAllObjects
+{
+    self.sortedWords = [NSMutableArray array];
+    self.postingsByWord = [NSMutableDictionary dictionary];
+    self.objectIDs = [NSMutableArray array];
+    self.wordsByObjectOrdinal = [NSMutableArray array];
+    self.objectLengths = [NSMutableData data];
+    self.objectOrdinalsByObjectID = [NSMutableDictionary dictionary];
+    self.totalObjectLength = 0;
+    self.removedObjectCount = 0;
+}
+
+// Must be invoked with exclusive access to the queue. Objects are assigned the ordinal of their position, so each postings list is built by appending and the words are sorted once rather than inserted one by one
+- (void)replaceObjectIDs:(NSArray *)objectIDs termFrequenciesByObjectOrdinal:(NSArray *)termFrequenciesByObjectOrdinal
+{
+    [self removeAllObjects];
+    [self.objectIDs addObjectsFromArray:objectIDs];
+    [self.objectLengths setLength:[objectIDs count] * sizeof(uint32_t)];
+    uint32_t *objectLengths = [self.objectLengths mutableBytes];
+    [objectIDs enumerateObjectsUsingBlock:^(NSManagedObjectID *objectID, NSUInteger ordinal, BOOL *stop) {
+        self.objectOrdinalsByObjectID[objectID] = @(ordinal);
+        NSCountedSet *termFrequencies = termFrequenciesByObjectOrdinal[ordinal];
+        NSMutableSet *words = [NSMutableSet setWithCapacity:[termFrequencies count]];
+        uint32_t objectLength = 0;
+        for (NSString *word in termFrequencies) {
+            if ([self.foldedStopWords containsObject:word]) continue;
+            RKSearchPosting posting = { (uint32_t)ordinal, (uint32_t)[termFrequencies countForObject:word] };
+            NSMutableData *postingsData = self.postingsByWord[word];
+            if (! postingsData) {
+                postingsData = [NSMutableData data];
+                self.postingsByWord[word] = postingsData;
+            }
+            [postingsData appendBytes:&posting length:sizeof(RKSearchPosting)];
+            [words addObject:word];
+            objectLength += posting.termFrequency;
+        }
+        objectLengths[ordinal] = objectLength;
+        self.totalObjectLength += objectLength;
+        [self.wordsByObjectOrdinal addObject:words];
+    }];
+    [self.sortedWords addObjectsFromArray:[[self.postingsByWord allKeys] sortedArrayUsingComparator:RKSearchRankingIndexWordComparator]];
+}
+
+// Must be invoked with exclusive access to the queue. Renumbers the remaining objects once more objects have been removed than remain, so the cost of compacting is paid for by the removals preceding it. Renumbering preserves the order of the ordinals, so the postings lists stay sorted
+- (void)compactObjectOrdinalsIfNeeded
+{
+    if (self.removedObjectCount <= [self.objectOrdinalsByObjectID count]) return;
+
+    NSUInteger ordinalCount = [self.objectIDs count];
+    uint32_t *compactedOrdinals = malloc(MAX(ordinalCount, 1) * sizeof(uint32_t));
+    if (! compactedOrdinals) {
+        RKLogError(@"Failed to allocate ordinal map for compacting search ranking index of %ld objects", (unsigned long) ordinalCount);
+        return;
+    }
+
+    NSMutableArray *objectIDs = [NSMutableArray arrayWithCapacity:[self.objectOrdinalsByObjectID count]];
+    NSMutableArray *wordsByObjectOrdinal = [NSMutableArray arrayWithCapacity:[self.objectOrdinalsByObjectID count]];
+    uint32_t *objectLengths = [self.objectLengths mutableBytes];
+    uint32_t compactedOrdinal = 0;
+    for (NSUInteger ordinal = 0; ordinal < ordinalCount; ordinal++) {
+        id objectID = self.objectIDs[ordinal];
+        if (objectID == [NSNull null]) continue;
+        compactedOrdinals[ordinal] = compactedOrdinal;
+        objectLengths[compactedOrdinal] = objectLengths[ordinal];
+        self.objectOrdinalsByObjectID[objectID] = @(compactedOrdinal);
+        [objectIDs addObject:objectID];
+        [wordsByObjectOrdinal addObject:self.wordsByObjectOrdinal[ordinal]];
+        compactedOrdinal++;
+    }
+
+    // Removed objects have no postings left, so every posting refers to a remaining object
+    for (NSMutableData *postingsData in [self.postingsByWord objectEnumerator]) {
+        NSUInteger count = [postingsData length] / sizeof(RKSearchPosting);
+        RKSearchPosting *postings = [postingsData mutableBytes];
+        for (NSUInteger index = 0; index < count; index++) {
+            postings[index].objectOrdinal = compactedOrdinals[postings[index].objectOrdinal];
+        }
+    }
+    free(compactedOrdinals);
+
+    [self.objectLengths setLength:compactedOrdinal * sizeof(uint32_t)];
+    self.objectIDs = objectIDs;
+    self.wordsByObjectOrdinal = wordsByObjectOrdinal;
+    self.removedObjectCount = 0;
+}
+
+// Must be invoked on the queue of the context of the managed object
+- (NSCountedSet *)termFrequenciesForManagedObject:(NSManagedObject *)managedObject
+{
+    NSCountedSet *termFrequencies = [NSCountedSet set];
+    RKStringTokenizer *tokenizer = RKSearchPredicateStringTokenizerForCurrentThread();
+    for (NSString *searchableAttribute in self.entity.userInfo[RKSearchableAttributeNamesUserInfoKey]) {
+        [tokenizer tokenizeStrings:RKSearchableStringsFromAttributeValue([managedObject valueForKey:searchableAttribute]) intoSet:termFrequencies];
+    }
+    return termFrequencies;
+}
+
+// Must be invoked with exclusive access to the queue
+- (void)setTermFrequencies:(NSCountedSet *)termFrequencies forObjectWithID:(NSManagedObjectID *)objectID
+{
+    NSNumber *ordinalNumber = self.objectOrdinalsByObjectID[objectID];
+    uint32_t ordinal;
+    uint32_t *objectLengths;
+    if (ordinalNumber) {
+        ordinal = (uint32_t)[ordinalNumber unsignedIntegerValue];
+    } else {
+        ordinal = (uint32_t)[self.objectIDs count];
+        [self.objectIDs addObject:objectID];
+        [self.wordsByObjectOrdinal addObject:[NSSet set]];
+        [self.objectLengths increaseLengthBy:sizeof(uint32_t)];
+        self.objectOrdinalsByObjectID[objectID] = @(ordinal);
+    }
+    objectLengths = [self.objectLengths mutableBytes];
+
+    // Remove the previous postings of the object
+    for (NSString *word in self.wordsByObjectOrdinal[ordinal]) {
+        NSMutableData *postingsData = self.postingsByWord[word];
+        NSUInteger count = [postingsData length] / sizeof(RKSearchPosting);
+        const RKSearchPosting *postings = [postingsData bytes];
+        NSUInteger index = RKSearchPostingLowerBound(postings, count, ordinal);
+        if (index < count && postings[index].objectOrdinal == ordinal) [postingsData replaceBytesInRange:NSMakeRange(index * sizeof(RKSearchPosting), sizeof(RKSearchPosting)) withBytes:NULL length:0];
+        if ([postingsData length] == 0) {
+            [self.postingsByWord removeObjectForKey:word];
+            NSUInteger wordIndex = [self.sortedWords indexOfObject:word inSortedRange:NSMakeRange(0, [self.sortedWords count]) options:NSBinarySearchingFirstEqual usingComparator:RKSearchRankingIndexWordComparator];
+            if (wordIndex != NSNotFound) [self.sortedWords removeObjectAtIndex:wordIndex];
+        }
+    }
+    self.totalObjectLength -= objectLengths[ordinal];
+
+    // Insert the new postings, keeping each list sorted by object ordinal
+    NSMutableSet *words = [NSMutableSet setWithCapacity:[termFrequencies count]];
+    uint32_t objectLength = 0;
+    for (NSString *word in termFrequencies) {
+        if ([self.foldedStopWords containsObject:word]) continue;
+        RKSearchPosting posting = { ordinal, (uint32_t)[termFrequencies countForObject:word] };
+        NSMutableData *postingsData = self.postingsByWord[word];
+        if (! postingsData) {
+            postingsData = [NSMutableData data];
+            self.postingsByWord[word] = postingsData;
+            NSUInteger wordIndex = [self.sortedWords indexOfObject:word inSortedRange:NSMakeRange(0, [self.sortedWords count]) options:NSBinarySearchingInsertionIndex usingComparator:RKSearchRankingIndexWordComparator];
+            [self.sortedWords insertObject:word atIndex:wordIndex];
+        }
+        NSUInteger count = [postingsData length] / sizeof(RKSearchPosting);
+        NSUInteger index = RKSearchPostingLowerBound([postingsData bytes], count, ordinal);
+        [postingsData replaceBytesInRange:NSMakeRange(index * sizeof(RKSearchPosting), 0) withBytes:&posting length:sizeof(RKSearchPosting)];
+        [words addObject:word];
+        objectLength += posting.termFrequency;
+    }
+
+    objectLengths[ordinal] = objectLength;
+    self.totalObjectLength += objectLength;
+    self.wordsByObjectOrdinal[ordinal] = words;
+}
+
+- (BOOL)loadFromManagedObjectContext:(NSManagedObjectContext *)managedObjectContext error:(NSError **)error
+{
+    NSParameterAssert(managedObjectContext);
+
+    __block NSMutableArray *objectIDs = nil;
+    __block NSMutableArray *termFrequencies = nil;
+    __block NSError *localError = nil;
+    [managedObjectContext performBlockAndWait:^{
+        NSFetchRequest *fetchRequest = [NSFetchRequest new];
+        fetchRequest.entity = self.entity;
+        fetchRequest.fetchBatchSize = RKSearchRankingIndexLoadBatchSize;
+        NSArray *managedObjects = [managedObjectContext executeFetchRequest:fetchRequest error:&localError];
+        if (! managedObjects) return;
+
+        NSUInteger count = [managedObjects count];
+        objectIDs = [NSMutableArray arrayWithCapacity:count];
+        termFrequencies = [NSMutableArray arrayWithCapacity:count];
+        for (NSUInteger batchStart = 0; batchStart < count; batchStart += RKSearchRankingIndexLoadBatchSize) {
+            @autoreleasepool {
+                NSArray *batch = [managedObjects subarrayWithRange:NSMakeRange(batchStart, MIN(RKSearchRankingIndexLoadBatchSize, count - batchStart))];
+                for (NSManagedObject *managedObject in batch) {
+                    if ([[managedObject objectID] isTemporaryID]) continue;
+                    [objectIDs addObject:[managedObject objectID]];
+                    [termFrequencies addObject:[self termFrequenciesForManagedObject:managedObject]];
+
+                    // Turn loaded objects back into faults to bound the memory used by large loads
+                    if (! [managedObject hasChanges]) [managedObjectContext refreshObject:managedObject mergeChanges:NO];
+                }
+            }
+        }
+    }];
+
+    if (! objectIDs) {
+        RKLogError(@"Failed to load search ranking index for entity '%@': %@", self.entity.name, localError);
+        if (error) *error = localError;
+        return NO;
+    }
+
+    dispatch_barrier_sync(self.queue, ^{
+        [self replaceObjectIDs:objectIDs termFrequenciesByObjectOrdinal:termFrequencies];
+    });
+    RKLogDebug(@"Loaded search ranking index for entity '%@' containing %ld words for %ld objects", self.entity.name, (unsigned long) self.wordCount, (unsigned long) self.objectCount);
+
+    return YES;
+}
+
+- (void)indexManagedObject:(NSManagedObject *)managedObject
+{
+    NSParameterAssert(managedObject);
+    NSAssert([managedObject.entity isKindOfEntity:self.entity], @"Cannot index managed object %@: expected an instance of the '%@' entity.", managedObject, self.entity.name);
+    NSManagedObjectID *objectID = [managedObject objectID];
+    if ([objectID isTemporaryID]) {
+        RKLogDebug(@"Skipping indexing of managed object %@ in search ranking index: object has a temporary object ID.", managedObject);
+        return;
+    }
+
+    NSCountedSet *termFrequencies = [self termFrequenciesForManagedObject:managedObject];
+    dispatch_barrier_sync(self.queue, ^{
+        [self setTermFrequencies:termFrequencies forObjectWithID:objectID];
+    });
+}
+
+- (void)removeManagedObjectWithID:(NSManagedObjectID *)objectID
+{
+    NSParameterAssert(objectID);
+    dispatch_barrier_sync(self.queue, ^{
+        NSNumber *ordinalNumber = self.objectOrdinalsByObjectID[objectID];
+        if (! ordinalNumber) return;
+        [self setTermFrequencies:[NSCountedSet set] forObjectWithID:objectID];
+        self.objectIDs[[ordinalNumber unsignedIntegerValue]] = [NSNull null];
+        [self.objectOrdinalsByObjectID removeObjectForKey:objectID];
+        self.removedObjectCount++;
+        [self compactObjectOrdinalsIfNeeded];
+    });
+}
+
+- (NSUInteger)wordCount
+{
+    __block NSUInteger wordCount;
+    dispatch_sync(self.queue, ^{
+        wordCount = [self.sortedWords count];
+    });
+    return wordCount;
+}
+
+- (NSUInteger)objectCount
+{
+    __block NSUInteger objectCount;
+    dispatch_sync(self.queue, ^{
+        objectCount = [self.objectOrdinalsByObjectID count];
+    });
+    return objectCount;
+}
+
+#pragma mark - Searching
+
+- (NSArray *)rankedObjectIDsMatchingSearchText:(NSString *)searchText
+                                          type:(NSCompoundPredicateType)type
+                                         limit:(NSUInteger)limit
+                                        scores:(NSArray **)scores
+{
+    NSAssert(type == NSAndPredicateType || type == NSOrPredicateType, @"Search ranking indexes only support `NSAndPredicateType` and `NSOrPredicateType` searches.");
+    NSAssert(limit > 0, @"Cannot perform a ranked search with a limit of zero results.");
+    NSMutableSet *searchTerms = [[RKSearchPredicateStringTokenizerForCurrentThread() tokenize:searchText] mutableCopy];
+    if (self.foldedStopWords) [searchTerms minusSet:self.foldedStopWords];
+
+    RKSearchRankingFunction rankingFunction = self.rankingFunction;
+    double k1 = self.termFrequencySaturation;
+    double b = self.lengthNormalization;
+    NSMutableArray *rankedObjectIDs = [NSMutableArray array];
+    NSMutableArray *rankedScores = [NSMutableArray array];
+
+    dispatch_sync(self.queue, ^{
+        NSUInteger objectCount = [self.objectOrdinalsByObjectID count];
+        NSUInteger ordinalCount = [self.objectIDs count];
+        if (objectCount == 0 || [searchTerms count] == 0) return;
+
+        const uint32_t *objectLengths = [self.objectLengths bytes];
+        double averageObjectLength = MAX((double)self.totalObjectLength / objectCount, 1.0);
+        double *accumulatedScores = calloc(ordinalCount, sizeof(double));
+        uint32_t *matchedTermCounts = calloc(ordinalCount, sizeof(uint32_t));
+        uint32_t *lastMatchedTerms = calloc(ordinalCount, sizeof(uint32_t));
+        uint32_t *candidates = malloc(ordinalCount * sizeof(uint32_t));
+        if (! accumulatedScores || ! matchedTermCounts || ! lastMatchedTerms || ! candidates) {
+            RKLogError(@"Failed to allocate score accumulators for ranked search of %ld objects", (unsigned long) ordinalCount);
+        } else {
+            NSUInteger candidateCount = 0;
+            uint32_t termNumber = 0;
+            NSUInteger wordCount = [self.sortedWords count];
+            for (NSString *searchTerm in searchTerms) {
+                termNumber++;
+                // Each term matches every word it is a prefix of
+                NSUInteger wordIndex = [self.sortedWords indexOfObject:searchTerm inSortedRange:NSMakeRange(0, wordCount) options:NSBinarySearchingInsertionIndex | NSBinarySearchingFirstEqual usingComparator:RKSearchRankingIndexWordComparator];
+                for (; wordIndex < wordCount; wordIndex++) {
+                    NSString *word = self.sortedWords[wordIndex];
+                    if (! [word hasPrefix:searchTerm]) break;
+
+                    NSData *postingsData = self.postingsByWord[word];
+                    const RKSearchPosting *postings = [postingsData bytes];
+                    NSUInteger postingCount = [postingsData length] / sizeof(RKSearchPosting);
+                    double inverseDocumentFrequency = (rankingFunction == RKSearchRankingFunctionBM25)
+                        ? log(1.0 + (objectCount - postingCount + 0.5) / (postingCount + 0.5))
+                        : log(1.0 + (double)objectCount / postingCount);
+                    for (NSUInteger index = 0; index < postingCount; index++) {
+                        uint32_t ordinal = postings[index].objectOrdinal;
+                        double termFrequency = postings[index].termFrequency;
+                        if (lastMatchedTerms[ordinal] == 0) candidates[candidateCount++] = ordinal;
+                        if (lastMatchedTerms[ordinal] != termNumber) {
+                            lastMatchedTerms[ordinal] = termNumber;
+                            matchedTermCounts[ordinal]++;
+                        }
+                        if (rankingFunction == RKSearchRankingFunctionBM25) {
+                            double lengthRatio = objectLengths[ordinal] / averageObjectLength;
+                            accumulatedScores[ordinal] += inverseDocumentFrequency * (termFrequency * (k1 + 1.0)) / (termFrequency + k1 * (1.0 - b + b * lengthRatio));
+                        } else {
+                            accumulatedScores[ordinal] += inverseDocumentFrequency * (1.0 + log(termFrequency));
+                        }
+                    }
+                }
+            }
+
+            // Select the top results with a min-heap bounded by the limit
+            uint32_t requiredTermCount = (type == NSAndPredicateType) ? termNumber : 1;
+            NSUInteger heapCapacity = MIN(limit, candidateCount);
+            RKSearchRankedEntry *heap = malloc(MAX(heapCapacity, 1) * sizeof(RKSearchRankedEntry));
+            NSUInteger heapCount = 0;
+            for (NSUInteger index = 0; heap && index < candidateCount; index++) {
+                uint32_t ordinal = candidates[index];
+                if (matchedTermCounts[ordinal] < requiredTermCount) continue;
+                RKSearchRankedEntry entry = { accumulatedScores[ordinal], ordinal };
+                if (heapCount < heapCapacity) {
+                    heap[heapCount] = entry;
+                    RKSearchRankedHeapSiftUp(heap, heapCount++);
+                } else if (RKSearchRankedEntryIsWorse(heap[0], entry)) {
+                    heap[0] = entry;
+                    RKSearchRankedHeapSiftDown(heap, heapCount, 0);
+                }
+            }
+            if (heap) {
+                qsort(heap, heapCount, sizeof(RKSearchRankedEntry), RKSearchRankedEntryCompareDescending);
+                for (NSUInteger index = 0; index < heapCount; index++) {
+                    [rankedObjectIDs addObject:self.objectIDs[heap[index].objectOrdinal]];
+                    [rankedScores addObject:@(heap[index].score)];
+                }
+            }
+            free(heap);
+        }
+        free(accumulatedScores);
+        free(matchedTermCounts);
+        free(lastMatchedTerms);
+        free(candidates);
+    });
+
+    if (scores) *scores = rankedScores;
+    return rankedObjectIDs;
+}
+
+@end
@@ -27,5 +27,6 @@
 #import "RKDictionaryUtilities.h"
 #import "RKURLEncodedSerialization.h"
 #import "RKNSJSONSerialization.h"
+#import "RKIncrementalJSONParser.h"
 #import "RKMIMETypeSerialization.h"
 #import "RKStringTokenizer.h"
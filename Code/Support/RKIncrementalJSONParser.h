@@ -0,0 +1,83 @@
+//
+//  RKIncrementalJSONParser.h
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ The `RKIncrementalJSONParser` class parses a UTF-8 encoded JSON document that is delivered in chunks, such as a response body that is still being downloaded. It is used by `RKResponseMapperOperation` to begin object mapping the elements of large collections before the entire response has been received.
+
+ The parser is configured with a set of streaming key paths. When the document contains an array at one of these key paths, each element of the array is deserialized and returned from `parseData:error:` as soon as its closing byte has been seen. All other content of the document (the "skeleton") is accumulated and deserialized when `finishParsing:` is invoked. Streamed arrays appear in the skeleton as empty arrays. Only the root object (identified by `[NSNull null]`) and keys of a root dictionary can be streamed; nested key paths are parsed as part of the skeleton.
+
+ Peak memory use is bounded by the size of the skeleton plus the largest single element of a streamed collection, rather than the size of the entire document.
+
+ @warning Instances of `RKIncrementalJSONParser` are not thread-safe. Chunks must be delivered serially and in order.
+ */
+@interface RKIncrementalJSONParser : NSObject
+
+///-----------------------------------
+/// @name Initializing a Parser
+///-----------------------------------
+
+/**
+ Initializes the receiver with the set of key paths whose array values are to be streamed.
+
+ This is the designated initializer.
+
+ @param keyPaths A set of `NSString` keys of the root dictionary and/or `[NSNull null]` to stream the elements of a root array.
+ @return The receiver, initialized with the given streaming key paths.
+ */
+- (instancetype)initWithStreamingKeyPaths:(NSSet *)keyPaths NS_DESIGNATED_INITIALIZER;
+
+/**
+ The set of key paths whose array values are streamed by the receiver.
+ */
+@property (nonatomic, copy, readonly) NSSet *streamingKeyPaths;
+
+///-----------------------------------
+/// @name Parsing Data
+///-----------------------------------
+
+/**
+ Parses the next chunk of the document.
+
+ @param data The next chunk of UTF-8 encoded JSON data.
+ @param error A pointer to an error object that is set if an element of a streamed collection could not be deserialized.
+ @return A dictionary whose keys are streaming key paths and whose values are arrays of the elements completed by the given chunk, in document order. Returns an empty dictionary if the chunk did not complete any elements and `nil` if an error occurred.
+ */
+- (NSDictionary *)parseData:(NSData *)data error:(NSError **)error;
+
+/**
+ Completes parsing of the document and returns its skeleton.
+
+ @param error A pointer to an error object that is set if the document is incomplete or the skeleton could not be deserialized.
+ @return The deserialized representation of the document with every streamed array replaced by an empty array, or `nil` if an error occurred.
+ */
+- (id)finishParsing:(NSError **)error;
+
+/**
+ The raw data of the document outside of the streamed collections that has been received so far.
+ */
+@property (nonatomic, readonly) NSData *skeletonData;
+
+/**
+ The total number of bytes delivered to the receiver via `parseData:error:`.
+ */
+@property (nonatomic, readonly) NSUInteger length;
+
+@end
@@ -0,0 +1,266 @@
+//
+//  RKIncrementalJSONParser.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKIncrementalJSONParser.h"
+
+typedef NS_ENUM(NSInteger, RKIncrementalJSONParserState) {
+    RKIncrementalJSONParserStateSkeleton,           // Copying bytes into the skeleton
+    RKIncrementalJSONParserStateBetweenElements,    // Inside a streamed array, awaiting the next element
+    RKIncrementalJSONParserStateElement             // Copying bytes of a streamed array element
+};
+
+static NSError *RKIncrementalJSONParserError(NSString *description)
+{
+    return [NSError errorWithDomain:NSCocoaErrorDomain code:NSPropertyListReadCorruptError userInfo:@{ NSLocalizedDescriptionKey: description }];
+}
+
+@interface RKIncrementalJSONParser ()
+@property (nonatomic, copy, readwrite) NSSet *streamingKeyPaths;
+@property (nonatomic, strong) NSMutableData *mutableSkeletonData;
+@property (nonatomic, strong) NSMutableData *elementData;
+@property (nonatomic, strong) NSMutableDictionary *parsedElements;
+@property (nonatomic, strong) id currentKey;
+@property (nonatomic, strong) id streamingKeyPath;
+@property (nonatomic, strong) NSError *parseError;
+@property (nonatomic, readwrite) NSUInteger length;
+@end
+
+@implementation RKIncrementalJSONParser {
+    RKIncrementalJSONParserState _state;
+    NSUInteger _depth;
+    NSUInteger _streamingDepth;
+    NSUInteger _keyOffset;
+    BOOL _rootIsDictionary;
+    BOOL _inString;
+    BOOL _escaped;
+    BOOL _elementCompleted;     // An element has been read and must be followed by a comma or the end of the array
+    BOOL _awaitingElement;      // A comma has been read and must be followed by an element
+}
+
+- (instancetype)initWithStreamingKeyPaths:(NSSet *)keyPaths
+{
+    self = [super init];
+    if (self) {
+        self.streamingKeyPaths = keyPaths ?: [NSSet set];
+        self.mutableSkeletonData = [NSMutableData data];
+        self.elementData = [NSMutableData data];
+        _state = RKIncrementalJSONParserStateSkeleton;
+    }
+
+    return self;
+}
+
+- (instancetype)init
+{
+    return [self initWithStreamingKeyPaths:nil];
+}
+
+- (NSData *)skeletonData
+{
+    return self.mutableSkeletonData;
+}
+
+- (void)emitElement
+{
+    NSError *error = nil;
+    id element = [NSJSONSerialization JSONObjectWithData:self.elementData options:NSJSONReadingAllowFragments error:&error];
+    [self.elementData setLength:0];
+    if (! element) {
+        if (! self.parseError) self.parseError = error;
+        return;
+    }
+
+    NSMutableArray *elements = self.parsedElements[self.streamingKeyPath];
+    if (! elements) {
+        elements = [NSMutableArray array];
+        self.parsedElements[self.streamingKeyPath] = elements;
+    }
+    [elements addObject:element];
+}
+
+- (void)beginAwaitingElement
+{
+    _state = RKIncrementalJSONParserStateBetweenElements;
+    _elementCompleted = NO;
+    _awaitingElement = YES;
+}
+
+- (void)endStreaming
+{
+    _state = RKIncrementalJSONParserStateSkeleton;
+    _streamingDepth = 0;
+    self.streamingKeyPath = nil;
+}
+
+- (void)readCurrentKey
+{
+    // The key is the last string written to the skeleton at depth 1, i.e. the bytes from its opening quote to the colon
+    NSData *keyData = [self.mutableSkeletonData subdataWithRange:NSMakeRange(_keyOffset, [self.mutableSkeletonData length] - _keyOffset)];
+    self.currentKey = [NSJSONSerialization JSONObjectWithData:keyData options:NSJSONReadingAllowFragments error:nil];
+}
+
+- (void)parseBytes:(const char *)bytes length:(NSUInteger)length
+{
+    NSUInteger segmentStart = 0;
+    for (NSUInteger i = 0; i < length && !self.parseError; i++) {
+        char c = bytes[i];
+        if (_inString) {
+            if (_escaped) _escaped = NO;
+            else if (c == '\\') _escaped = YES;
+            else if (c == '"') _inString = NO;
+            continue;
+        }
+
+        if (_state == RKIncrementalJSONParserStateBetweenElements) {
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+                segmentStart = i + 1;
+                continue;
+            } else if (c == ',') {
+                if (! _elementCompleted) {
+                    self.parseError = RKIncrementalJSONParserError(@"Unexpected ',' in a JSON array: expected an element.");
+                    break;
+                }
+                [self beginAwaitingElement];
+                segmentStart = i + 1;
+                continue;
+            } else if (c == ']') {
+                if (_awaitingElement) {
+                    self.parseError = RKIncrementalJSONParserError(@"Unexpected ']' in a JSON array: expected an element after ','.");
+                    break;
+                }
+                // The streamed array has been closed, its closing bracket belongs to the skeleton
+                _depth--;
+                [self endStreaming];
+                segmentStart = i;
+                continue;
+            } else if (_elementCompleted) {
+                self.parseError = RKIncrementalJSONParserError(@"Unexpected character in a JSON array: expected ',' or ']'.");
+                break;
+            }
+            _state = RKIncrementalJSONParserStateElement;
+            _awaitingElement = NO;
+            segmentStart = i;
+        }
+
+        if (_state == RKIncrementalJSONParserStateElement) {
+            if (c == '{' || c == '[') {
+                _depth++;
+            } else if (c == '}' || c == ']') {
+                if (_depth == _streamingDepth) {
+                    // A scalar element terminated by the end of the array
+                    [self.elementData appendBytes:bytes + segmentStart length:i - segmentStart];
+                    [self emitElement];
+                    _depth--;
+                    [self endStreaming];
+                    segmentStart = i;
+                } else if (--_depth == _streamingDepth) {
+                    [self.elementData appendBytes:bytes + segmentStart length:i + 1 - segmentStart];
+                    [self emitElement];
+                    _state = RKIncrementalJSONParserStateBetweenElements;
+                    _elementCompleted = YES;
+                    segmentStart = i + 1;
+                }
+            } else if (c == ',' && _depth == _streamingDepth) {
+                [self.elementData appendBytes:bytes + segmentStart length:i - segmentStart];
+                [self emitElement];
+                [self beginAwaitingElement];
+                segmentStart = i + 1;
+            } else if (c == '"') {
+                _inString = YES;
+            }
+            continue;
+        }
+
+        // Skeleton
+        if (c == '"') {
+            _inString = YES;
+            if (_depth == 1 && _rootIsDictionary) _keyOffset = [self.mutableSkeletonData length] + (i - segmentStart);
+        } else if (c == ':' && _depth == 1 && _rootIsDictionary) {
+            [self.mutableSkeletonData appendBytes:bytes + segmentStart length:i - segmentStart];
+            segmentStart = i;
+            [self readCurrentKey];
+        } else if (c == ',' && _depth == 1) {
+            self.currentKey = nil;
+        } else if (c == '{') {
+            if (_depth == 0) _rootIsDictionary = YES;
+            _depth++;
+        } else if (c == '[') {
+            id keyPath = nil;
+            if (_depth == 0) keyPath = [NSNull null];
+            else if (_depth == 1 && _rootIsDictionary) keyPath = self.currentKey;
+            _depth++;
+            if (keyPath && [self.streamingKeyPaths containsObject:keyPath]) {
+                [self.mutableSkeletonData appendBytes:bytes + segmentStart length:i + 1 - segmentStart];
+                segmentStart = i + 1;
+                self.streamingKeyPath = keyPath;
+                _streamingDepth = _depth;
+                _state = RKIncrementalJSONParserStateBetweenElements;
+                _elementCompleted = NO;
+                _awaitingElement = NO;
+            }
+        } else if (c == '}' || c == ']') {
+            _depth--;
+        }
+    }
+
+    if (self.parseError) return;
+    if (_state == RKIncrementalJSONParserStateSkeleton) {
+        [self.mutableSkeletonData appendBytes:bytes + segmentStart length:length - segmentStart];
+    } else if (_state == RKIncrementalJSONParserStateElement) {
+        [self.elementData appendBytes:bytes + segmentStart length:length - segmentStart];
+    }
+}
+
+- (NSDictionary *)parseData:(NSData *)data error:(NSError **)error
+{
+    self.parsedElements = [NSMutableDictionary dictionary];
+    self.length += [data length];
+
+    // Walk the (possibly discontiguous) data without flattening it into a single buffer
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        [self parseBytes:bytes length:byteRange.length];
+        *stop = (self.parseError != nil);
+    }];
+
+    NSDictionary *parsedElements = self.parsedElements;
+    self.parsedElements = nil;
+    if (self.parseError) {
+        if (error) *error = self.parseError;
+        return nil;
+    }
+
+    return parsedElements;
+}
+
+- (id)finishParsing:(NSError **)error
+{
+    if (self.parseError) {
+        if (error) *error = self.parseError;
+        return nil;
+    }
+
+    if (_depth != 0 || _inString || _state != RKIncrementalJSONParserStateSkeleton) {
+        if (error) *error = RKIncrementalJSONParserError(@"The JSON document ended unexpectedly.");
+        return nil;
+    }
+
+    return [NSJSONSerialization JSONObjectWithData:self.mutableSkeletonData options:0 error:error];
+}
+
+@end
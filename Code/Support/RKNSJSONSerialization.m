@@ -32,4 +32,10 @@
     return [NSJSONSerialization dataWithJSONObject:object options:0 error:error];
 }
 
++ (BOOL)supportsConcurrentDeserialization
+{
+    // `NSJSONSerialization` is thread-safe
+    return YES;
+}
+
 @end
@@ -51,4 +51,20 @@
  */
 + (NSData *)dataFromObject:(id)object error:(NSError **)error;
 
+@optional
+
+///-------------------------------------
+/// @name Declaring Thread Safety
+///-------------------------------------
+
+/**
+ Returns a Boolean value indicating whether the receiver's `objectFromData:error:` method may be invoked concurrently from multiple threads.
+ 
+ Response bodies handled by a serialization class that does not implement this method, or returns `NO`, are deserialized one at a time on a shared serial queue. Serialization classes that are thread-safe should return `YES` so that unrelated responses can be deserialized in parallel.
+ 
+ @return `YES` if the receiver can deserialize data concurrently, else `NO`.
+ @see `[RKResponseMapperOperation setMaxConcurrentDeserializationCount:]`
+ */
++ (BOOL)supportsConcurrentDeserialization;
+
 @end
@@ -22,6 +22,10 @@
 
 /**
  The `RKStringTokenizer` class provides an interface for tokenizing input text into a set of searchable words. Diacritics are removed and the input text is tokenized case insensitively. A set of stop words can be optionally trimmed from the result token set.
+
+ A tokenizer caches the locale, the underlying `CFStringTokenizer` and the character buffers it uses across invocations, so a single instance should be reused when tokenizing many strings. Tokens are only allocated once they are known not to be stop words or duplicates of tokens already in the result set.
+
+ @warning Instances of `RKStringTokenizer` are not thread-safe. Each thread or queue performing tokenization should use its own tokenizer.
  */
 @interface RKStringTokenizer : NSObject
 
@@ -32,6 +36,8 @@
 /**
  The set of stop words that are to be removed from the token set.
 
+ Stop words are folded case and diacritic insensitively when they are assigned, so they match tokens regardless of the case and diacritics with which they are given.
+
  Defaults to nil.
  */
 @property (nonatomic, strong) NSSet *stopWords;
@@ -48,4 +54,34 @@
  */
 - (NSSet *)tokenize:(NSString *)string;
 
+/**
+ Tokenizes the given string and adds the resulting tokens to a given mutable set.
+
+ Tokens already contained in the set are not allocated again, so a set can be reused or accumulated across many invocations to reduce the number of objects created during tokenization. When the given set is an `NSCountedSet`, each occurrence of a token is counted, so the count of a token in the set reflects its frequency in the tokenized text.
+
+ @param string A string of text you wish to tokenize. May be `nil`.
+ @param tokens A mutable set to which the searchable text tokens extracted from the given string are added. Cannot be `nil`.
+ */
+- (void)tokenizeString:(NSString *)string intoSet:(NSMutableSet *)tokens;
+
+///------------------------------
+/// @name Tokenizing Many Strings
+///------------------------------
+
+/**
+ Tokenizes each of the given strings and returns the union of the resulting tokens.
+
+ @param strings A collection of strings to tokenize.
+ @returns A set of searchable text tokens extracted from all of the given strings.
+ */
+- (NSSet *)tokenizeStrings:(id<NSFastEnumeration>)strings;
+
+/**
+ Tokenizes each of the given strings and adds the resulting tokens to a given mutable set.
+
+ @param strings A collection of strings to tokenize.
+ @param tokens A mutable set to which the searchable text tokens extracted from the given strings are added. Cannot be `nil`.
+ */
+- (void)tokenizeStrings:(id<NSFastEnumeration>)strings intoSet:(NSMutableSet *)tokens;
+
 @end
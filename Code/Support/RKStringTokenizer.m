@@ -8,35 +8,123 @@
 
 #import "RKStringTokenizer.h"
 
-@implementation RKStringTokenizer
+static CFStringCompareFlags const RKStringTokenizerFoldingOptions = kCFCompareCaseInsensitive | kCFCompareDiacriticInsensitive;
+
+@interface RKStringTokenizer ()
+@property (nonatomic, strong) NSSet *foldedStopWords;
+@end
+
+@implementation RKStringTokenizer {
+    CFLocaleRef _locale;
+    CFStringTokenizerRef _tokenizer;
+    CFMutableStringRef _foldingBuffer;
+    UniChar *_characters;
+    CFIndex _charactersCapacity;
+    CFMutableStringRef _probe; // Points at the characters of the current token to test set membership without allocating
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _locale = CFLocaleCopyCurrent();
+        _tokenizer = CFStringTokenizerCreate(kCFAllocatorDefault, CFSTR(""), CFRangeMake(0, 0), kCFStringTokenizerUnitWord, _locale);
+        _foldingBuffer = CFStringCreateMutable(kCFAllocatorDefault, 0);
+        _probe = CFStringCreateMutableWithExternalCharactersNoCopy(kCFAllocatorDefault, NULL, 0, 0, kCFAllocatorNull);
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_tokenizer) CFRelease(_tokenizer);
+    if (_locale) CFRelease(_locale);
+    if (_foldingBuffer) CFRelease(_foldingBuffer);
+    if (_probe) CFRelease(_probe);
+    free(_characters);
+}
+
+- (void)setStopWords:(NSSet *)stopWords
+{
+    _stopWords = stopWords;
+
+    // Fold the stop words as the input text is folded so that they can be matched against the raw tokens
+    NSMutableSet *foldedStopWords = [NSMutableSet setWithCapacity:[stopWords count]];
+    for (NSString *stopWord in stopWords) {
+        [foldedStopWords addObject:[stopWord stringByFoldingWithOptions:RKStringTokenizerFoldingOptions locale:[NSLocale systemLocale]]];
+    }
+    self.foldedStopWords = stopWords ? foldedStopWords : nil;
+}
 
 - (NSSet *)tokenize:(NSString *)string
 {
     NSMutableSet *tokens = [NSMutableSet set];
+    [self tokenizeString:string intoSet:tokens];
+    return tokens;
+}
 
-    CFLocaleRef locale = CFLocaleCopyCurrent();
+- (void)tokenizeString:(NSString *)string intoSet:(NSMutableSet *)tokens
+{
+    NSParameterAssert(tokens);
+    if ([string length] == 0) return;
 
     // Remove diacratics and lowercase our input text
-    NSString *tokenizeText = string = [string stringByFoldingWithOptions:kCFCompareCaseInsensitive|kCFCompareDiacriticInsensitive locale:[NSLocale systemLocale]];
-    CFStringTokenizerRef tokenizer = CFStringTokenizerCreate(kCFAllocatorDefault, (__bridge CFStringRef)tokenizeText, CFRangeMake(0, CFStringGetLength((__bridge CFStringRef)tokenizeText)), kCFStringTokenizerUnitWord, locale);
-    CFStringTokenizerTokenType tokenType = kCFStringTokenizerTokenNone;
+    CFStringReplaceAll(_foldingBuffer, (__bridge CFStringRef)string);
+    CFStringFold(_foldingBuffer, RKStringTokenizerFoldingOptions, CFLocaleGetSystem());
+    CFIndex length = CFStringGetLength(_foldingBuffer);
+    if (length > _charactersCapacity) {
+        _charactersCapacity = length;
+        _characters = reallocf(_characters, _charactersCapacity * sizeof(UniChar));
+        if (! _characters) {
+            _charactersCapacity = 0;
+            return;
+        }
+    }
+    CFStringGetCharacters(_foldingBuffer, CFRangeMake(0, length), _characters);
 
-    while (kCFStringTokenizerTokenNone != (tokenType = CFStringTokenizerAdvanceToNextToken(tokenizer))) {
-        CFRange tokenRange = CFStringTokenizerGetCurrentTokenRange(tokenizer);
+    CFStringRef tokenizeText = CFStringCreateWithCharactersNoCopy(kCFAllocatorDefault, _characters, length, kCFAllocatorNull);
+    CFStringTokenizerSetString(_tokenizer, tokenizeText, CFRangeMake(0, length));
+    NSSet *foldedStopWords = self.foldedStopWords;
 
-        NSRange range = NSMakeRange(tokenRange.location, tokenRange.length);
-        NSString *token = [string substringWithRange:range];
+    while (kCFStringTokenizerTokenNone != CFStringTokenizerAdvanceToNextToken(_tokenizer)) {
+        CFRange tokenRange = CFStringTokenizerGetCurrentTokenRange(_tokenizer);
+        UniChar *tokenCharacters = _characters + tokenRange.location;
 
-        [tokens addObject:token];
-    }
+        // Skip stop words and tokens we already have before allocating a string for the token
+        CFStringSetExternalCharactersNoCopy(_probe, tokenCharacters, tokenRange.length, tokenRange.length);
+        NSString *probe = (__bridge NSString *)_probe;
+        if ([foldedStopWords containsObject:probe]) continue;
+        NSString *existingToken = [tokens member:probe];
+        if (existingToken) {
+            // Counts another occurrence when tokenizing into an `NSCountedSet`, no-op otherwise
+            [tokens addObject:existingToken];
+            continue;
+        }
 
-    CFRelease(tokenizer);
-    CFRelease(locale);
+        CFStringRef token = CFStringCreateWithCharacters(kCFAllocatorDefault, tokenCharacters, tokenRange.length);
+        [tokens addObject:(__bridge_transfer NSString *)token];
+    }
 
-    // Remove any stop words
-    if (self.stopWords) [tokens minusSet:self.stopWords];
+    // Detach the tokenizer and probe from the character buffer before it is reused
+    CFStringTokenizerSetString(_tokenizer, CFSTR(""), CFRangeMake(0, 0));
+    CFStringSetExternalCharactersNoCopy(_probe, NULL, 0, 0);
+    CFRelease(tokenizeText);
+}
 
+- (NSSet *)tokenizeStrings:(id<NSFastEnumeration>)strings
+{
+    NSMutableSet *tokens = [NSMutableSet set];
+    [self tokenizeStrings:strings intoSet:tokens];
     return tokens;
 }
 
+- (void)tokenizeStrings:(id<NSFastEnumeration>)strings intoSet:(NSMutableSet *)tokens
+{
+    NSParameterAssert(tokens);
+    for (NSString *string in strings) {
+        [self tokenizeString:string intoSet:tokens];
+    }
+}
+
 @end
@@ -136,6 +136,11 @@ NSArray * RKAFQueryStringPairsFromKeyAndValue(NSString *key, id value) {
     return [string dataUsingEncoding:NSUTF8StringEncoding];
 }
 
++ (BOOL)supportsConcurrentDeserialization
+{
+    return YES;
+}
+
 @end
 
 NSDictionary *RKDictionaryFromURLEncodedStringWithEncoding(NSString *URLEncodedString, NSStringEncoding encoding)
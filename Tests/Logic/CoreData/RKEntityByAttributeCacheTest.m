@@ -10,6 +10,7 @@
 #import "RKEntityByAttributeCache.h"
 #import "RKHuman.h"
 #import "RKChild.h"
+#import "RKBenchmark.h"
 
 @interface RKEntityByAttributeCacheTest : RKTestCase
 @property (nonatomic, strong) RKManagedObjectStore *managedObjectStore;
@@ -152,6 +153,39 @@
     assertThat(object.objectID, is(equalTo(human.objectID)));
 }
 
+- (void)testRetrievalOfNumericPropertyByNonCanonicalStringValueFails
+{
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    human.railsID = @12345;
+    [self.managedObjectStore.persistentStoreManagedObjectContext save:nil];
+    [self.cache load:nil];
+    expect([self.cache isLoaded]).will.equal(YES);
+
+    expect([self.cache objectWithAttributeValues:@{ @"railsID": @"012345" } inContext:self.managedObjectContext]).to.beNil();
+    expect([self.cache objectWithAttributeValues:@{ @"railsID": @12345.0 } inContext:self.managedObjectContext]).to.equal(human);
+}
+
+- (void)testRetrievalOfCompoundAttributeValuesByStringValue
+{
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    self.cache = [[RKEntityByAttributeCache alloc] initWithEntity:entity
+                                                       attributes:@[ @"railsID", @"name" ]
+                                             managedObjectContext:self.managedObjectContext];
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human.railsID = @12345;
+    human.name = @"Blake";
+    [self.managedObjectContext save:nil];
+
+    __block BOOL done = NO;
+    [self.cache addObjects:[NSSet setWithObject:human] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    expect([self.cache objectWithAttributeValues:@{ @"name": @"Blake", @"railsID": @"12345" } inContext:self.managedObjectContext]).to.equal(human);
+    expect([self.cache objectWithAttributeValues:@{ @"name": @"12345", @"railsID": @"Blake" } inContext:self.managedObjectContext]).to.beNil();
+}
+
 - (void)testRetrievalOfObjectsWithAttributeValue
 {
     RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
@@ -372,6 +406,91 @@
     assertThatInteger([self.cache count], is(equalToInteger(0)));
 }
 
+- (void)testLookupBenchmark
+{
+    NSUInteger numberOfObjects = 1000;
+    for (NSUInteger index = 0; index < numberOfObjects; index++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @(index);
+    }
+    [self.managedObjectContext save:nil];
+    __block BOOL done = NO;
+    [self.cache load:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    NSMutableArray *arrayOfAttributeValues = [NSMutableArray arrayWithCapacity:numberOfObjects * 2];
+    for (NSUInteger index = 0; index < numberOfObjects; index++) {
+        [arrayOfAttributeValues addObject:@{ @"railsID": @(index) }];
+        [arrayOfAttributeValues addObject:@{ @"railsID": [NSString stringWithFormat:@"%lu", (unsigned long)index] }];
+    }
+
+    __block NSUInteger numberOfMatches = 0;
+    [RKBenchmark report:@"Looking Up Attribute Values" executionBlock:^{
+        for (NSDictionary *attributeValues in arrayOfAttributeValues) {
+            if ([self.cache objectWithAttributeValues:attributeValues inContext:self.managedObjectContext]) numberOfMatches++;
+        }
+    }];
+    expect(numberOfMatches).to.equal(numberOfObjects * 2);
+}
+
+#pragma mark - Loading on Demand
+
+- (void)testLoadingObjectsWithAttributeValuesLoadsOnlyTheRequestedValues
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.railsID = @1;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.railsID = @2;
+    [self.managedObjectContext save:nil];
+
+    __block BOOL done = NO;
+    [self.cache loadObjectsWithAttributeValues:@[ @{ @"railsID": @1 }, @{ @"railsID": @"3" } ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    expect([self.cache count]).to.equal(1);
+    expect([self.cache objectWithAttributeValues:@{ @"railsID": @1 } inContext:self.managedObjectContext]).to.equal(human1);
+    expect([self.cache hasLoadedObjectsWithAttributeValues:@{ @"railsID": @1 }]).to.equal(YES);
+    expect([self.cache hasLoadedObjectsWithAttributeValues:@{ @"railsID": @3 }]).to.equal(YES);
+    expect([self.cache hasLoadedObjectsWithAttributeValues:@{ @"railsID": @2 }]).to.equal(NO);
+}
+
+- (void)testLoadingAllObjectsLoadsEveryAttributeValue
+{
+    __block BOOL done = NO;
+    [self.cache load:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([self.cache hasLoadedObjectsWithAttributeValues:@{ @"railsID": @12345 }]).to.equal(YES);
+}
+
+- (void)testLoadingObjectsOnDemandEvictsTheEarliestLoadedValues
+{
+    for (NSNumber *railsID in @[ @1, @2, @3 ]) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = railsID;
+    }
+    [self.managedObjectContext save:nil];
+    self.cache.maximumNumberOfLoadedAttributeValues = 2;
+
+    for (NSNumber *railsID in @[ @1, @2, @3 ]) {
+        __block BOOL done = NO;
+        [self.cache loadObjectsWithAttributeValues:@[ @{ @"railsID": railsID } ] completion:^{
+            done = YES;
+        }];
+        expect(done).will.equal(YES);
+    }
+
+    expect([self.cache hasLoadedObjectsWithAttributeValues:@{ @"railsID": @1 }]).to.equal(NO);
+    expect([self.cache hasLoadedObjectsWithAttributeValues:@{ @"railsID": @2 }]).to.equal(YES);
+    expect([self.cache hasLoadedObjectsWithAttributeValues:@{ @"railsID": @3 }]).to.equal(YES);
+    expect([self.cache countOfAttributeValues]).to.equal(2);
+}
+
 #pragma mark - Compound Key Tests
 
 // missing attributes
@@ -131,4 +131,140 @@
     }];
 }
 
+- (void)testLoadingObjectsOnDemandOnlyCachesTheLookedUpValues
+{
+    NSManagedObjectContext *persistentStoreContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:persistentStoreContext];
+    human1.railsID = @1;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:persistentStoreContext];
+    human2.railsID = @2;
+    [persistentStoreContext save:nil];
+
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:persistentStoreContext];
+    managedObjectCache.loadsObjectsOnDemand = YES;
+    NSSet *objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @1 } inManagedObjectContext:persistentStoreContext];
+    expect(objects).to.equal([NSSet setWithObject:human1]);
+    expect([managedObjectCache.entityCache containsObject:human1]).to.equal(YES);
+    expect([managedObjectCache.entityCache containsObject:human2]).to.equal(NO);
+
+    objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @3 } inManagedObjectContext:persistentStoreContext];
+    expect(objects).to.haveCountOf(0);
+    expect([managedObjectCache.entityCache isEntity:self.humanEntity cachedWithAttributeValues:@{ @"railsID": @3 }]).to.equal(YES);
+}
+
+- (void)testLoadingObjectsOnDemandFindsUnsavedObjectsOfTheContext
+{
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    managedObjectCache.loadsObjectsOnDemand = YES;
+    __block RKHuman *human = nil;
+    [self.managedObjectContext performBlockAndWait:^{
+        human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @42;
+    }];
+
+    NSSet *objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @42 } inManagedObjectContext:self.managedObjectContext];
+    expect(objects).to.equal([NSSet setWithObject:human]);
+}
+
+- (void)testLoadingObjectsOnDemandIsBoundedByTheMaximumNumberOfCachedAttributeValues
+{
+    NSManagedObjectContext *persistentStoreContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    for (NSNumber *railsID in @[ @1, @2, @3 ]) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:persistentStoreContext];
+        human.railsID = railsID;
+    }
+    [persistentStoreContext save:nil];
+
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:persistentStoreContext];
+    managedObjectCache.loadsObjectsOnDemand = YES;
+    managedObjectCache.maximumNumberOfCachedAttributeValues = 2;
+    for (NSNumber *railsID in @[ @1, @2, @3 ]) {
+        NSSet *objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": railsID } inManagedObjectContext:persistentStoreContext];
+        expect(objects).to.haveCountOf(1);
+    }
+
+    expect([managedObjectCache.entityCache isEntity:self.humanEntity cachedWithAttributeValues:@{ @"railsID": @1 }]).to.equal(NO);
+    expect([managedObjectCache.entityCache isEntity:self.humanEntity cachedWithAttributeValues:@{ @"railsID": @3 }]).to.equal(YES);
+}
+
+- (void)testLoadingObjectsOnDemandFindsObjectsInsertedIntoTheContextAfterTheFirstLookup
+{
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    managedObjectCache.loadsObjectsOnDemand = YES;
+    NSSet *objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @42 } inManagedObjectContext:self.managedObjectContext];
+    expect(objects).to.haveCountOf(0);
+
+    __block RKHuman *human = nil;
+    [self.managedObjectContext performBlockAndWait:^{
+        human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @43;
+        [self.managedObjectContext processPendingChanges];
+    }];
+    objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @43 } inManagedObjectContext:self.managedObjectContext];
+    expect(objects).to.equal([NSSet setWithObject:human]);
+}
+
+- (void)testLoadingObjectsOnDemandDoesNotAddUnsavedObjectsOfTheContextToTheEntityCache
+{
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    managedObjectCache.loadsObjectsOnDemand = YES;
+    __block RKHuman *human = nil;
+    [self.managedObjectContext performBlockAndWait:^{
+        human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @42;
+    }];
+
+    NSSet *objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @42 } inManagedObjectContext:self.managedObjectContext];
+    expect(objects).to.equal([NSSet setWithObject:human]);
+    expect([managedObjectCache.entityCache containsObject:human]).to.equal(NO);
+
+    NSManagedObjectContext *otherContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    [otherContext setParentContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @42 } inManagedObjectContext:otherContext];
+    expect(objects).to.haveCountOf(0);
+}
+
+- (void)testLoadingObjectsOnDemandInAdvanceLoadsAllOfTheGivenValues
+{
+    NSManagedObjectContext *persistentStoreContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    for (NSNumber *railsID in @[ @1, @2, @3 ]) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:persistentStoreContext];
+        human.railsID = railsID;
+    }
+    [persistentStoreContext save:nil];
+
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:persistentStoreContext];
+    managedObjectCache.loadsObjectsOnDemand = YES;
+    NSArray *arrayOfAttributeValues = @[ @{ @"railsID": @1 }, @{ @"railsID": @2 }, @{ @"railsID": @3 }, @{ @"railsID": @4 } ];
+    [managedObjectCache loadManagedObjectsWithEntity:self.humanEntity arrayOfAttributeValues:arrayOfAttributeValues inManagedObjectContext:persistentStoreContext];
+    for (NSDictionary *attributeValues in arrayOfAttributeValues) {
+        expect([managedObjectCache.entityCache isEntity:self.humanEntity cachedWithAttributeValues:attributeValues]).to.equal(YES);
+    }
+    expect([[managedObjectCache.entityCache attributeCacheForEntity:self.humanEntity attributes:@[ @"railsID" ]] count]).to.equal(3);
+}
+
+- (void)testThatAddedObjectsCountAgainstTheMaximumNumberOfCachedAttributeValues
+{
+    NSManagedObjectContext *persistentStoreContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    NSMutableArray *humans = [NSMutableArray array];
+    for (NSNumber *railsID in @[ @1, @2, @3 ]) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:persistentStoreContext];
+        human.railsID = railsID;
+        [humans addObject:human];
+    }
+    [persistentStoreContext save:nil];
+
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:persistentStoreContext];
+    managedObjectCache.loadsObjectsOnDemand = YES;
+    managedObjectCache.maximumNumberOfCachedAttributeValues = 2;
+    NSSet *objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"railsID": @1 } inManagedObjectContext:persistentStoreContext];
+    expect(objects).to.haveCountOf(1);
+    [managedObjectCache didFetchObject:humans[1]];
+    [managedObjectCache didFetchObject:humans[2]];
+
+    expect([managedObjectCache.entityCache containsObject:humans[0]]).will.equal(NO);
+    expect([managedObjectCache.entityCache containsObject:humans[2]]).to.equal(YES);
+    expect([managedObjectCache.entityCache isEntity:self.humanEntity cachedWithAttributeValues:@{ @"railsID": @1 }]).to.equal(NO);
+}
+
 @end
@@ -22,6 +22,20 @@
 @interface RKManagedObjectMappingOperationDataSourceTest : RKTestCase
 @end
 
+@interface RKLookupCountingManagedObjectCache : RKFetchRequestManagedObjectCache
+@property (nonatomic, assign) NSUInteger numberOfLookups;
+@end
+
+@implementation RKLookupCountingManagedObjectCache
+
+- (NSSet *)managedObjectsWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    self.numberOfLookups++;
+    return [super managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext];
+}
+
+@end
+
 /**
  NOTE: You need to take care that you allow the operationQueue to finish before the next test begins execution, else the Core Data tear down can result in intermittent test crashes.
  */
@@ -1533,6 +1547,38 @@
     expect([blake valueForKey:@"favoriteCat"]).to.equal((mapper.mappingResult.dictionary)[@"cat"]);
 }
 
+- (void)testConnectionsOfObjectsMappedByParentOperationAreEstablishedByASingleOperation
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKFetchRequestManagedObjectCache *managedObjectCache = [RKFetchRequestManagedObjectCache new];
+    RKManagedObjectMappingOperationDataSource *mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext
+                                                                                                                                                      cache:managedObjectCache];
+    NSOperationQueue *operationQueue = [NSOperationQueue new];
+    [operationQueue setSuspended:YES];
+    mappingOperationDataSource.operationQueue = operationQueue;
+
+    NSDictionary *representation = @{ @"humans": @[ @{ @"name": @"Blake Watters", @"favoriteCatID": @1 }, @{ @"name": @"Sarah", @"favoriteCatID": @2 }, @{ @"name": @"Jeff", @"favoriteCatID": @1 } ],
+                                      @"cats": @[ @{ @"railsID": @1 }, @{ @"railsID": @2 } ] };
+    RKEntityMapping *catMapping = [RKEntityMapping mappingForEntityForName:@"Cat" inManagedObjectStore:managedObjectStore];
+    catMapping.identificationAttributes = @[ @"railsID" ];
+    [catMapping addAttributeMappingsFromArray:@[ @"railsID" ]];
+    RKEntityMapping *humanMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [humanMapping addAttributeMappingsFromArray:@[ @"name", @"favoriteCatID" ]];
+    [humanMapping addConnectionForRelationship:@"favoriteCat" connectedBy:@{ @"favoriteCatID": @"railsID" }];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representation mappingsDictionary:@{ @"humans": humanMapping, @"cats": catMapping }];
+    mapper.mappingOperationDataSource = mappingOperationDataSource;
+    mappingOperationDataSource.parentOperation = mapper;
+    [mapper start];
+
+    expect([operationQueue operationCount]).to.equal(1);
+    [operationQueue setSuspended:NO];
+    [operationQueue waitUntilAllOperationsAreFinished];
+
+    NSArray *humans = (mapper.mappingResult.dictionary)[@"humans"];
+    NSArray *cats = (mapper.mappingResult.dictionary)[@"cats"];
+    expect([humans valueForKey:@"favoriteCat"]).to.equal(@[ cats[0], cats[1], cats[0] ]);
+}
+
 - (void)testDeletionOperationAfterManagedObjectContextIsDeallocated
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
@@ -1806,4 +1852,93 @@
     expect(canSkipMapping).to.equal(YES);
 }
 
+#pragma mark - Prefetching
+
+- (void)testPrefetchingResolvesExistingObjectsWithoutConsultingTheManagedObjectCache
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKLookupCountingManagedObjectCache *managedObjectCache = [RKLookupCountingManagedObjectCache new];
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    mapping.identificationAttributes = @[ @"railsID" ];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID", @"name": @"name" }];
+
+    NSMutableDictionary *existingHumans = [NSMutableDictionary dictionary];
+    for (NSNumber *railsID in @[ @1, @2, @3 ]) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+        human.railsID = railsID;
+        existingHumans[railsID] = human;
+    }
+    [managedObjectContext save:nil];
+
+    NSArray *representation = @[ @{ @"id": @1, @"name": @"Blake" }, @{ @"id": @"2", @"name": @"Sarah" }, @{ @"id": @3, @"name": @"Colin" }, @{ @"id": @4, @"name": @"Jeff" }, @{ @"id": @4, @"name": @"Jeff" } ];
+    NSDictionary *mappingsDictionary = @{ [NSNull null]: mapping };
+    RKManagedObjectMappingOperationDataSource *dataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectContext cache:managedObjectCache];
+    [dataSource prefetchManagedObjectsForRepresentation:representation withMappingsDictionary:mappingsDictionary];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representation mappingsDictionary:mappingsDictionary];
+    mapper.mappingOperationDataSource = dataSource;
+    [mapper start];
+
+    expect(mapper.error).to.beNil();
+    expect(managedObjectCache.numberOfLookups).to.equal(0);
+    NSArray *humans = [mapper.mappingResult array];
+    expect(humans[0]).to.equal(existingHumans[@1]);
+    expect(humans[1]).to.equal(existingHumans[@2]);
+    expect(humans[2]).to.equal(existingHumans[@3]);
+    expect([humans[1] name]).to.equal(@"Sarah");
+    expect(humans[4]).to.equal(humans[3]);
+    NSUInteger count = [managedObjectContext countForEntityForName:@"Human" predicate:nil error:nil];
+    expect(count).to.equal(4);
+}
+
+- (void)testPrefetchingIncludesTheRepresentationsOfNestedRelationships
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKLookupCountingManagedObjectCache *managedObjectCache = [RKLookupCountingManagedObjectCache new];
+    RKManagedObjectMappingOperationDataSource *dataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext
+                                                                                                                                      cache:managedObjectCache];
+
+    RKEntityMapping *childMapping = [RKEntityMapping mappingForEntityForName:@"Child" inManagedObjectStore:managedObjectStore];
+    childMapping.identificationAttributes = @[ @"childID" ];
+    [childMapping addAttributeMappingsFromArray:@[@"name", @"childID"]];
+
+    RKEntityMapping *parentMapping = [RKEntityMapping mappingForEntityForName:@"Parent" inManagedObjectStore:managedObjectStore];
+    [parentMapping addAttributeMappingsFromArray:@[@"parentID", @"name"]];
+    parentMapping.identificationAttributes = @[ @"parentID" ];
+    [parentMapping addRelationshipMappingWithSourceKeyPath:@"children" mapping:childMapping];
+
+    NSDictionary *mappingsDictionary = @{ @"parents": parentMapping };
+    NSDictionary *JSON = [RKTestFixture parsedObjectWithContentsOfFixture:@"parents_and_children.json"];
+    [dataSource prefetchManagedObjectsForRepresentation:JSON withMappingsDictionary:mappingsDictionary];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:JSON mappingsDictionary:mappingsDictionary];
+    mapper.mappingOperationDataSource = dataSource;
+    [mapper start];
+
+    expect(managedObjectCache.numberOfLookups).to.equal(0);
+    NSUInteger parentCount = [managedObjectStore.persistentStoreManagedObjectContext countForEntityForName:@"Parent" predicate:nil error:nil];
+    NSUInteger childrenCount = [managedObjectStore.persistentStoreManagedObjectContext countForEntityForName:@"Child" predicate:nil error:nil];
+    expect(parentCount).to.equal(2);
+    expect(childrenCount).to.equal(4);
+}
+
+- (void)testRepresentationsThatWereNotPrefetchedAreLookedUpInTheManagedObjectCache
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKLookupCountingManagedObjectCache *managedObjectCache = [RKLookupCountingManagedObjectCache new];
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    mapping.identificationAttributes = @[ @"railsID" ];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID" }];
+
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    human.railsID = @123;
+    [managedObjectContext save:nil];
+
+    RKManagedObjectMappingOperationDataSource *dataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectContext cache:managedObjectCache];
+    [dataSource prefetchManagedObjectsForRepresentation:@[ @{ @"id": @1 } ] withMappingsDictionary:@{ [NSNull null]: mapping }];
+    id object = [dataSource mappingOperation:nil targetObjectForRepresentation:@{ @"id": @123 } withMapping:mapping inRelationship:nil];
+    expect(object).to.equal(human);
+    expect(managedObjectCache.numberOfLookups).to.equal(1);
+}
+
 @end
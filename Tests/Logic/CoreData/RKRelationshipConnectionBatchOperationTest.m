@@ -0,0 +1,187 @@
+//
+//  RKRelationshipConnectionBatchOperationTest.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKHuman.h"
+#import "RKCat.h"
+#import "RKRelationshipConnectionBatchOperation.h"
+#import "RKFetchRequestManagedObjectCache.h"
+#import "RKInMemoryManagedObjectCache.h"
+
+@interface RKCountingFetchRequestManagedObjectCache : RKFetchRequestManagedObjectCache
+@property (nonatomic, assign) NSUInteger numberOfLookups;
+@end
+
+@implementation RKCountingFetchRequestManagedObjectCache
+
+- (NSSet *)managedObjectsWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    self.numberOfLookups++;
+    return [super managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext];
+}
+
+@end
+
+@interface RKCountingInMemoryManagedObjectCache : RKInMemoryManagedObjectCache
+@property (nonatomic, assign) NSUInteger numberOfLookups;
+@end
+
+@implementation RKCountingInMemoryManagedObjectCache
+
+- (NSSet *)managedObjectsWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    self.numberOfLookups++;
+    return [super managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext];
+}
+
+@end
+
+@interface RKRelationshipConnectionBatchOperationTest : XCTestCase
+
+@end
+
+@implementation RKRelationshipConnectionBatchOperationTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+}
+
+- (void)tearDown
+{
+    [RKTestFactory tearDown];
+}
+
+- (void)testConnectingToOneRelationshipsOfManyObjectsWithASingleFetch
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [mapping addConnectionForRelationship:@"favoriteCat" connectedBy:@{ @"favoriteCatID": @"railsID" }];
+    RKConnectionDescription *connection = [mapping connectionForRelationship:@"favoriteCat"];
+
+    RKCountingFetchRequestManagedObjectCache *managedObjectCache = [RKCountingFetchRequestManagedObjectCache new];
+    RKRelationshipConnectionBatchOperation *operation = [[RKRelationshipConnectionBatchOperation alloc] initWithManagedObjectContext:managedObjectContext managedObjectCache:managedObjectCache];
+    NSMutableArray *humans = [NSMutableArray array];
+    NSMutableArray *cats = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 20; index++) {
+        RKCat *cat = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @(index) }];
+        // Every cat is the favorite of two humans
+        for (NSUInteger count = 0; count < 2; count++) {
+            RKHuman *human = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"favoriteCatID": @(index) }];
+            [operation addManagedObject:human connections:@[ connection ] connectionBlock:nil];
+            [humans addObject:human];
+            [cats addObject:cat];
+        }
+    }
+    expect(operation.managedObjectCount).to.equal(40);
+    [operation start];
+
+    expect(managedObjectCache.numberOfLookups).to.equal(0);
+    [humans enumerateObjectsUsingBlock:^(RKHuman *human, NSUInteger idx, BOOL *stop) {
+        expect(human.favoriteCat).to.equal(cats[idx]);
+    }];
+}
+
+- (void)testConnectingToManyRelationshipByArrayOfIdentifiers
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [mapping addConnectionForRelationship:@"cats" connectedBy:@{ @"catIDs": @"railsID" }];
+    RKConnectionDescription *connection = [mapping connectionForRelationship:@"cats"];
+
+    RKCat *asia = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @1 }];
+    RKCat *lola = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @2 }];
+    RKCat *roy = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @3 }];
+    RKHuman *blake = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"catIDs": @[ @1, @2 ] }];
+    RKHuman *sarah = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"catIDs": @[ @2, @3, @4 ] }];
+
+    RKCountingFetchRequestManagedObjectCache *managedObjectCache = [RKCountingFetchRequestManagedObjectCache new];
+    RKRelationshipConnectionBatchOperation *operation = [[RKRelationshipConnectionBatchOperation alloc] initWithManagedObjectContext:managedObjectContext managedObjectCache:managedObjectCache];
+    [operation addManagedObject:blake connections:@[ connection ] connectionBlock:nil];
+    [operation addManagedObject:sarah connections:@[ connection ] connectionBlock:nil];
+    [operation start];
+
+    expect(managedObjectCache.numberOfLookups).to.equal(0);
+    expect(blake.cats).to.equal([NSSet setWithObjects:asia, lola, nil]);
+    expect(sarah.cats).to.equal([NSSet setWithObjects:lola, roy, nil]);
+}
+
+- (void)testConnectingWithStringForeignKeyToNumericDestinationAttribute
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [mapping addConnectionForRelationship:@"favoriteCat" connectedBy:@{ @"name": @"railsID" }];
+    RKConnectionDescription *connection = [mapping connectionForRelationship:@"favoriteCat"];
+
+    RKCat *asia = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @12345 }];
+    RKHuman *blake = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"name": @"12345" }];
+
+    RKRelationshipConnectionBatchOperation *operation = [[RKRelationshipConnectionBatchOperation alloc] initWithManagedObjectContext:managedObjectContext managedObjectCache:[RKFetchRequestManagedObjectCache new]];
+    [operation addManagedObject:blake connections:@[ connection ] connectionBlock:nil];
+    [operation start];
+
+    expect(blake.favoriteCat).to.equal(asia);
+}
+
+- (void)testConnectionWithAnotherCacheQueriesOncePerDistinctForeignKey
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [mapping addConnectionForRelationship:@"favoriteCat" connectedBy:@{ @"favoriteCatID": @"railsID" }];
+    RKConnectionDescription *connection = [mapping connectionForRelationship:@"favoriteCat"];
+
+    RKCat *asia = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @1 }];
+    RKCat *lola = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @2 }];
+    [managedObjectContext save:nil];
+    RKCountingInMemoryManagedObjectCache *managedObjectCache = [[RKCountingInMemoryManagedObjectCache alloc] initWithManagedObjectContext:managedObjectContext];
+    RKRelationshipConnectionBatchOperation *operation = [[RKRelationshipConnectionBatchOperation alloc] initWithManagedObjectContext:managedObjectContext managedObjectCache:managedObjectCache];
+    NSMutableArray *humans = [NSMutableArray array];
+    for (NSNumber *catID in @[ @1, @2, @1, @2, @1 ]) {
+        RKHuman *human = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"favoriteCatID": catID }];
+        [operation addManagedObject:human connections:@[ connection ] connectionBlock:nil];
+        [humans addObject:human];
+    }
+    [operation start];
+
+    expect(managedObjectCache.numberOfLookups).to.equal(2);
+    expect([humans valueForKey:@"favoriteCat"]).to.equal(@[ asia, lola, asia, lola, asia ]);
+}
+
+- (void)testConnectionBlockIsInvokedForEachConnection
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [mapping addConnectionForRelationship:@"favoriteCat" connectedBy:@{ @"favoriteCatID": @"railsID" }];
+    RKConnectionDescription *connection = [mapping connectionForRelationship:@"favoriteCat"];
+
+    RKCat *asia = [RKTestFactory insertManagedObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @1 }];
+    RKHuman *blake = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"favoriteCatID": @1 }];
+    RKHuman *sarah = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"favoriteCatID": @2 }];
+    RKHuman *jeff = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:nil];
+
+    RKRelationshipConnectionBatchOperation *operation = [[RKRelationshipConnectionBatchOperation alloc] initWithManagedObjectContext:managedObjectContext managedObjectCache:[RKFetchRequestManagedObjectCache new]];
+    NSMutableDictionary *connectedValues = [NSMutableDictionary dictionary];
+    for (RKHuman *human in @[ blake, sarah, jeff ]) {
+        [operation addManagedObject:human connections:@[ connection ] connectionBlock:^(RKConnectionDescription *connection, id connectedValue) {
+            connectedValues[[[human objectID] URIRepresentation]] = connectedValue ?: [NSNull null];
+        }];
+    }
+    [operation start];
+
+    // Objects without a foreign key are not connected
+    expect(connectedValues).to.haveCountOf(2);
+    expect(connectedValues[[[blake objectID] URIRepresentation]]).to.equal(asia);
+    expect(connectedValues[[[sarah objectID] URIRepresentation]]).to.equal([NSNull null]);
+    expect(sarah.favoriteCat).to.beNil();
+}
+
+@end
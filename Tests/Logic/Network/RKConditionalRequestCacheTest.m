@@ -0,0 +1,175 @@
+//
+//  RKConditionalRequestCacheTest.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKConditionalRequestCache.h"
+#import "RKManagedObjectRequestOperation.h"
+#import "RKEntityMapping.h"
+#import "RKHuman.h"
+#import "RKTestUser.h"
+
+@interface RKConditionalRequestCacheTest : RKTestCase
+@end
+
+@implementation RKConditionalRequestCacheTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+}
+
+- (void)tearDown
+{
+    [RKTestFactory tearDown];
+}
+
+- (NSHTTPURLResponse *)responseWithStatusCode:(NSInteger)statusCode headers:(NSDictionary *)headers
+{
+    return [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"http://restkit.org/humans"] statusCode:statusCode HTTPVersion:@"1.1" headerFields:headers];
+}
+
+- (NSURLRequest *)request
+{
+    return [NSURLRequest requestWithURL:[NSURL URLWithString:@"http://restkit.org/humans"]];
+}
+
+- (RKResponseDescriptor *)responseDescriptor
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    return [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:@"human" statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+}
+
+#pragma mark - Cache
+
+- (void)testThatConditionalRequestContainsTheValidatorsOfTheStoredResponse
+{
+    RKConditionalRequestCache *cache = [RKConditionalRequestCache new];
+    NSArray *responseDescriptors = @[ [self responseDescriptor] ];
+    RKMappingResult *mappingResult = [[RKMappingResult alloc] initWithDictionary:@{ @"human": [RKTestUser new] }];
+    [cache storeMappingResult:mappingResult forRequest:[self request] response:[self responseWithStatusCode:200 headers:@{ @"ETag": @"\"1234\"", @"Last-Modified": @"Mon, 01 Oct 2012 00:00:00 GMT" }] responseDescriptors:responseDescriptors];
+
+    NSURLRequest *conditionalRequest = [cache conditionalRequestForRequest:[self request] responseDescriptors:responseDescriptors];
+    expect([conditionalRequest valueForHTTPHeaderField:@"If-None-Match"]).to.equal(@"\"1234\"");
+    expect([conditionalRequest valueForHTTPHeaderField:@"If-Modified-Since"]).to.equal(@"Mon, 01 Oct 2012 00:00:00 GMT");
+    expect([cache mappingResultForRequest:conditionalRequest responseDescriptors:responseDescriptors]).to.beIdenticalTo(mappingResult);
+}
+
+- (void)testThatEntriesAreScopedToTheResponseDescriptors
+{
+    RKConditionalRequestCache *cache = [RKConditionalRequestCache new];
+    RKMappingResult *mappingResult = [[RKMappingResult alloc] initWithDictionary:@{}];
+    [cache storeMappingResult:mappingResult forRequest:[self request] response:[self responseWithStatusCode:200 headers:@{ @"ETag": @"\"1234\"" }] responseDescriptors:@[ [self responseDescriptor] ]];
+    expect([cache conditionalRequestForRequest:[self request] responseDescriptors:@[ [self responseDescriptor] ]]).to.beNil();
+}
+
+- (void)testThatResponsesWithoutValidatorsAreNotStored
+{
+    RKConditionalRequestCache *cache = [RKConditionalRequestCache new];
+    NSArray *responseDescriptors = @[ [self responseDescriptor] ];
+    RKMappingResult *mappingResult = [[RKMappingResult alloc] initWithDictionary:@{}];
+    [cache storeMappingResult:mappingResult forRequest:[self request] response:[self responseWithStatusCode:200 headers:@{}] responseDescriptors:responseDescriptors];
+    expect([cache conditionalRequestForRequest:[self request] responseDescriptors:responseDescriptors]).to.beNil();
+
+    [cache storeMappingResult:mappingResult forRequest:[self request] response:[self responseWithStatusCode:203 headers:@{ @"ETag": @"\"1234\"" }] responseDescriptors:responseDescriptors];
+    expect([cache conditionalRequestForRequest:[self request] responseDescriptors:responseDescriptors]).to.beNil();
+}
+
+- (void)testThatRequestsWithCallerSuppliedValidatorsAreLeftAlone
+{
+    RKConditionalRequestCache *cache = [RKConditionalRequestCache new];
+    NSArray *responseDescriptors = @[ [self responseDescriptor] ];
+    RKMappingResult *mappingResult = [[RKMappingResult alloc] initWithDictionary:@{}];
+    [cache storeMappingResult:mappingResult forRequest:[self request] response:[self responseWithStatusCode:200 headers:@{ @"ETag": @"\"1234\"" }] responseDescriptors:responseDescriptors];
+
+    NSMutableURLRequest *request = [[self request] mutableCopy];
+    [request setValue:@"\"5678\"" forHTTPHeaderField:@"If-None-Match"];
+    expect([cache conditionalRequestForRequest:request responseDescriptors:responseDescriptors]).to.beNil();
+    expect([cache mappingResultForRequest:request responseDescriptors:responseDescriptors]).to.beNil();
+}
+
+#pragma mark - Object Request Operations
+
+- (RKObjectRequestOperation *)objectRequestOperationWithPath:(NSString *)path responseDescriptors:(NSArray *)responseDescriptors cache:(RKConditionalRequestCache *)cache
+{
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:path relativeToURL:[RKTestFactory baseURL]]];
+    request.cachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
+    RKObjectRequestOperation *operation = [[RKObjectRequestOperation alloc] initWithRequest:request responseDescriptors:responseDescriptors];
+    operation.conditionalRequestCache = cache;
+    return operation;
+}
+
+- (void)testThatNotModifiedResponseReturnsPreviouslyMappedResultForEntityTag
+{
+    RKConditionalRequestCache *cache = [RKConditionalRequestCache new];
+    NSArray *responseDescriptors = @[ [self responseDescriptor] ];
+    RKObjectRequestOperation *firstOperation = [self objectRequestOperationWithPath:@"/coredata/etag" responseDescriptors:responseDescriptors cache:cache];
+    [firstOperation start];
+    expect([firstOperation isFinished]).will.beTruthy();
+    expect(firstOperation.HTTPRequestOperation.response.statusCode).to.equal(200);
+    expect([firstOperation.mappingResult count]).to.equal(2);
+
+    RKObjectRequestOperation *secondOperation = [self objectRequestOperationWithPath:@"/coredata/etag" responseDescriptors:responseDescriptors cache:cache];
+    [secondOperation start];
+    expect([secondOperation isFinished]).will.beTruthy();
+    expect(secondOperation.error).to.beNil();
+    expect(secondOperation.HTTPRequestOperation.response.statusCode).to.equal(304);
+    expect(secondOperation.mappingResult).to.beIdenticalTo(firstOperation.mappingResult);
+}
+
+- (void)testThatNotModifiedResponseReturnsPreviouslyMappedResultForLastModifiedDate
+{
+    RKConditionalRequestCache *cache = [RKConditionalRequestCache new];
+    NSArray *responseDescriptors = @[ [self responseDescriptor] ];
+    RKObjectRequestOperation *firstOperation = [self objectRequestOperationWithPath:@"/conditional/last_modified" responseDescriptors:responseDescriptors cache:cache];
+    [firstOperation start];
+    expect([firstOperation isFinished]).will.beTruthy();
+
+    RKObjectRequestOperation *secondOperation = [self objectRequestOperationWithPath:@"/conditional/last_modified" responseDescriptors:responseDescriptors cache:cache];
+    [secondOperation start];
+    expect([secondOperation isFinished]).will.beTruthy();
+    expect([secondOperation.HTTPRequestOperation.request valueForHTTPHeaderField:@"If-Modified-Since"]).notTo.beNil();
+    expect(secondOperation.HTTPRequestOperation.response.statusCode).to.equal(304);
+    expect([[secondOperation.mappingResult firstObject] name]).to.equal(@"Blake Watters");
+}
+
+- (void)testThatNotModifiedResponseReturnsPreviouslyMappedManagedObjects
+{
+    RKConditionalRequestCache *cache = [RKConditionalRequestCache new];
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKEntityMapping *humanMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [humanMapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID", @"name": @"name" }];
+    humanMapping.identificationAttributes = @[ @"railsID" ];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:humanMapping method:RKRequestMethodAny pathPattern:nil keyPath:@"human" statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+
+    RKManagedObjectRequestOperation *(^managedObjectRequestOperation)(void) = ^{
+        NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"/coredata/etag" relativeToURL:[RKTestFactory baseURL]]];
+        request.cachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
+        RKManagedObjectRequestOperation *operation = [[RKManagedObjectRequestOperation alloc] initWithRequest:request responseDescriptors:@[ responseDescriptor ]];
+        operation.managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+        operation.managedObjectCache = managedObjectStore.managedObjectCache;
+        operation.conditionalRequestCache = cache;
+        return operation;
+    };
+
+    RKManagedObjectRequestOperation *firstOperation = managedObjectRequestOperation();
+    [firstOperation start];
+    expect([firstOperation isFinished]).will.beTruthy();
+    NSSet *objectIDs = [NSSet setWithArray:[[firstOperation.mappingResult array] valueForKey:@"objectID"]];
+    expect(objectIDs).to.haveCountOf(2);
+
+    RKManagedObjectRequestOperation *secondOperation = managedObjectRequestOperation();
+    [secondOperation start];
+    expect([secondOperation isFinished]).will.beTruthy();
+    expect(secondOperation.error).to.beNil();
+    expect(secondOperation.HTTPRequestOperation.response.statusCode).to.equal(304);
+    NSArray *objects = [secondOperation.mappingResult array];
+    expect([NSSet setWithArray:[objects valueForKey:@"objectID"]]).to.equal(objectIDs);
+    expect([[objects firstObject] managedObjectContext]).to.equal(managedObjectStore.persistentStoreManagedObjectContext);
+}
+
+@end
@@ -0,0 +1,113 @@
+//
+//  RKHTTPClientTest.m
+//  RestKit
+//
+//  Copyright (c) 2015 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKHTTPClient.h"
+#import "RKObjectManager.h"
+#import "RKBenchmark.h"
+
+@interface RKHTTPClientTest : RKTestCase
+@end
+
+@implementation RKHTTPClientTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+}
+
+- (void)tearDown
+{
+    [RKTestFactory tearDown];
+}
+
+- (void)testThatClientDoesNotUseTheSharedSession
+{
+    RKHTTPClient *client = [RKHTTPClient clientWithBaseURL:[RKTestFactory baseURL]];
+    expect(client.session).notTo.beNil();
+    expect(client.session).notTo.equal([NSURLSession sharedSession]);
+}
+
+- (void)testThatEachClientOwnsItsSessionAndDelegateQueue
+{
+    RKHTTPClient *client1 = [RKHTTPClient clientWithBaseURL:[RKTestFactory baseURL]];
+    RKHTTPClient *client2 = [RKHTTPClient clientWithBaseURL:[RKTestFactory baseURL]];
+    expect(client1.session).notTo.equal(client2.session);
+    expect(client1.delegateQueue).notTo.equal(client2.delegateQueue);
+    expect(client1.session.delegateQueue).to.equal(client1.delegateQueue);
+}
+
+- (void)testThatSessionIsBuiltFromTheSessionConfiguration
+{
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.HTTPMaximumConnectionsPerHost = 2;
+    configuration.timeoutIntervalForRequest = 12;
+    configuration.requestCachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
+    RKHTTPClient *client = [[RKHTTPClient alloc] initWithBaseURL:[RKTestFactory baseURL] sessionConfiguration:configuration];
+    expect(client.session.configuration.HTTPMaximumConnectionsPerHost).to.equal(2);
+    expect(client.session.configuration.timeoutIntervalForRequest).to.equal(12);
+    expect(client.session.configuration.requestCachePolicy).to.equal(NSURLRequestReloadIgnoringLocalCacheData);
+}
+
+- (void)testThatPerformRequestRunsTheTaskOnTheClientSession
+{
+    RKHTTPClient *client = [RKHTTPClient clientWithBaseURL:[RKTestFactory baseURL]];
+    __block id blockResponseObject = nil;
+    NSURLSessionDataTask *task = [client performRequest:[client requestWithMethod:@"GET" path:@"/" parameters:nil] completionHandler:^(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error) {
+        blockResponseObject = responseObject;
+    }];
+    expect(task).notTo.beNil();
+    expect(blockResponseObject).willNot.beNil();
+    expect(blockResponseObject[@"status"]).to.equal(@"ok");
+}
+
+- (void)testThatInvalidatingTheSessionCancelsPendingTasks
+{
+    RKHTTPClient *client = [RKHTTPClient clientWithBaseURL:[RKTestFactory baseURL]];
+    __block NSError *blockError = nil;
+    [client performRequest:[client requestWithMethod:@"GET" path:@"/timeout" parameters:nil] completionHandler:^(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error) {
+        blockError = error;
+    }];
+    [client invalidateSessionCancelingTasks:YES];
+    expect(blockError).willNot.beNil();
+    expect([blockError code]).to.equal(NSURLErrorCancelled);
+}
+
+- (void)testConcurrentManagersThroughputAgainstTheLoopbackServer
+{
+    NSUInteger const managerCount = 8;
+    NSUInteger const requestsPerManager = 25;
+    NSMutableArray *clients = [NSMutableArray arrayWithCapacity:managerCount];
+    for (NSUInteger i = 0; i < managerCount; i++) {
+        NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration defaultSessionConfiguration];
+        configuration.HTTPMaximumConnectionsPerHost = 4;
+        configuration.requestCachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
+        [clients addObject:[[RKHTTPClient alloc] initWithBaseURL:[RKTestFactory baseURL] sessionConfiguration:configuration]];
+    }
+
+    __block NSUInteger completedCount = 0;
+    dispatch_group_t group = dispatch_group_create();
+    [RKBenchmark report:@"Concurrent Managers Against the Loopback Server" executionBlock:^{
+        for (RKHTTPClient *client in clients) {
+            for (NSUInteger i = 0; i < requestsPerManager; i++) {
+                dispatch_group_enter(group);
+                [client performRequest:[client requestWithMethod:@"GET" path:@"/JSON/humans/all.json" parameters:nil] completionHandler:^(id responseObject, NSData *responseData, NSURLResponse *response, NSError *error) {
+                    if (!error) {
+                        @synchronized(clients) {
+                            completedCount++;
+                        }
+                    }
+                    dispatch_group_leave(group);
+                }];
+            }
+        }
+        dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, 30 * NSEC_PER_SEC));
+    }];
+    expect(completedCount).to.equal(managerCount * requestsPerManager);
+}
+
+@end
@@ -169,6 +169,57 @@ NSSet *RKSetByRemovingSubkeypathsFromSet(NSSet *setOfKeyPaths);
     expect(managedObjectContexts).to.equal(@[managedObjectStore.mainQueueManagedObjectContext]);
 }
 
+- (void)testThatMappingResultIsRefetchedWithPrefetchedRelationshipKeyPaths
+{
+    NSURLRequest *request = [NSURLRequest requestWithURL:[NSURL URLWithString:@"/JSON/humans/all.json" relativeToURL:[RKTestFactory baseURL]]];
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKEntityMapping *catMapping = [RKEntityMapping mappingForEntityForName:@"Cat" inManagedObjectStore:managedObjectStore];
+    [catMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKEntityMapping *humanMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [humanMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [humanMapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"favorite_cat" toKeyPath:@"favoriteCat" withMapping:catMapping]];
+
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:humanMapping method:RKRequestMethodAny pathPattern:nil keyPath:@"human" statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+    RKManagedObjectRequestOperation *managedObjectRequestOperation = [[RKManagedObjectRequestOperation alloc] initWithRequest:request responseDescriptors:@[responseDescriptor]];
+    managedObjectRequestOperation.managedObjectContext = managedObjectStore.mainQueueManagedObjectContext;
+    managedObjectRequestOperation.relationshipKeyPathsForPrefetchingByEntityName = @{ @"Human": @[ @"favoriteCat" ] };
+
+    [managedObjectRequestOperation start];
+    expect([managedObjectRequestOperation isFinished]).will.beTruthy();
+    NSArray *humans = [managedObjectRequestOperation.mappingResult array];
+    expect(humans).to.haveCountOf(2);
+    for (RKHuman *human in humans) {
+        expect(human.managedObjectContext).to.equal(managedObjectStore.mainQueueManagedObjectContext);
+        expect([human isFault]).to.beFalsy();
+    }
+    RKHuman *blake = [[humans filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"name = %@", @"Blake Watters"]] lastObject];
+    expect([blake.favoriteCat isFault]).to.beFalsy();
+    expect(blake.favoriteCat.name).to.equal(@"Asia");
+}
+
+- (void)testThatMappingResultCanBeRefetchedAsFaults
+{
+    NSURLRequest *request = [NSURLRequest requestWithURL:[NSURL URLWithString:@"/JSON/humans/all.json" relativeToURL:[RKTestFactory baseURL]]];
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKEntityMapping *humanMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [humanMapping addAttributeMappingsFromArray:@[ @"name" ]];
+
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:humanMapping method:RKRequestMethodAny pathPattern:nil keyPath:@"human" statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+    RKManagedObjectRequestOperation *managedObjectRequestOperation = [[RKManagedObjectRequestOperation alloc] initWithRequest:request responseDescriptors:@[responseDescriptor]];
+    managedObjectRequestOperation.managedObjectContext = managedObjectStore.mainQueueManagedObjectContext;
+    managedObjectRequestOperation.refetchesMappedObjectsAsFaults = YES;
+
+    [managedObjectRequestOperation start];
+    expect([managedObjectRequestOperation isFinished]).will.beTruthy();
+    NSArray *humans = [managedObjectRequestOperation.mappingResult array];
+    expect(humans).to.haveCountOf(2);
+    for (RKHuman *human in humans) {
+        expect(human.managedObjectContext).to.equal(managedObjectStore.mainQueueManagedObjectContext);
+    }
+    // Faults are fired when accessed
+    expect([[humans valueForKey:@"name"] sortedArrayUsingSelector:@selector(compare:)]).to.equal(@[ @"Blake Watters", @"Other" ]);
+}
+
 // 304 'Not Modified'
 - (void)testThatManagedObjectsAreFetchedWhenHandlingAResponseThatCanSkipMapping
 {
@@ -654,6 +705,38 @@ NSSet *RKSetByRemovingSubkeypathsFromSet(NSSet *setOfKeyPaths);
     expect(orphanedHuman.managedObjectContext).to.beNil();
 }
 
+- (void)testDeletionOfOrphanedManagedObjectsInBatchesReportsStatistics
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    for (NSUInteger index = 0; index < 1200; index++) {
+        [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @(index) }];
+    }
+    [managedObjectContext save:nil];
+
+    RKEntityMapping *entityMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [entityMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:entityMapping method:RKRequestMethodAny pathPattern:nil keyPath:@"human" statusCodes:[NSIndexSet indexSetWithIndex:200]];
+
+    NSURLRequest *request = [NSURLRequest requestWithURL:[NSURL URLWithString:@"/JSON/humans/with_to_one_relationship.json" relativeToURL:[RKTestFactory baseURL]]];
+    RKManagedObjectRequestOperation *managedObjectRequestOperation = [[RKManagedObjectRequestOperation alloc] initWithRequest:request responseDescriptors:@[ responseDescriptor ]];
+    RKFetchRequestBlock fetchRequestBlock = ^NSFetchRequest * (NSURL *URL) {
+        return [NSFetchRequest fetchRequestWithEntityName:@"Human"];
+    };
+    managedObjectRequestOperation.fetchRequestBlocks = @[ fetchRequestBlock ];
+    managedObjectRequestOperation.managedObjectContext = managedObjectContext;
+    [managedObjectRequestOperation start];
+    [managedObjectRequestOperation waitUntilFinished];
+    expect(managedObjectRequestOperation.error).to.beNil();
+
+    // The mapped human survives while every saved human is deleted
+    expect(managedObjectRequestOperation.numberOfScannedOrphanCandidates).to.equal(1201);
+    expect(managedObjectRequestOperation.numberOfDeletedOrphanedObjects).to.equal(1200);
+    expect(managedObjectRequestOperation.orphanedObjectDeletionTime).to.beGreaterThan(0);
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"Human"];
+    expect([managedObjectContext countForFetchRequest:fetchRequest error:nil]).to.equal(1);
+}
+
 - (void)testDeletionOfOrphanedObjectsMappedOnRelationships
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
@@ -1421,6 +1504,17 @@ NSSet *RKSetByRemovingSubkeypathsFromSet(NSSet *setOfKeyPaths);
     expect(human.nickName).to.equal(@"Big Sleezy");
 }
 
+- (void)testCopyingOperationCopiesRefetchingConfiguration
+{
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"/humans/1" relativeToURL:[RKTestFactory baseURL]]];
+    RKManagedObjectRequestOperation *managedObjectRequestOperation = [[RKManagedObjectRequestOperation alloc] initWithRequest:request responseDescriptors:@[]];
+    managedObjectRequestOperation.relationshipKeyPathsForPrefetchingByEntityName = @{ @"Human": @[ @"cats" ] };
+    managedObjectRequestOperation.refetchesMappedObjectsAsFaults = YES;
+    RKManagedObjectRequestOperation *copiedOperation = [managedObjectRequestOperation copy];
+    expect(copiedOperation.relationshipKeyPathsForPrefetchingByEntityName).to.equal(@{ @"Human": @[ @"cats" ] });
+    expect(copiedOperation.refetchesMappedObjectsAsFaults).to.equal(YES);
+}
+
 - (void)testThatManuallyCreatedObjectsAreNotDuplicatedWhenMappedWithInMemoryManagedObjectCache
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
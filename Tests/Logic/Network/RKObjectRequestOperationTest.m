@@ -8,6 +8,8 @@
 
 #import "RKTestEnvironment.h"
 #import "RKErrorMessage.h"
+#import "RKBenchmark.h"
+#import "RKTestUser.h"
 
 // Models
 #import "RKObjectLoaderTestResultModel.h"
@@ -22,6 +24,10 @@
 
 @end
 
+@interface RKObjectRequestOperation ()
++ (void)enqueueResponseMapperOperation:(NSOperation *)responseMapperOperation serializedWithKey:(id)key;
+@end
+
 @interface RKMapperTestObjectRequestOperation : RKObjectRequestOperation
 @end
 
@@ -200,6 +206,27 @@
     expect([objects[1] photoURL]).to.equal(@"1308634984.jpg");
 }
 
+- (void)testShouldLoadResultsNestedAtAKeyPathIncrementally
+{
+    RKObjectMapping *objectMapping = [RKObjectMapping mappingForClass:[RKObjectLoaderTestResultModel class]];
+    [objectMapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"id" toKeyPath:@"ID"]];
+    [objectMapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"photo_url" toKeyPath:@"photoURL"]];
+
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:objectMapping method:RKRequestMethodAny pathPattern:nil keyPath:@"results" statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"/JSON/ArrayOfResults.json" relativeToURL:[RKTestFactory baseURL]]];
+    RKObjectRequestOperation *requestOperation = [[RKObjectRequestOperation alloc] initWithRequest:request responseDescriptors:@[ responseDescriptor ]];
+    requestOperation.mapsResponseIncrementally = YES;
+    [requestOperation start];
+    expect([requestOperation isFinished]).will.beTruthy();
+
+    expect(requestOperation.error).to.beNil();
+    NSArray *objects = [requestOperation.mappingResult array];
+    expect(objects).to.haveCountOf(2);
+    expect([objects[0] ID]).to.equal(226);
+    expect([objects[1] ID]).to.equal(235);
+    expect(requestOperation.HTTPRequestOperation.responseString).to.contain(@"1308262872.jpg");
+}
+
 - (void)testShouldAllowYouToPostAnObjectAndHandleAnEmpty204Response
 {
     RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestComplexUser class]];
@@ -907,4 +934,81 @@
     [[RKObjectRequestOperation responseMappingQueue] setSuspended:NO];
 }
 
+#pragma mark - Response Mapping Queue
+
+- (void)testThatResponseMappingQueueIsConcurrentByDefault
+{
+    expect([[RKObjectRequestOperation responseMappingQueue] maxConcurrentOperationCount]).to.equal([[NSProcessInfo processInfo] activeProcessorCount]);
+}
+
+- (void)testThatResponseMapperOperationsSharingAKeyAreSerializedInOrder
+{
+    NSOperationQueue *responseMappingQueue = [RKObjectRequestOperation responseMappingQueue];
+    NSObject *firstContext = [NSObject new];
+    NSObject *secondContext = [NSObject new];
+    NSMutableArray *executionOrder = [NSMutableArray array];
+    NSOperation *(^operationWithName)(NSString *) = ^(NSString *name) {
+        return [NSBlockOperation blockOperationWithBlock:^{
+            [NSThread sleepForTimeInterval:0.01];
+            @synchronized(executionOrder) {
+                [executionOrder addObject:name];
+            }
+        }];
+    };
+    NSOperation *first = operationWithName(@"first");
+    NSOperation *second = operationWithName(@"second");
+    NSOperation *third = operationWithName(@"third");
+    NSOperation *unrelated = operationWithName(@"unrelated");
+
+    [responseMappingQueue setSuspended:YES];
+    [RKObjectRequestOperation enqueueResponseMapperOperation:first serializedWithKey:firstContext];
+    [RKObjectRequestOperation enqueueResponseMapperOperation:second serializedWithKey:firstContext];
+    [RKObjectRequestOperation enqueueResponseMapperOperation:unrelated serializedWithKey:secondContext];
+    [RKObjectRequestOperation enqueueResponseMapperOperation:third serializedWithKey:firstContext];
+    expect([second dependencies]).to.equal(@[ first ]);
+    expect([third dependencies]).to.equal(@[ second ]);
+    expect([unrelated dependencies]).to.beEmpty();
+    [responseMappingQueue setSuspended:NO];
+
+    expect([third isFinished] && [unrelated isFinished]).will.beTruthy();
+    NSArray *contextOrder = [executionOrder filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"SELF != 'unrelated'"]];
+    expect(contextOrder).to.equal((@[ @"first", @"second", @"third" ]));
+}
+
+- (void)testResponseMappingThroughputScalesWithConcurrency
+{
+    NSMutableArray *users = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 500; i++) {
+        [users addObject:@{ @"name": [NSString stringWithFormat:@"User %lu", (unsigned long)i], @"emailAddress": @"user@restkit.org", @"country": @"USA", @"luckyNumber": @(i) }];
+    }
+    NSData *data = [NSJSONSerialization dataWithJSONObject:users options:0 error:nil];
+    NSURL *responseURL = [NSURL URLWithString:@"http://restkit.org/api/v1/users"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:responseURL];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:responseURL statusCode:200 HTTPVersion:@"1.1" headerFields:@{@"Content-Type": @"application/json"}];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name", @"emailAddress", @"country", @"luckyNumber" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:nil statusCodes:[NSIndexSet indexSetWithIndex:200]];
+
+    NSOperationQueue *responseMappingQueue = [RKObjectRequestOperation responseMappingQueue];
+    NSInteger maxConcurrentOperationCount = [responseMappingQueue maxConcurrentOperationCount];
+    NSUInteger responseCount = 32;
+    for (NSUInteger concurrency = 1; concurrency <= [[NSProcessInfo processInfo] activeProcessorCount]; concurrency *= 2) {
+        [responseMappingQueue setMaxConcurrentOperationCount:concurrency];
+        NSMutableArray *mapperOperations = [NSMutableArray array];
+        for (NSUInteger i = 0; i < responseCount; i++) {
+            [mapperOperations addObject:[[RKObjectResponseMapperOperation alloc] initWithRequest:request response:response data:data responseDescriptors:@[ responseDescriptor ]]];
+        }
+        [RKBenchmark report:[NSString stringWithFormat:@"Mapping %lu Responses with %lu Concurrent Operations", (unsigned long)responseCount, (unsigned long)concurrency] executionBlock:^{
+            for (NSOperation *mapperOperation in mapperOperations) {
+                [RKObjectRequestOperation enqueueResponseMapperOperation:mapperOperation serializedWithKey:nil];
+            }
+            [responseMappingQueue waitUntilAllOperationsAreFinished];
+        }];
+        for (RKObjectResponseMapperOperation *mapperOperation in mapperOperations) {
+            expect([mapperOperation.mappingResult count]).to.equal(500);
+        }
+    }
+    [responseMappingQueue setMaxConcurrentOperationCount:maxConcurrentOperationCount];
+}
+
 @end
@@ -0,0 +1,177 @@
+//
+//  RKResponseDescriptorIndexTest.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKResponseDescriptorIndex.h"
+#import "RKTestUser.h"
+#import "RKBenchmark.h"
+
+@interface RKResponseDescriptorIndexTest : RKTestCase
+@end
+
+@implementation RKResponseDescriptorIndexTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+}
+
+- (void)tearDown
+{
+    [RKTestFactory tearDown];
+}
+
+- (RKResponseDescriptor *)responseDescriptorWithMethod:(RKRequestMethod)method pathPattern:(NSString *)pathPattern keyPath:(NSString *)keyPath
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    return [RKResponseDescriptor responseDescriptorWithMapping:mapping method:method pathPattern:pathPattern keyPath:keyPath statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+}
+
+- (NSHTTPURLResponse *)responseWithURLString:(NSString *)URLString statusCode:(NSInteger)statusCode
+{
+    return [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:URLString] statusCode:statusCode HTTPVersion:@"1.1" headerFields:@{}];
+}
+
+- (NSArray *)responseDescriptors
+{
+    NSURL *baseURL = [NSURL URLWithString:@"http://restkit.org/api/"];
+    NSArray *responseDescriptors = @[ [self responseDescriptorWithMethod:RKRequestMethodAny pathPattern:nil keyPath:@"any"],
+                                      [self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:@"/users" keyPath:@"users"],
+                                      [self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:@"/users/:userID" keyPath:@"user"],
+                                      [self responseDescriptorWithMethod:RKRequestMethodPOST | RKRequestMethodPUT pathPattern:@"/users/:userID" keyPath:@"updatedUser"],
+                                      [self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:@"/users/me" keyPath:@"me"],
+                                      [self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:@"/users/:userID/posts/:postID\\.json" keyPath:@"post"],
+                                      [self responseDescriptorWithMethod:RKRequestMethodAny pathPattern:@"/users/" keyPath:@"trailingSlash"],
+                                      [self responseDescriptorWithMethod:RKRequestMethodAny pathPattern:@"posts/:postID" keyPath:@"relativePost"] ];
+    [responseDescriptors[7] setBaseURL:baseURL];
+    return responseDescriptors;
+}
+
+- (NSArray *)responseDescriptorsMatchingResponseLinearly:(NSHTTPURLResponse *)response method:(RKRequestMethod)method inArray:(NSArray *)responseDescriptors
+{
+    NSIndexSet *indexSet = [responseDescriptors indexesOfObjectsPassingTest:^BOOL(RKResponseDescriptor *responseDescriptor, NSUInteger idx, BOOL *stop) {
+        return [responseDescriptor matchesResponse:response] && (responseDescriptor.method & method);
+    }];
+    return [responseDescriptors objectsAtIndexes:indexSet];
+}
+
+- (void)testThatMatchingResponseDescriptorsAreIdenticalToEvaluatingEachDescriptor
+{
+    NSArray *responseDescriptors = [self responseDescriptors];
+    RKResponseDescriptorIndex *index = [RKResponseDescriptorIndex indexWithResponseDescriptors:responseDescriptors];
+    NSArray *URLStrings = @[ @"http://restkit.org/users", @"http://restkit.org/users/", @"http://restkit.org/users/1234", @"http://restkit.org/users/me",
+                             @"http://restkit.org/users/1234?page=2", @"http://restkit.org/users/1234/posts/5.json", @"http://restkit.org/users/1234/posts/5.xml",
+                             @"http://restkit.org/users/1234/5", @"http://restkit.org/api/posts/5", @"http://restkit.org/posts/5", @"http://restkit.org/" ];
+    for (NSString *URLString in URLStrings) {
+        for (NSNumber *method in @[ @(RKRequestMethodGET), @(RKRequestMethodPOST), @(RKRequestMethodDELETE) ]) {
+            for (NSNumber *statusCode in @[ @200, @404 ]) {
+                NSHTTPURLResponse *response = [self responseWithURLString:URLString statusCode:[statusCode integerValue]];
+                NSArray *expectedResponseDescriptors = [self responseDescriptorsMatchingResponseLinearly:response method:[method integerValue] inArray:responseDescriptors];
+                NSArray *matchingResponseDescriptors = [index responseDescriptorsMatchingResponse:response method:[method integerValue] parsedArguments:nil];
+                expect([matchingResponseDescriptors valueForKey:@"keyPath"]).to.equal([expectedResponseDescriptors valueForKey:@"keyPath"]);
+            }
+        }
+    }
+}
+
+- (void)testThatMatchingResponseDescriptorsAreReturnedInTheOrderTheyWereIndexed
+{
+    NSArray *responseDescriptors = [self responseDescriptors];
+    RKResponseDescriptorIndex *index = [RKResponseDescriptorIndex indexWithResponseDescriptors:responseDescriptors];
+    NSHTTPURLResponse *response = [self responseWithURLString:@"http://restkit.org/users/me" statusCode:200];
+    NSArray *matchingResponseDescriptors = [index responseDescriptorsMatchingResponse:response method:RKRequestMethodGET parsedArguments:nil];
+    expect([matchingResponseDescriptors valueForKey:@"keyPath"]).to.equal((@[ @"any", @"user", @"me" ]));
+}
+
+- (void)testThatParsedArgumentsAreReturnedForEachMatchingResponseDescriptor
+{
+    NSArray *responseDescriptors = [self responseDescriptors];
+    RKResponseDescriptorIndex *index = [RKResponseDescriptorIndex indexWithResponseDescriptors:responseDescriptors];
+    NSHTTPURLResponse *response = [self responseWithURLString:@"http://restkit.org/users/1234/posts/5.json" statusCode:200];
+    NSArray *parsedArguments = nil;
+    NSArray *matchingResponseDescriptors = [index responseDescriptorsMatchingResponse:response method:RKRequestMethodGET parsedArguments:&parsedArguments];
+    expect([matchingResponseDescriptors valueForKey:@"keyPath"]).to.equal((@[ @"any", @"post" ]));
+    expect(parsedArguments).to.equal((@[ [NSNull null], @{ @"userID": @"1234", @"postID": @"5" } ]));
+    expect(parsedArguments[1]).to.equal([matchingResponseDescriptors[1] parsedArgumentsFromResponse:response]);
+}
+
+- (void)testThatLiteralPathPatternsReturnEmptyParsedArguments
+{
+    RKResponseDescriptor *responseDescriptor = [self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:@"/users" keyPath:nil];
+    RKResponseDescriptorIndex *index = [RKResponseDescriptorIndex indexWithResponseDescriptors:@[ responseDescriptor ]];
+    NSHTTPURLResponse *response = [self responseWithURLString:@"http://restkit.org/users?page=2" statusCode:200];
+    NSArray *parsedArguments = nil;
+    expect([index responseDescriptorsMatchingResponse:response method:RKRequestMethodGET parsedArguments:&parsedArguments]).to.equal(@[ responseDescriptor ]);
+    expect(parsedArguments).to.equal(@[ [responseDescriptor parsedArgumentsFromResponse:response] ]);
+}
+
+- (void)testThatMatchingPathsDisregardsTheBaseURL
+{
+    NSArray *responseDescriptors = [self responseDescriptors];
+    RKResponseDescriptorIndex *index = [RKResponseDescriptorIndex indexWithResponseDescriptors:responseDescriptors];
+    expect([[index responseDescriptorsMatchingPath:@"posts/5" method:RKRequestMethodDELETE] valueForKey:@"keyPath"]).to.equal((@[ @"any", @"relativePost" ]));
+    expect([[index responseDescriptorsMatchingPath:@"/users/5" method:RKRequestMethodPUT] valueForKey:@"keyPath"]).to.equal((@[ @"any", @"updatedUser" ]));
+    expect([index responseDescriptorsMatchingPath:nil method:RKRequestMethodGET]).to.haveCountOf(7);
+}
+
+- (void)testThatObjectManagerSharesItsIndexWithObjectRequestOperations
+{
+    RKObjectManager *objectManager = [RKTestFactory objectManager];
+    [objectManager addResponseDescriptor:[self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:@"/users/:userID" keyPath:@"user"]];
+    NSURLRequest *request = [objectManager requestWithObject:nil method:RKRequestMethodGET path:@"/users/1" parameters:nil];
+    RKObjectRequestOperation *operation = [objectManager objectRequestOperationWithRequest:request success:nil failure:nil];
+    RKObjectRequestOperation *otherOperation = [objectManager objectRequestOperationWithRequest:request success:nil failure:nil];
+    expect(operation.responseDescriptorIndex).to.beIdenticalTo(otherOperation.responseDescriptorIndex);
+    expect(operation.responseDescriptorIndex.responseDescriptors).to.beIdenticalTo(objectManager.responseDescriptors);
+
+    [objectManager addResponseDescriptor:[self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:@"/users" keyPath:@"users"]];
+    RKObjectRequestOperation *operationAfterChange = [objectManager objectRequestOperationWithRequest:request success:nil failure:nil];
+    expect(operationAfterChange.responseDescriptorIndex).notTo.beIdenticalTo(operation.responseDescriptorIndex);
+    expect(operationAfterChange.responseDescriptorIndex.responseDescriptors).to.haveCountOf(2);
+}
+
+- (void)testThatResponseMapperOperationUsesTheIndexToMatchResponseDescriptors
+{
+    NSArray *responseDescriptors = [self responseDescriptors];
+    RKResponseDescriptorIndex *index = [RKResponseDescriptorIndex indexWithResponseDescriptors:responseDescriptors];
+    NSURLRequest *request = [NSURLRequest requestWithURL:[NSURL URLWithString:@"http://restkit.org/users/1234"]];
+    NSHTTPURLResponse *response = [self responseWithURLString:@"http://restkit.org/users/1234" statusCode:200];
+    RKObjectResponseMapperOperation *operation = [[RKObjectResponseMapperOperation alloc] initWithRequest:request response:response data:nil responseDescriptorIndex:index];
+    expect(operation.responseDescriptors).to.beIdenticalTo(index.responseDescriptors);
+    expect([operation.matchingResponseDescriptors valueForKey:@"keyPath"]).to.equal((@[ @"any", @"user" ]));
+    expect(operation.mappingMetadata[@"network"][@"arguments"]).to.equal((@{ @"user": @{ @"userID": @"1234" } }));
+}
+
+- (void)testMatchingPerformanceWithManyResponseDescriptors
+{
+    NSMutableArray *responseDescriptors = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 500; i++) {
+        NSString *pathPattern = (i % 2) ? [NSString stringWithFormat:@"/resources%lu/:resourceID", (unsigned long)i] : [NSString stringWithFormat:@"/resources%lu", (unsigned long)i];
+        [responseDescriptors addObject:[self responseDescriptorWithMethod:RKRequestMethodGET pathPattern:pathPattern keyPath:nil]];
+    }
+    RKResponseDescriptorIndex *index = [RKResponseDescriptorIndex indexWithResponseDescriptors:responseDescriptors];
+    NSHTTPURLResponse *response = [self responseWithURLString:@"http://restkit.org/resources499/1234" statusCode:200];
+    NSUInteger iterations = 100;
+
+    __block NSArray *linearMatches = nil;
+    [RKBenchmark report:@"Matching Each Response Descriptor" executionBlock:^{
+        for (NSUInteger i = 0; i < iterations; i++) {
+            linearMatches = [self responseDescriptorsMatchingResponseLinearly:response method:RKRequestMethodGET inArray:responseDescriptors];
+        }
+    }];
+    __block NSArray *indexedMatches = nil;
+    [RKBenchmark report:@"Matching with the Response Descriptor Index" executionBlock:^{
+        for (NSUInteger i = 0; i < iterations; i++) {
+            indexedMatches = [index responseDescriptorsMatchingResponse:response method:RKRequestMethodGET parsedArguments:nil];
+        }
+    }];
+    expect(linearMatches).to.equal(@[ [responseDescriptors lastObject] ]);
+    expect(indexedMatches).to.equal(linearMatches);
+}
+
+@end
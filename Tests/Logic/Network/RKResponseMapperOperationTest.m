@@ -28,6 +28,50 @@ NSString *RKPathAndQueryStringFromURLRelativeToURL(NSURL *URL, NSURL *baseURL);
 
 @end
 
+// Counts the callbacks sent to a mapper operation delegate
+@interface RKTestCountingMapperDelegate : NSObject <RKMapperOperationDelegate>
+@property (nonatomic, assign) NSUInteger willStartMappingCount;
+@property (nonatomic, assign) NSUInteger didFinishMappingCount;
+@property (nonatomic, assign) NSUInteger didFinishMappingOperationCount;
+@end
+@implementation RKTestCountingMapperDelegate
+
+- (void)mapperWillStartMapping:(RKMapperOperation *)mapper
+{
+    self.willStartMappingCount++;
+}
+
+- (void)mapperDidFinishMapping:(RKMapperOperation *)mapper
+{
+    self.didFinishMappingCount++;
+}
+
+- (void)mapper:(RKMapperOperation *)mapper didFinishMappingOperation:(RKMappingOperation *)mappingOperation forKeyPath:(NSString *)keyPath
+{
+    @synchronized(self) {
+        self.didFinishMappingOperationCount++;
+    }
+}
+
+@end
+
+// Deserializes JSON without declaring thread safety
+@interface RKTestLegacyJSONSerialization : NSObject <RKSerialization>
+@end
+@implementation RKTestLegacyJSONSerialization
+
++ (id)objectFromData:(NSData *)data error:(NSError **)error
+{
+    return [NSJSONSerialization JSONObjectWithData:data options:0 error:error];
+}
+
++ (NSData *)dataFromObject:(id)object error:(NSError **)error
+{
+    return [NSJSONSerialization dataWithJSONObject:object options:0 error:error];
+}
+
+@end
+
 @interface RKTestObjectMappingOperationDataSource : NSObject <RKMappingOperationDataSource>
 @end
 @implementation RKTestObjectMappingOperationDataSource
@@ -424,6 +468,157 @@ NSString *RKPathAndQueryStringFromURLRelativeToURL(NSURL *URL, NSURL *baseURL);
     [mockDelegate verify];
 }
 
+#pragma mark - Incremental Mapping
+
+- (RKObjectResponseMapperOperation *)incrementalMapperOperationWithKeyPath:(NSString *)keyPath MIMEType:(NSString *)MIMEType
+{
+    NSURL *responseURL = [NSURL URLWithString:@"http://restkit.org/api/v1/users"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:responseURL];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:responseURL statusCode:200 HTTPVersion:@"1.1" headerFields:@{@"Content-Type": MIMEType}];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:keyPath statusCodes:[NSIndexSet indexSetWithIndex:200]];
+    return [[RKObjectResponseMapperOperation alloc] initWithRequest:request response:response data:nil responseDescriptors:@[ responseDescriptor ]];
+}
+
+- (void)appendString:(NSString *)string toMapperOperation:(RKResponseMapperOperation *)mapper inChunksOfLength:(NSUInteger)chunkLength
+{
+    NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    for (NSUInteger offset = 0; offset < [data length]; offset += chunkLength) {
+        [mapper appendResponseData:[data subdataWithRange:NSMakeRange(offset, MIN(chunkLength, [data length] - offset))]];
+    }
+}
+
+- (void)testThatAppendedDataIsMappedIncrementallyAtKeyPath
+{
+    RKObjectResponseMapperOperation *mapper = [self incrementalMapperOperationWithKeyPath:@"users" MIMEType:@"application/json"];
+    [self appendString:@"{\"status\": \"OK\", \"users\": [{\"name\": \"Blake\"}, {\"name\": \"Sarah\"}, {\"name\": \"Colin\"}]}" toMapperOperation:mapper inChunksOfLength:7];
+    expect(mapper.isMappingIncrementally).to.equal(YES);
+    [mapper start];
+    expect(mapper.error).to.beNil();
+    expect([mapper.mappingResult.array valueForKey:@"name"]).to.equal((@[ @"Blake", @"Sarah", @"Colin" ]));
+}
+
+- (void)testThatAppendedDataIsMappedIncrementallyForRootArray
+{
+    RKObjectResponseMapperOperation *mapper = [self incrementalMapperOperationWithKeyPath:nil MIMEType:@"application/json"];
+    [self appendString:@"[{\"name\": \"Blake\"}, {\"name\": \"Sarah\"}]" toMapperOperation:mapper inChunksOfLength:3];
+    expect(mapper.isMappingIncrementally).to.equal(YES);
+    [mapper start];
+    expect(mapper.error).to.beNil();
+    expect([mapper.mappingResult.array valueForKey:@"name"]).to.equal((@[ @"Blake", @"Sarah" ]));
+}
+
+- (void)testThatAppendedDataIsBufferedWhenResponseCannotBeMappedIncrementally
+{
+    RKObjectResponseMapperOperation *mapper = [self incrementalMapperOperationWithKeyPath:nil MIMEType:@"application/json"];
+    mapper.targetObject = [RKTestUser new];
+    [self appendString:@"{\"name\": \"Blake\"}" toMapperOperation:mapper inChunksOfLength:4];
+    expect(mapper.isMappingIncrementally).to.equal(NO);
+    expect(mapper.data).to.equal([@"{\"name\": \"Blake\"}" dataUsingEncoding:NSUTF8StringEncoding]);
+    [mapper start];
+    expect(mapper.error).to.beNil();
+    expect([mapper.mappingResult.firstObject name]).to.equal(@"Blake");
+}
+
+- (void)testThatBatchesOfAnIncrementallyMappedResponseAreMappedAsASingleCollection
+{
+    NSURL *responseURL = [NSURL URLWithString:@"http://restkit.org/api/v1/users"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:responseURL];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:responseURL statusCode:200 HTTPVersion:@"1.1" headerFields:@{@"Content-Type": @"application/json"}];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.collectionIndex": @"luckyNumber" }];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:@"users" statusCodes:[NSIndexSet indexSetWithIndex:200]];
+    RKObjectResponseMapperOperation *mapper = [[RKObjectResponseMapperOperation alloc] initWithRequest:request response:response data:nil responseDescriptors:@[ responseDescriptor ]];
+    RKTestCountingMapperDelegate *delegate = [RKTestCountingMapperDelegate new];
+    mapper.mapperDelegate = delegate;
+    
+    // Each chunk completes a batch of elements
+    for (NSString *chunk in @[ @"{\"users\": [{\"name\": \"Blake\"}, ", @"{\"name\": \"Sarah\"}, {\"name\": \"Colin\"}, ", @"{\"name\": \"Jeff\"}]}" ]) {
+        [mapper appendResponseData:[chunk dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    expect(mapper.isMappingIncrementally).to.equal(YES);
+    [mapper start];
+    expect(mapper.error).to.beNil();
+    expect([mapper.mappingResult.array valueForKey:@"name"]).to.equal((@[ @"Blake", @"Sarah", @"Colin", @"Jeff" ]));
+    expect([mapper.mappingResult.array valueForKey:@"luckyNumber"]).to.equal((@[ @0, @1, @2, @3 ]));
+    expect(delegate.willStartMappingCount).to.equal(1);
+    expect(delegate.didFinishMappingCount).to.equal(1);
+    expect(delegate.didFinishMappingOperationCount).to.equal(4);
+}
+
+- (void)testThatMalformedIncrementalResponseFailsWithError
+{
+    RKObjectResponseMapperOperation *mapper = [self incrementalMapperOperationWithKeyPath:@"users" MIMEType:@"application/json"];
+    [self appendString:@"{\"users\": [{\"name\": \"Blake\"}, {\"name\"" toMapperOperation:mapper inChunksOfLength:5];
+    [mapper start];
+    expect(mapper.error).notTo.beNil();
+    expect(mapper.mappingResult).to.beNil();
+}
+
+#pragma mark - Deserialization Pool
+
+- (RKObjectResponseMapperOperation *)userMapperOperationWithMIMEType:(NSString *)MIMEType
+{
+    NSURL *responseURL = [NSURL URLWithString:@"http://restkit.org/api/v1/users"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:responseURL];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:responseURL statusCode:200 HTTPVersion:@"1.1" headerFields:@{@"Content-Type": MIMEType}];
+    NSData *data = [@"{\"name\": \"Blake\"}" dataUsingEncoding:NSUTF8StringEncoding];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:nil statusCodes:[NSIndexSet indexSetWithIndex:200]];
+    return [[RKObjectResponseMapperOperation alloc] initWithRequest:request response:response data:data responseDescriptors:@[ responseDescriptor ]];
+}
+
+- (void)testThatThreadSafeSerializationsDeserializeConcurrentlyWithinTheConfiguredBound
+{
+    NSUInteger maxConcurrentDeserializationCount = [RKResponseMapperOperation maxConcurrentDeserializationCount];
+    [RKResponseMapperOperation setMaxConcurrentDeserializationCount:2];
+    [RKResponseMapperOperation resetDeserializationMetrics];
+
+    NSOperationQueue *operationQueue = [NSOperationQueue new];
+    operationQueue.maxConcurrentOperationCount = 8;
+    NSMutableArray *mapperOperations = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 32; i++) {
+        [mapperOperations addObject:[self userMapperOperationWithMIMEType:@"application/json"]];
+    }
+    [operationQueue addOperations:mapperOperations waitUntilFinished:YES];
+    [RKResponseMapperOperation setMaxConcurrentDeserializationCount:maxConcurrentDeserializationCount];
+
+    for (RKObjectResponseMapperOperation *mapperOperation in mapperOperations) {
+        expect(mapperOperation.error).to.beNil();
+        expect([mapperOperation.mappingResult.firstObject name]).to.equal(@"Blake");
+    }
+    NSDictionary *metrics = [RKResponseMapperOperation deserializationMetrics];
+    expect(metrics[RKDeserializationMetricsCountKey]).to.equal(32);
+    expect(metrics[RKDeserializationMetricsSerialCountKey]).to.equal(0);
+    expect([metrics[RKDeserializationMetricsPeakConcurrentCountKey] unsignedIntegerValue]).to.beLessThanOrEqualTo(2);
+    expect([metrics[RKDeserializationMetricsMaximumWaitTimeKey] doubleValue]).to.beLessThanOrEqualTo([metrics[RKDeserializationMetricsTotalWaitTimeKey] doubleValue]);
+}
+
+- (void)testThatSerializationsThatAreNotThreadSafeAreDeserializedSerially
+{
+    [RKMIMETypeSerialization registerClass:[RKTestLegacyJSONSerialization class] forMIMEType:@"application/x-legacy-json"];
+    [RKResponseMapperOperation resetDeserializationMetrics];
+
+    RKObjectResponseMapperOperation *mapperOperation = [self userMapperOperationWithMIMEType:@"application/x-legacy-json"];
+    [mapperOperation start];
+    [RKMIMETypeSerialization unregisterClass:[RKTestLegacyJSONSerialization class]];
+
+    expect(mapperOperation.error).to.beNil();
+    expect([mapperOperation.mappingResult.firstObject name]).to.equal(@"Blake");
+    expect(mapperOperation.deserializationWaitTime).to.beGreaterThanOrEqualTo(0);
+    NSDictionary *metrics = [RKResponseMapperOperation deserializationMetrics];
+    expect(metrics[RKDeserializationMetricsCountKey]).to.equal(1);
+    expect(metrics[RKDeserializationMetricsSerialCountKey]).to.equal(1);
+}
+
+- (void)testThatBuiltInSerializationsDeclareThreadSafety
+{
+    expect([RKNSJSONSerialization supportsConcurrentDeserialization]).to.equal(YES);
+    expect([RKURLEncodedSerialization supportsConcurrentDeserialization]).to.equal(YES);
+}
+
 #pragma mark - HTTP Metadata
 
 - (void)testThatResponseMapperMakesRequestMethodAvailableToMetadata
@@ -21,6 +21,7 @@
 #import "RKTestEnvironment.h"
 #import "RKDynamicMapping.h"
 #import "RKDynamicMappingModels.h"
+#import "RKBenchmark.h"
 
 @interface RKDynamicMappingTest : RKTestCase
 
@@ -159,6 +160,83 @@
     assertThat(dynamicMapping.objectMappings, containsInAnyOrder(girlMapping, boyMapping, nil));
 }
 
+- (void)testShouldPickTheAppropriateMappingAmongManyMatchersSharingADiscriminatorKeyPath
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    NSMutableArray *mappings = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 40; i++) {
+        RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[NSMutableDictionary class]];
+        [mappings addObject:mapping];
+        [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:[NSString stringWithFormat:@"type%lu", (unsigned long)i] objectMapping:mapping]];
+    }
+    for (NSUInteger i = 0; i < 40; i++) {
+        NSDictionary *representation = @{ @"type": [NSString stringWithFormat:@"type%lu", (unsigned long)i] };
+        expect([dynamicMapping objectMappingForRepresentation:representation]).to.beIdenticalTo(mappings[i]);
+    }
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"unknown" }]).to.beNil();
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"name": @"untyped" }]).to.beNil();
+}
+
+- (void)testThatTheFirstRegisteredMatcherWinsWhenMatchersShareAnExpectedValue
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Girl" objectMapping:girlMapping]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValueMap:@{ @"Girl": boyMapping, @"Boy": boyMapping }]];
+    RKObjectMapping *mapping = [dynamicMapping objectMappingForRepresentation:[RKTestFixture parsedObjectWithContentsOfFixture:@"girl.json"]];
+    expect(mapping).to.beIdenticalTo(girlMapping);
+    mapping = [dynamicMapping objectMappingForRepresentation:[RKTestFixture parsedObjectWithContentsOfFixture:@"boy.json"]];
+    expect(mapping).to.beIdenticalTo(boyMapping);
+}
+
+- (void)testThatPredicateMatchersRegisteredBetweenKeyPathMatchersAreEvaluatedInOrder
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    RKObjectMapping *otherMapping = [RKObjectMapping mappingForClass:[NSMutableDictionary class]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Girl" objectMapping:girlMapping]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithPredicate:[NSPredicate predicateWithFormat:@"numeric_type = 1"] objectMapping:boyMapping]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Boy" objectMapping:otherMapping]];
+    RKObjectMapping *mapping = [dynamicMapping objectMappingForRepresentation:[RKTestFixture parsedObjectWithContentsOfFixture:@"girl.json"]];
+    expect(mapping).to.beIdenticalTo(girlMapping);
+    mapping = [dynamicMapping objectMappingForRepresentation:[RKTestFixture parsedObjectWithContentsOfFixture:@"boy.json"]];
+    expect(mapping).to.beIdenticalTo(boyMapping);
+}
+
+- (void)testMappingSelectionPerformanceWithManyMatchersSharingADiscriminatorKeyPath
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    for (NSUInteger i = 0; i < 40; i++) {
+        RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[NSMutableDictionary class]];
+        [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:[NSString stringWithFormat:@"type%lu", (unsigned long)i] objectMapping:mapping]];
+    }
+    NSArray *matchers = dynamicMapping.matchers;
+    NSDictionary *representation = @{ @"type": @"type39" };
+    NSUInteger iterations = 10000;
+
+    __block RKObjectMapping *orderedMapping = nil;
+    [RKBenchmark report:@"Selecting a Mapping by Evaluating Each Matcher" executionBlock:^{
+        for (NSUInteger i = 0; i < iterations; i++) {
+            for (RKObjectMappingMatcher *matcher in matchers) {
+                if ([matcher matches:representation]) {
+                    orderedMapping = matcher.objectMapping;
+                    break;
+                }
+            }
+        }
+    }];
+    __block RKObjectMapping *dispatchedMapping = nil;
+    [RKBenchmark report:@"Selecting a Mapping with the Dispatch Table" executionBlock:^{
+        for (NSUInteger i = 0; i < iterations; i++) {
+            dispatchedMapping = [dynamicMapping objectMappingForRepresentation:representation];
+        }
+    }];
+    expect(orderedMapping).to.beIdenticalTo([[matchers lastObject] objectMapping]);
+    expect(dispatchedMapping).to.beIdenticalTo(orderedMapping);
+}
+
 - (void)testThatRegistrationOfMatcherASecondTimeMovesToTopOfTheStack
 {
     RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
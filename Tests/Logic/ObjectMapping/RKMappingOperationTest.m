@@ -605,4 +605,43 @@
     assertThat(object.url, is(equalTo([NSURL URLWithString:@"http://google.com"])));
 }
 
+- (void)testSourceKeyWithKVCArraySupportForConsecutiveIndexes
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[TestMappable class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"matrix[1][0]": @"url" }];
+    TestMappable *object = [[TestMappable alloc] init];
+    id data = @{ @"matrix": @[ @[ @"http://microsoft.com" ], @[ @"http://google.com" ] ] };
+
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:data destinationObject:object mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+
+    assertThat(object.url, is(equalTo([NSURL URLWithString:@"http://google.com"])));
+}
+
+- (void)testSourceKeyWithKVCArraySupportIgnoresIndexesOutOfBounds
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[TestMappable class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"foo[3].url": @"url", @"name": @"boolString" }];
+    TestMappable *object = [[TestMappable alloc] init];
+    id data = @{ @"foo": @[ @{ @"url": @"http://google.com" } ], @"name": @"true" };
+
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:data destinationObject:object mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+
+    assertThat(object.url, is(nilValue()));
+    assertThat(object.boolString, is(equalTo(@"true")));
+}
+
+- (void)testThatIndexedSourceKeyPathsAreParsedWhenTheMappingIsCompiled
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[TestMappable class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"foo[1].bar[0].url": @"url", @"date": @"date" }];
+    RKObjectMappingPlan *plan = mapping.executionPlan;
+
+    expect([plan planForPropertyMapping:[mapping mappingForDestinationKeyPath:@"url"]].indexedSourceKeyPathSegments).to.equal((@[ @"foo", @1, @"bar", @0, @"url" ]));
+    expect([plan planForPropertyMapping:[mapping mappingForDestinationKeyPath:@"date"]].indexedSourceKeyPathSegments).to.beNil();
+}
+
 @end
@@ -55,4 +55,49 @@
     assertThat([result firstObject], is(equalTo(@"one")));
 }
 
+- (void)testShouldReturnTheSameArrayAndSetOnSubsequentInvocations
+{
+    RKMappingResult *result = [[RKMappingResult alloc] initWithDictionary:@{ @"one": @[ @"a", @"b" ], @"two": @"c" }];
+    assertThat([result array], is(sameInstance([result array])));
+    assertThat([result set], is(sameInstance([result set])));
+    assertThat([result set], is(equalTo([NSSet setWithArray:@[ @"a", @"b", @"c" ]])));
+}
+
+- (void)testShouldNotBeAffectedByMutationOfTheInitializingDictionary
+{
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithObject:@"one" forKey:@"one"];
+    RKMappingResult *result = [[RKMappingResult alloc] initWithDictionary:dictionary];
+    dictionary[@"two"] = @"two";
+    assertThatInteger([result count], is(equalToInteger(1)));
+    assertThat([result array], is(equalTo(@[ @"one" ])));
+}
+
+- (void)testShouldCountTheObjectsOfMappedCollectionsWithoutFlatteningDictionaries
+{
+    RKMappingResult *result = [[RKMappingResult alloc] initWithDictionary:@{ @"array": @[ @1, @2, @3 ], @"set": [NSSet setWithObjects:@4, @5, nil], @"dictionary": @{ @"key": @"value" } }];
+    assertThatInteger([result count], is(equalToInteger(6)));
+    assertThatInteger([result count], is(equalToInteger([[result array] count])));
+}
+
+- (void)testShouldFastEnumerateTheObjectsOfTheFlattenedArray
+{
+    NSMutableArray *largeArray = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 100; index++) [largeArray addObject:@(index)];
+    RKMappingResult *result = [[RKMappingResult alloc] initWithDictionary:@{ @"large": largeArray, @"empty": @[], @"single": @"single", @"dictionary": @{ @"key": @"value" } }];
+
+    NSMutableArray *enumeratedObjects = [NSMutableArray array];
+    for (id object in result) [enumeratedObjects addObject:object];
+    assertThat(enumeratedObjects, is(equalTo([result array])));
+    assertThat([result firstObject], is(equalTo([[result array] objectAtIndex:0])));
+}
+
+- (void)testShouldFastEnumerateMappedSets
+{
+    RKMappingResult *result = [[RKMappingResult alloc] initWithDictionary:@{ @"set": [NSSet setWithObjects:@1, @2, @3, nil], @"single": @4 }];
+    NSMutableArray *enumeratedObjects = [NSMutableArray array];
+    for (id object in result) [enumeratedObjects addObject:object];
+    assertThat(enumeratedObjects, is(equalTo([result array])));
+    assertThatInteger([enumeratedObjects count], is(equalToInteger(4)));
+}
+
 @end
@@ -1387,6 +1387,90 @@
     expect(user.position).to.beNil;
 }
 
+#pragma mark - Request Coalescing
+
+- (RKObjectManager *)humanObjectManager
+{
+    RKObjectManager *objectManager = [RKObjectManager managerWithBaseURL:[RKTestFactory baseURL]];
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:userMapping method:RKRequestMethodAny pathPattern:@"/JSON/humans/:userID\\.json" keyPath:@"human" statusCodes:[NSIndexSet indexSetWithIndex:200]];
+    [objectManager addResponseDescriptor:responseDescriptor];
+    return objectManager;
+}
+
+- (void)testThatIdenticalGETRequestsAreCoalescedWhenEnabled
+{
+    RKObjectManager *objectManager = [self humanObjectManager];
+    objectManager.coalescesIdenticalRequests = YES;
+    [objectManager.operationQueue setSuspended:YES];
+
+    NSMutableArray *operations = [NSMutableArray array];
+    NSMutableArray *mappingResults = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 3; i++) {
+        [objectManager getObjectsAtPath:@"/JSON/humans/1.json" parameters:nil success:^(RKObjectRequestOperation *operation, RKMappingResult *mappingResult) {
+            [operations addObject:operation];
+            [mappingResults addObject:mappingResult];
+        } failure:nil];
+    }
+    expect([objectManager.operationQueue operationCount]).to.equal(1);
+    [objectManager.operationQueue setSuspended:NO];
+
+    expect(mappingResults).will.haveCountOf(3);
+    expect(operations[1]).to.beIdenticalTo(operations[0]);
+    expect(operations[2]).to.beIdenticalTo(operations[0]);
+    expect(mappingResults[1]).to.beIdenticalTo(mappingResults[0]);
+    expect([[mappingResults[2] firstObject] name]).to.equal(@"Blake Watters");
+}
+
+- (void)testThatIdenticalGETRequestsAreNotCoalescedByDefault
+{
+    RKObjectManager *objectManager = [self humanObjectManager];
+    [objectManager.operationQueue setSuspended:YES];
+    [objectManager getObjectsAtPath:@"/JSON/humans/1.json" parameters:nil success:nil failure:nil];
+    [objectManager getObjectsAtPath:@"/JSON/humans/1.json" parameters:nil success:nil failure:nil];
+    expect([objectManager.operationQueue operationCount]).to.equal(2);
+    [objectManager.operationQueue cancelAllOperations];
+    [objectManager.operationQueue setSuspended:NO];
+}
+
+- (void)testThatGETRequestsWithDifferentParametersAreNotCoalesced
+{
+    RKObjectManager *objectManager = [self humanObjectManager];
+    objectManager.coalescesIdenticalRequests = YES;
+    [objectManager.operationQueue setSuspended:YES];
+    [objectManager getObjectsAtPath:@"/JSON/humans/1.json" parameters:@{ @"page": @1 } success:nil failure:nil];
+    [objectManager getObjectsAtPath:@"/JSON/humans/1.json" parameters:@{ @"page": @2 } success:nil failure:nil];
+    expect([objectManager.operationQueue operationCount]).to.equal(2);
+    [objectManager.operationQueue cancelAllOperations];
+    [objectManager.operationQueue setSuspended:NO];
+}
+
+- (void)testThatCoalescedRequestsFailTogetherWhenTheInFlightOperationIsCancelled
+{
+    RKObjectManager *objectManager = [self humanObjectManager];
+    objectManager.coalescesIdenticalRequests = YES;
+    [objectManager.operationQueue setSuspended:YES];
+
+    __block NSUInteger failureCount = 0;
+    for (NSUInteger i = 0; i < 2; i++) {
+        [objectManager getObjectsAtPath:@"/JSON/humans/1.json" parameters:nil success:nil failure:^(RKObjectRequestOperation *operation, NSError *error) {
+            expect(error.code).to.equal(RKOperationCancelledError);
+            failureCount++;
+        }];
+    }
+    [objectManager.operationQueue cancelAllOperations];
+    [objectManager.operationQueue setSuspended:NO];
+    expect(failureCount).will.equal(2);
+
+    // Once the in-flight operation has finished, a new request is sent
+    [objectManager.operationQueue setSuspended:YES];
+    [objectManager getObjectsAtPath:@"/JSON/humans/1.json" parameters:nil success:nil failure:nil];
+    expect([objectManager.operationQueue operationCount]).to.equal(1);
+    [objectManager.operationQueue cancelAllOperations];
+    [objectManager.operationQueue setSuspended:NO];
+}
+
 - (void)testMappingMetadataQueryParametersByRoute
 {
     RKObjectManager *objectManager = [RKObjectManager managerWithBaseURL:[RKTestFactory baseURL]];
@@ -38,6 +38,7 @@
 #import "RKMIMETypeSerialization.h"
 #import "ISO8601DateFormatterValueTransformer.h"
 #import "RKCLLocationValueTransformer.h"
+#import "RKBenchmark.h"
 
 // Managed Object Serialization Testific
 #import "RKHuman.h"
@@ -2740,6 +2741,92 @@
     }];
 }
 
+- (void)testMappingCollectionConcurrentlyPreservesOrderAndCollectionIndex
+{
+    NSMutableArray *representations = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 1000; index++) {
+        [representations addObject:@{ @"name": [NSString stringWithFormat:@"User %lu", (unsigned long)index] }];
+    }
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.collectionIndex": @"position", @"@metadata.mapping.country": @"country" }];
+    RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: userMapping }];
+    mapperOperation.metadata = @{ @"mapping": @{ @"country": @"United States of America" } };
+    mapperOperation.concurrentCollectionMappingThreshold = 10;
+    NSError *error = nil;
+    [mapperOperation execute:&error];
+    expect(error).to.beNil();
+
+    NSArray *users = [mapperOperation.mappingResult array];
+    expect(users).to.haveCountOf(1000);
+    [users enumerateObjectsUsingBlock:^(RKTestUser *user, NSUInteger index, BOOL *stop) {
+        expect(user.name).to.equal(([NSString stringWithFormat:@"User %lu", (unsigned long)index]));
+        expect(user.position).to.equal(index);
+        expect(user.country).to.equal(@"United States of America");
+    }];
+}
+
+- (void)testMappingCollectionConcurrentlyReportsErrors
+{
+    NSMutableArray *representations = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 100; index++) {
+        [representations addObject:(index % 10 == 0) ? @{ @"unmappable": @(index) } : @{ @"name": @"Blake Watters" }];
+    }
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: userMapping }];
+    mapperOperation.concurrentCollectionMappingThreshold = 10;
+    [mapperOperation start];
+
+    expect([mapperOperation.mappingResult array]).to.haveCountOf(90);
+    expect(mapperOperation.errors).to.haveCountOf(10);
+    expect([[mapperOperation.errors valueForKey:@"code"] valueForKeyPath:@"@distinctUnionOfObjects.self"]).to.equal(@[ @(RKMappingErrorUnmappableRepresentation) ]);
+}
+
+- (void)testCollectionsAreMappedSeriallyWhenTheDelegateTracksMappingOperations
+{
+    NSMutableArray *representations = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 100; index++) {
+        [representations addObject:@{ @"name": @"Blake Watters" }];
+    }
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: userMapping }];
+    mapperOperation.concurrentCollectionMappingThreshold = 10;
+    id mockDelegate = [OCMockObject niceMockForProtocol:@protocol(RKMapperOperationDelegate)];
+    NSThread *callingThread = [NSThread currentThread];
+    __block BOOL calledOnOtherThread = NO;
+    [[[mockDelegate stub] andDo:^(NSInvocation *invocation) {
+        if ([NSThread currentThread] != callingThread) calledOnOtherThread = YES;
+    }] mapper:mapperOperation didFinishMappingOperation:OCMOCK_ANY forKeyPath:nil];
+    mapperOperation.delegate = mockDelegate;
+    [mapperOperation start];
+
+    expect([mapperOperation.mappingResult array]).to.haveCountOf(100);
+    expect(calledOnOtherThread).to.beFalsy();
+}
+
+- (void)testConcurrentCollectionMappingThroughput
+{
+    NSMutableArray *representations = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 20000; index++) {
+        [representations addObject:@{ @"id": @(index), @"name": @"Blake Watters", @"email": @"blake@restkit.org", @"birthdate": @"1982-05-11T00:00:00Z", @"country": @"USA" }];
+    }
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"id": @"userID", @"name": @"name", @"email": @"emailAddress", @"birthdate": @"birthDate", @"country": @"country" }];
+
+    NSArray *userIDs = [representations valueForKey:@"id"];
+
+    for (NSNumber *threshold in @[ @(NSUIntegerMax), @256 ]) {
+        RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: userMapping }];
+        mapperOperation.concurrentCollectionMappingThreshold = [threshold unsignedIntegerValue];
+        [RKBenchmark report:([threshold unsignedIntegerValue] == NSUIntegerMax) ? @"Serial Collection Mapping" : @"Concurrent Collection Mapping" executionBlock:^{
+            [mapperOperation start];
+        }];
+        expect([mapperOperation.mappingResult array]).to.haveCountOf(20000);
+        expect([[mapperOperation.mappingResult array] valueForKey:@"userID"]).to.equal(userIDs);
+    }
+}
+
 - (void)testMetadataIsMerged
 {
     NSArray *representations = @[ @{ @"name": @"Blake Watters" } ];
@@ -9,6 +9,7 @@
 #import "RKTestEnvironment.h"
 #import "RKTestUser.h"
 #import "RKObjectMappingOperationDataSource.h"
+#import "RKBenchmark.h"
 
 @interface RKObjectMappingTest : RKTestCase
 
@@ -267,4 +268,92 @@
     expect(operation.destinationObject).to.equal(@{ @"Blake": @{} });
 }
 
+#pragma mark - Execution Plans
+
+- (void)testThatExecutionPlanPartitionsPropertyMappings
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"user.email": @"emailAddress", @"age": @"age" }];
+    [mapping addRelationshipMappingWithSourceKeyPath:@"friends" mapping:[RKObjectMapping mappingForClass:[RKTestUser class]]];
+
+    RKObjectMappingPlan *plan = mapping.executionPlan;
+    expect([NSSet setWithArray:[plan.simpleAttributePlans valueForKey:@"destinationKeyPath"]]).to.equal([NSSet setWithObjects:@"name", @"age", nil]);
+    expect([plan.keyPathAttributePlans valueForKey:@"destinationKeyPath"]).to.equal(@[ @"emailAddress" ]);
+    expect([plan.keyPathAttributePlans[0] sourceKeyPathComponents]).to.equal((@[ @"user", @"email" ]));
+    expect([plan.relationshipPlans valueForKey:@"destinationKeyPath"]).to.equal(@[ @"friends" ]);
+    expect([plan.relationshipPlans[0] destinationClass]).to.equal([NSArray class]);
+
+    RKPropertyMappingPlan *agePlan = [plan planForPropertyMapping:[mapping mappingForDestinationKeyPath:@"age"]];
+    expect([agePlan isDestinationPrimitive]).to.beTruthy();
+    expect(agePlan.destinationClass).to.equal([NSNumber class]);
+    expect(agePlan.valueTransformer).to.equal(mapping.valueTransformer);
+}
+
+- (void)testThatExecutionPlanIsReusedUntilTheMappingChanges
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKObjectMappingPlan *plan = mapping.executionPlan;
+    expect(mapping.executionPlan).to.beIdenticalTo(plan);
+
+    [mapping addAttributeMappingsFromArray:@[ @"emailAddress" ]];
+    RKObjectMappingPlan *updatedPlan = mapping.executionPlan;
+    expect(updatedPlan).notTo.beIdenticalTo(plan);
+    expect(updatedPlan.simpleAttributePlans).to.haveCountOf(2);
+
+    RKValueTransformer *valueTransformer = [RKValueTransformer stringToURLValueTransformer];
+    [[mapping mappingForDestinationKeyPath:@"name"] setValueTransformer:valueTransformer];
+    expect([mapping.executionPlan planForPropertyMapping:[mapping mappingForDestinationKeyPath:@"name"]].valueTransformer).to.equal(valueTransformer);
+
+    [mapping removePropertyMapping:[mapping mappingForDestinationKeyPath:@"name"]];
+    expect(mapping.executionPlan.simpleAttributePlans).to.haveCountOf(1);
+}
+
+- (void)testThatMappingWithCompiledAccessorsNotifiesKeyValueObservers
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKTestUser *user = [RKTestUser new];
+    id mockObserver = [OCMockObject niceMockForClass:[NSObject class]];
+    [[mockObserver expect] observeValueForKeyPath:@"name" ofObject:user change:OCMOCK_ANY context:NULL];
+    [user addObserver:mockObserver forKeyPath:@"name" options:NSKeyValueObservingOptionNew context:NULL];
+
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake" } destinationObject:user mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    [user removeObserver:mockObserver forKeyPath:@"name"];
+
+    expect(user.name).to.equal(@"Blake");
+    [mockObserver verify];
+}
+
+- (void)testMappingThroughputWithExecutionPlan
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"userID", @"name": @"name", @"email": @"emailAddress", @"country": @"country", @"age": @"age", @"lucky_number": @"luckyNumber", @"address.city": @"addressDictionary" }];
+    NSMutableArray *representations = [NSMutableArray arrayWithCapacity:10000];
+    for (NSUInteger index = 0; index < 10000; index++) {
+        [representations addObject:@{ @"id": @(index), @"name": @"Blake Watters", @"email": @"blake@restkit.org", @"country": @"USA", @"age": @"32", @"lucky_number": @7, @"address": @{ @"city": @{ @"name": @"Carrboro" } } }];
+    }
+    RKObjectMappingOperationDataSource *dataSource = [RKObjectMappingOperationDataSource new];
+    NSMutableArray *users = [NSMutableArray arrayWithCapacity:[representations count]];
+
+    [RKBenchmark report:@"Mapping with a Compiled Execution Plan" executionBlock:^{
+        for (NSDictionary *representation in representations) {
+            RKTestUser *user = [RKTestUser new];
+            RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:user mapping:mapping];
+            operation.dataSource = dataSource;
+            [operation start];
+            [users addObject:user];
+        }
+    }];
+    expect(users).to.haveCountOf(10000);
+    RKTestUser *user = [users lastObject];
+    expect(user.userID).to.equal(@9999);
+    expect(user.name).to.equal(@"Blake Watters");
+    expect(user.emailAddress).to.equal(@"blake@restkit.org");
+    expect(user.luckyNumber).to.equal(@7);
+    expect(user.addressDictionary).to.equal(@{ @"name": @"Carrboro" });
+}
+
 @end
@@ -9,9 +9,30 @@
 #import "RKTestEnvironment.h"
 #import "RKSearchIndexer.h"
 #import "RKSearchWordEntity.h"
+#import "RKSearchWord.h"
+#import "RKBenchmark.h"
 
 @interface RKSearchIndexer ()
 @property (nonatomic, strong) NSOperationQueue *operationQueue;
+@property (nonatomic, strong) NSMapTable *searchWordTables;
+- (NSUInteger)indexManagedObject:(NSManagedObject *)managedObject withProgressBlock:(void (^)(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop))progressBlock;
+- (BOOL)mergeDuplicateSearchWordsInPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator error:(NSError **)error;
+@end
+
+// Retrieves search words with a fetch request per word
+@interface RKFetchingSearchIndexerDelegate : NSObject <RKSearchIndexerDelegate>
+@end
+
+@implementation RKFetchingSearchIndexerDelegate
+
+- (RKSearchWord *)searchIndexer:(RKSearchIndexer *)searchIndexer searchWordForWord:(NSString *)word inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext error:(NSError **)error
+{
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+    fetchRequest.fetchLimit = 1;
+    fetchRequest.predicate = [NSPredicate predicateWithFormat:@"%K == %@", RKSearchWordAttributeName, word];
+    return [[managedObjectContext executeFetchRequest:fetchRequest error:error] lastObject];
+}
+
 @end
 
 static NSManagedObjectModel *RKManagedObjectModel()
@@ -377,6 +398,468 @@ static NSManagedObjectModel *RKManagedObjectModel()
     assertThat([searchWords valueForKey:@"word"], isEmpty());
 }
 
+#pragma mark - Search Word Table Tests
+
+- (NSUInteger)countOfSearchWordsForWord:(NSString *)word inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+    fetchRequest.predicate = [NSPredicate predicateWithFormat:@"%K == %@", RKSearchWordAttributeName, word];
+    return [managedObjectContext countForFetchRequest:fetchRequest error:nil];
+}
+
+- (void)testIndexingReusesSearchWordsPersistedBeforeIndexing
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchWord *existingSearchWord = [NSEntityDescription insertNewObjectForEntityForName:RKSearchWordEntityName inManagedObjectContext:managedObjectContext];
+    existingSearchWord.word = @"name";
+    [managedObjectContext save:&error];
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [human setValue:@"This is my name" forKey:@"name"];
+    [indexer indexManagedObject:human];
+
+    NSSet *searchWords = [human valueForKey:RKSearchWordsRelationshipName];
+    expect(searchWords).to.contain(existingSearchWord);
+    expect([self countOfSearchWordsForWord:@"name" inManagedObjectContext:managedObjectContext]).to.equal(1);
+}
+
+- (void)testIndexingReusesSearchWordsInsertedDuringIndexing
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSManagedObject *blake = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [blake setValue:@"Blake Watters" forKey:@"name"];
+    [indexer indexManagedObject:blake];
+    NSManagedObject *sarah = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [sarah setValue:@"Sarah Watters" forKey:@"name"];
+    [indexer indexManagedObject:sarah];
+
+    expect([self countOfSearchWordsForWord:@"watters" inManagedObjectContext:managedObjectContext]).to.equal(1);
+    NSSet *sharedSearchWords = [[blake valueForKey:RKSearchWordsRelationshipName] objectsPassingTest:^BOOL(id obj, BOOL *stop) {
+        return [[sarah valueForKey:RKSearchWordsRelationshipName] containsObject:obj];
+    }];
+    expect([sharedSearchWords valueForKey:@"word"]).to.equal([NSSet setWithObject:@"watters"]);
+}
+
+- (void)testSearchWordTableIsUpdatedWithPermanentObjectIDsOnSave
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSManagedObject *blake = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [blake setValue:@"Blake Watters" forKey:@"name"];
+    [indexer indexManagedObject:blake];
+    [managedObjectContext save:&error];
+
+    NSDictionary *searchWordTable = [indexer.searchWordTables objectForKey:managedObjectContext];
+    expect([searchWordTable[@"watters"] isTemporaryID]).to.beFalsy();
+
+    NSManagedObject *sarah = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [sarah setValue:@"Sarah Watters" forKey:@"name"];
+    [indexer indexManagedObject:sarah];
+    expect([self countOfSearchWordsForWord:@"watters" inManagedObjectContext:managedObjectContext]).to.equal(1);
+}
+
+- (void)testSearchWordTablesOfOtherContextsOnlyReceiveObjectIDsTheyCanResolve
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *parentContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    parentContext.persistentStoreCoordinator = persistentStoreCoordinator;
+    NSManagedObjectContext *childContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    childContext.parentContext = parentContext;
+    NSManagedObjectContext *siblingContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    siblingContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    void (^indexHumanWithName)(NSManagedObjectContext *, NSString *) = ^(NSManagedObjectContext *managedObjectContext, NSString *name) {
+        [managedObjectContext performBlockAndWait:^{
+            NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+            [human setValue:name forKey:@"name"];
+            [indexer indexManagedObject:human];
+        }];
+    };
+    indexHumanWithName(parentContext, @"Sarah");
+    indexHumanWithName(siblingContext, @"Jeff");
+    indexHumanWithName(childContext, @"Blake Watters");
+
+    [childContext performBlockAndWait:^{
+        [childContext save:nil];
+    }];
+    [parentContext performBlockAndWait:^{}];
+    [siblingContext performBlockAndWait:^{}];
+    NSDictionary *parentSearchWordTable = [indexer.searchWordTables objectForKey:parentContext];
+    NSDictionary *siblingSearchWordTable = [indexer.searchWordTables objectForKey:siblingContext];
+    expect([parentSearchWordTable[@"watters"] isTemporaryID]).to.beTruthy();
+    expect(siblingSearchWordTable[@"watters"]).to.beNil();
+
+    [parentContext performBlockAndWait:^{
+        [parentContext save:nil];
+    }];
+    [siblingContext performBlockAndWait:^{}];
+    expect(siblingSearchWordTable[@"watters"]).notTo.beNil();
+    expect([siblingSearchWordTable[@"watters"] isTemporaryID]).to.beFalsy();
+    expect([siblingSearchWordTable[@"jeff"] isTemporaryID]).to.beTruthy();
+}
+
+- (void)testMergingDuplicateSearchWordsRelinksIndexedObjectsAndUpdatesSearchWordTables
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    __block NSManagedObject *blake = nil;
+    __block NSManagedObject *sarah = nil;
+    [managedObjectContext performBlockAndWait:^{
+        for (NSString *name in @[ @"Blake", @"Sarah" ]) {
+            RKSearchWord *searchWord = [NSEntityDescription insertNewObjectForEntityForName:RKSearchWordEntityName inManagedObjectContext:managedObjectContext];
+            searchWord.word = @"watters";
+            NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+            [human setValue:name forKey:@"name"];
+            [[human mutableSetValueForKey:RKSearchWordsRelationshipName] addObject:searchWord];
+            if (blake) sarah = human;
+            else blake = human;
+        }
+        [managedObjectContext save:nil];
+        // Load the search word table of the context
+        NSManagedObject *jeff = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+        [jeff setValue:@"Jeff" forKey:@"name"];
+        [indexer indexManagedObject:jeff];
+    }];
+
+    BOOL success = [indexer mergeDuplicateSearchWordsInPersistentStoreCoordinator:persistentStoreCoordinator error:&error];
+    expect(success).to.beTruthy();
+    __block NSManagedObjectID *searchWordObjectID = nil;
+    __block NSManagedObjectID *otherSearchWordObjectID = nil;
+    __block NSUInteger searchWordCount = 0;
+    [managedObjectContext performBlockAndWait:^{
+        [managedObjectContext refreshObject:blake mergeChanges:NO];
+        [managedObjectContext refreshObject:sarah mergeChanges:NO];
+        searchWordObjectID = [[[blake valueForKey:RKSearchWordsRelationshipName] anyObject] objectID];
+        otherSearchWordObjectID = [[[sarah valueForKey:RKSearchWordsRelationshipName] anyObject] objectID];
+        searchWordCount = [self countOfSearchWordsForWord:@"watters" inManagedObjectContext:managedObjectContext];
+    }];
+    expect(searchWordCount).to.equal(1);
+    expect(otherSearchWordObjectID).to.equal(searchWordObjectID);
+    NSDictionary *searchWordTable = [indexer.searchWordTables objectForKey:managedObjectContext];
+    expect(searchWordTable[@"watters"]).to.equal(searchWordObjectID);
+
+    [managedObjectContext performBlockAndWait:^{
+        NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+        [human setValue:@"Jeff Watters" forKey:@"name"];
+        [indexer indexManagedObject:human];
+        searchWordCount = [self countOfSearchWordsForWord:@"watters" inManagedObjectContext:managedObjectContext];
+    }];
+    expect(searchWordCount).to.equal(1);
+}
+
+- (void)testReindexingChangedObjectOnlyLinksAndUnlinksChangedWords
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [human setValue:@"Blake Watters" forKey:@"name"];
+    [indexer indexManagedObject:human];
+    [managedObjectContext save:&error];
+
+    NSSet *searchWords = [human valueForKey:RKSearchWordsRelationshipName];
+    RKSearchWord *blakeSearchWord = [[searchWords filteredSetUsingPredicate:[NSPredicate predicateWithFormat:@"word == 'blake'"]] anyObject];
+    RKSearchWord *wattersSearchWord = [[searchWords filteredSetUsingPredicate:[NSPredicate predicateWithFormat:@"word == 'watters'"]] anyObject];
+
+    [human setValue:@"Blake Smith" forKey:@"name"];
+    [indexer indexChangedObjectsInManagedObjectContext:managedObjectContext waitUntilFinished:YES];
+
+    searchWords = [human valueForKey:RKSearchWordsRelationshipName];
+    expect([searchWords valueForKey:@"word"]).to.equal(([NSSet setWithArray:@[ @"blake", @"smith" ]]));
+    expect(searchWords).to.contain(blakeSearchWord);
+    expect([managedObjectContext updatedObjects]).notTo.contain(blakeSearchWord);
+    expect([managedObjectContext updatedObjects]).to.contain(wattersSearchWord);
+}
+
+- (void)testProgressBlockIsInvokedForEveryWordWhenReindexingManagedObject
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [human setValue:@"Blake Watters" forKey:@"name"];
+    [indexer indexManagedObject:human];
+    [human setValue:@"Blake" forKey:@"nickName"];
+
+    NSMutableSet *words = [NSMutableSet set];
+    [indexer indexManagedObject:human withProgressBlock:^(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop) {
+        [words addObject:searchWord.word];
+    }];
+    expect(words).to.equal([NSSet setWithObjects:@"blake", @"watters", nil]);
+
+    __block NSUInteger invocationCount = 0;
+    [indexer indexManagedObject:human withProgressBlock:^(NSManagedObject *managedObject, RKSearchWord *searchWord, BOOL *stop) {
+        invocationCount++;
+        *stop = YES;
+    }];
+    expect(invocationCount).to.equal(1);
+}
+
+- (void)testReindexingChangedObjectRetainsWordsOccurringInUnchangedAttributes
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [human setValue:@"Blake Watters" forKey:@"name"];
+    [human setValue:@"Watters" forKey:@"nickName"];
+    [indexer indexManagedObject:human];
+    [managedObjectContext save:&error];
+
+    [human setValue:@"Blake" forKey:@"name"];
+    [indexer indexChangedObjectsInManagedObjectContext:managedObjectContext waitUntilFinished:YES];
+
+    NSSet *searchWords = [human valueForKey:RKSearchWordsRelationshipName];
+    expect([searchWords valueForKey:@"word"]).to.equal(([NSSet setWithArray:@[ @"blake", @"watters" ]]));
+}
+
+- (void)testReindexingManagedObjectUnlinksWordsThatAreNoLongerPresent
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    [human setValue:@"Blake Watters" forKey:@"name"];
+    [indexer indexManagedObject:human];
+    [managedObjectContext save:&error];
+    [managedObjectContext refreshObject:human mergeChanges:NO];
+
+    [human setValue:@"Sarah" forKey:@"name"];
+    NSUInteger count = [indexer indexManagedObject:human];
+    expect(count).to.equal(1);
+    NSSet *searchWords = [human valueForKey:RKSearchWordsRelationshipName];
+    expect([searchWords valueForKey:@"word"]).to.equal([NSSet setWithObject:@"sarah"]);
+}
+
+- (NSManagedObjectContext *)managedObjectContextWithUnindexedHumans:(NSUInteger)count
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    for (NSUInteger index = 0; index < count; index++) {
+        NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+        [human setValue:[NSString stringWithFormat:@"Human%ld Watters", (long) index] forKey:@"name"];
+    }
+    [managedObjectContext save:&error];
+    [managedObjectContext reset];
+    return managedObjectContext;
+}
+
+- (NSUInteger)countOfUnindexedHumansInManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"Human"];
+    fetchRequest.predicate = [NSPredicate predicateWithFormat:@"NOT (ANY %K.%K == 'watters')", RKSearchWordsRelationshipName, RKSearchWordAttributeName];
+    return [managedObjectContext countForFetchRequest:fetchRequest error:nil];
+}
+
+- (void)testReindexingEntitiesIndexesAllObjectsOfThePersistentStore
+{
+    NSManagedObjectContext *managedObjectContext = [self managedObjectContextWithUnindexedHumans:250];
+    expect([self countOfUnindexedHumansInManagedObjectContext:managedObjectContext]).to.equal(250);
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    __block NSUInteger lastIndexedObjectCount = 0;
+    NSError *error = nil;
+    BOOL success = [indexer reindexEntities:nil inPersistentStoreCoordinator:managedObjectContext.persistentStoreCoordinator batchSize:20 checkpointURL:nil progressBlock:^(NSUInteger indexedObjectCount, NSUInteger totalObjectCount, BOOL *stop) {
+        expect(totalObjectCount).to.equal(250);
+        lastIndexedObjectCount = indexedObjectCount;
+    } error:&error];
+
+    expect(success).to.beTruthy();
+    expect(error).to.beNil();
+    expect(lastIndexedObjectCount).to.equal(250);
+    expect([self countOfUnindexedHumansInManagedObjectContext:managedObjectContext]).to.equal(0);
+    expect([self countOfSearchWordsForWord:@"watters" inManagedObjectContext:managedObjectContext]).to.equal(1);
+    expect([self countOfSearchWordsForWord:@"human42" inManagedObjectContext:managedObjectContext]).to.equal(1);
+}
+
+- (void)testReindexingEntitiesResumesFromCheckpoint
+{
+    NSManagedObjectContext *managedObjectContext = [self managedObjectContextWithUnindexedHumans:250];
+    NSURL *checkpointURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:@"RKSearchIndexerTestCheckpoint.plist"]];
+    [[NSFileManager defaultManager] removeItemAtURL:checkpointURL error:nil];
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSError *error = nil;
+    BOOL success = [indexer reindexEntities:nil inPersistentStoreCoordinator:managedObjectContext.persistentStoreCoordinator batchSize:5 checkpointURL:checkpointURL progressBlock:^(NSUInteger indexedObjectCount, NSUInteger totalObjectCount, BOOL *stop) {
+        *stop = YES;
+    } error:&error];
+    expect(success).to.beFalsy();
+    expect(error.code).to.equal(RKOperationCancelledError);
+    expect([[NSFileManager defaultManager] fileExistsAtPath:[checkpointURL path]]).to.beTruthy();
+    NSUInteger unindexedObjectCount = [self countOfUnindexedHumansInManagedObjectContext:managedObjectContext];
+    expect(unindexedObjectCount).to.beLessThan(250);
+
+    __block NSUInteger firstIndexedObjectCount = 0;
+    error = nil;
+    success = [indexer reindexEntities:nil inPersistentStoreCoordinator:managedObjectContext.persistentStoreCoordinator batchSize:5 checkpointURL:checkpointURL progressBlock:^(NSUInteger indexedObjectCount, NSUInteger totalObjectCount, BOOL *stop) {
+        if (firstIndexedObjectCount == 0) firstIndexedObjectCount = indexedObjectCount;
+    } error:&error];
+    expect(success).to.beTruthy();
+    expect(firstIndexedObjectCount).to.beGreaterThan(250 - unindexedObjectCount);
+    expect([self countOfUnindexedHumansInManagedObjectContext:managedObjectContext]).to.equal(0);
+    expect([[NSFileManager defaultManager] fileExistsAtPath:[checkpointURL path]]).to.beFalsy();
+}
+
+- (void)testStoppingReindexingMergesDuplicateSearchWords
+{
+    NSManagedObjectContext *managedObjectContext = [self managedObjectContextWithUnindexedHumans:250];
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    NSError *error = nil;
+    BOOL success = [indexer reindexEntities:nil inPersistentStoreCoordinator:managedObjectContext.persistentStoreCoordinator batchSize:5 checkpointURL:nil progressBlock:^(NSUInteger indexedObjectCount, NSUInteger totalObjectCount, BOOL *stop) {
+        if (indexedObjectCount >= 50) *stop = YES;
+    } error:&error];
+    expect(success).to.beFalsy();
+    expect(error.code).to.equal(RKOperationCancelledError);
+    expect([self countOfUnindexedHumansInManagedObjectContext:managedObjectContext]).to.beLessThan(250);
+    expect([self countOfSearchWordsForWord:@"watters" inManagedObjectContext:managedObjectContext]).to.equal(1);
+
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName];
+    NSArray *searchWords = [managedObjectContext executeFetchRequest:fetchRequest error:nil];
+    NSSet *distinctWords = [NSSet setWithArray:[searchWords valueForKey:RKSearchWordAttributeName]];
+    expect([distinctWords count]).to.equal([searchWords count]);
+}
+
+- (void)testIndexingThroughputOfSyntheticCorpus
+{
+    NSManagedObjectModel *managedObjectModel = RKManagedObjectModel();
+    NSEntityDescription *entity = [managedObjectModel entitiesByName][@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    NSError *error;
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:&error];
+
+    // Build a corpus of objects whose names are drawn from a fixed vocabulary
+    NSUInteger objectCount = 1000;
+    NSUInteger wordsPerObject = 8;
+    NSMutableArray *vocabulary = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 500; index++) {
+        [vocabulary addObject:[NSString stringWithFormat:@"word%lu", (unsigned long)index]];
+    }
+    NSMutableArray *names = [NSMutableArray arrayWithCapacity:objectCount];
+    srandom(1234);
+    for (NSUInteger index = 0; index < objectCount; index++) {
+        NSMutableArray *words = [NSMutableArray arrayWithCapacity:wordsPerObject];
+        for (NSUInteger count = 0; count < wordsPerObject; count++) {
+            [words addObject:vocabulary[random() % [vocabulary count]]];
+        }
+        [names addObject:[words componentsJoinedByString:@" "]];
+    }
+
+    NSUInteger (^indexCorpusWithDelegate)(NSString *, id<RKSearchIndexerDelegate>) = ^NSUInteger(NSString *benchmarkName, id<RKSearchIndexerDelegate> delegate) {
+        NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+        managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+        NSMutableArray *humans = [NSMutableArray arrayWithCapacity:objectCount];
+        for (NSString *name in names) {
+            NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+            [human setValue:name forKey:@"name"];
+            [humans addObject:human];
+        }
+        RKSearchIndexer *indexer = [RKSearchIndexer new];
+        indexer.delegate = delegate;
+        [RKBenchmark report:benchmarkName executionBlock:^{
+            for (NSManagedObject *human in humans) {
+                [indexer indexManagedObject:human];
+            }
+        }];
+        for (NSManagedObject *human in humans) {
+            NSSet *words = [NSSet setWithArray:[[human valueForKey:@"name"] componentsSeparatedByString:@" "]];
+            expect([[human valueForKey:RKSearchWordsRelationshipName] valueForKey:RKSearchWordAttributeName]).to.equal(words);
+        }
+        return [managedObjectContext countForFetchRequest:[NSFetchRequest fetchRequestWithEntityName:RKSearchWordEntityName] error:nil];
+    };
+
+    NSUInteger fetchingSearchWordCount = indexCorpusWithDelegate(@"Indexing Fetching Each Word", [RKFetchingSearchIndexerDelegate new]);
+    NSUInteger tableSearchWordCount = indexCorpusWithDelegate(@"Indexing Using the Search Word Table", nil);
+    expect(fetchingSearchWordCount).to.beLessThanOrEqualTo([vocabulary count]);
+    expect(tableSearchWordCount).to.equal(fetchingSearchWordCount);
+}
+
 #pragma mark - Delegate Tests
 
 - (void)testThatDelegateCanDenyCreationOfSearchWordForWord
@@ -0,0 +1,157 @@
+//
+//  RKSearchPrefixIndexTest.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "Search.h"
+#import "RKCat.h"
+
+@interface RKSearchPrefixIndex ()
+@property (nonatomic, strong) NSMutableArray *objectIDs;
+@end
+
+@interface RKSearchPrefixIndexTest : RKTestCase
+@property (nonatomic, strong) RKManagedObjectStore *managedObjectStore;
+@property (nonatomic, strong) RKCat *asia;
+@property (nonatomic, strong) RKCat *lola;
+@property (nonatomic, strong) RKCat *reginald;
+@end
+
+@implementation RKSearchPrefixIndexTest
+
+- (void)setUp
+{
+    NSError *error = nil;
+    NSURL *modelURL = [[RKTestFixture fixtureBundle] URLForResource:@"Data Model" withExtension:@"mom"];
+    NSManagedObjectModel *managedObjectModel = [[NSManagedObjectModel alloc] initWithContentsOfURL:modelURL];
+    self.managedObjectStore = [[RKManagedObjectStore alloc] initWithManagedObjectModel:managedObjectModel];
+    [self.managedObjectStore addSearchIndexingToEntityForName:@"Cat" onAttributes:@[ @"name" ]];
+    [self.managedObjectStore addInMemoryPersistentStore:&error];
+    [self.managedObjectStore createManagedObjectContexts];
+    [self.managedObjectStore startIndexingPersistentStoreManagedObjectContext];
+
+    NSManagedObjectContext *managedObjectContext = self.managedObjectStore.mainQueueManagedObjectContext;
+    self.asia = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    self.asia.name = @"Asia Penelope Watters";
+    self.lola = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    self.lola.name = @"Lola Watters";
+    self.reginald = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    self.reginald.name = @"Reginald Royford Williams, III";
+    [managedObjectContext obtainPermanentIDsForObjects:@[ self.asia, self.lola, self.reginald ] error:&error];
+    [managedObjectContext saveToPersistentStore:&error];
+}
+
+- (void)tearDown
+{
+    [self.managedObjectStore stopIndexingPersistentStoreManagedObjectContext];
+    self.managedObjectStore = nil;
+}
+
+- (RKSearchPrefixIndex *)loadedPrefixIndex
+{
+    NSEntityDescription *entity = self.managedObjectStore.managedObjectModel.entitiesByName[@"Cat"];
+    RKSearchPrefixIndex *prefixIndex = [[RKSearchPrefixIndex alloc] initWithEntity:entity];
+    NSError *error = nil;
+    BOOL success = [prefixIndex loadFromManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext error:&error];
+    expect(success).to.beTruthy();
+    expect(error).to.beNil();
+    return prefixIndex;
+}
+
+- (void)testLoadingPrefixIndex
+{
+    RKSearchPrefixIndex *prefixIndex = [self loadedPrefixIndex];
+    expect(prefixIndex.objectCount).to.equal(3);
+    // asia, penelope, watters, lola, reginald, royford, williams, iii
+    expect(prefixIndex.wordCount).to.equal(8);
+}
+
+- (void)testSearchingForPrefixes
+{
+    RKSearchPrefixIndex *prefixIndex = [self loadedPrefixIndex];
+    NSSet *objectIDs = [prefixIndex objectIDsMatchingSearchText:@"Wat" type:NSAndPredicateType];
+    expect(objectIDs).to.equal(([NSSet setWithObjects:self.asia.objectID, self.lola.objectID, nil]));
+    objectIDs = [prefixIndex objectIDsMatchingSearchText:@"r" type:NSAndPredicateType];
+    expect(objectIDs).to.equal([NSSet setWithObject:self.reginald.objectID]);
+    objectIDs = [prefixIndex objectIDsMatchingSearchText:@"xyz" type:NSOrPredicateType];
+    expect(objectIDs).to.beEmpty();
+}
+
+- (void)testSearchingWithAndPredicateTypeIntersectsMatches
+{
+    RKSearchPrefixIndex *prefixIndex = [self loadedPrefixIndex];
+    NSSet *objectIDs = [prefixIndex objectIDsMatchingSearchText:@"watters pen" type:NSAndPredicateType];
+    expect(objectIDs).to.equal([NSSet setWithObject:self.asia.objectID]);
+    objectIDs = [prefixIndex objectIDsMatchingSearchText:@"lola royford" type:NSAndPredicateType];
+    expect(objectIDs).to.beEmpty();
+}
+
+- (void)testSearchingWithOrPredicateTypeMergesMatches
+{
+    RKSearchPrefixIndex *prefixIndex = [self loadedPrefixIndex];
+    NSSet *objectIDs = [prefixIndex objectIDsMatchingSearchText:@"Asia Roy" type:NSOrPredicateType];
+    expect(objectIDs).to.equal(([NSSet setWithObjects:self.asia.objectID, self.reginald.objectID, nil]));
+}
+
+- (void)testFetchingWithPredicateFromPrefixIndex
+{
+    RKSearchPrefixIndex *prefixIndex = [self loadedPrefixIndex];
+    NSPredicate *predicate = [RKSearchPredicate searchPredicateWithText:@"Asia Roy" type:NSOrPredicateType prefixIndex:prefixIndex];
+    NSManagedObjectContext *managedObjectContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    [managedObjectContext performBlockAndWait:^{
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"Cat"];
+        fetchRequest.predicate = predicate;
+        fetchRequest.sortDescriptors = @[ [NSSortDescriptor sortDescriptorWithKey:@"name" ascending:YES] ];
+        NSArray *objects = [managedObjectContext executeFetchRequest:fetchRequest error:nil];
+        expect([objects valueForKey:@"objectID"]).to.equal((@[ self.asia.objectID, self.reginald.objectID ]));
+    }];
+}
+
+- (void)testUpdatingAndRemovingObjects
+{
+    RKSearchPrefixIndex *prefixIndex = [self loadedPrefixIndex];
+    NSManagedObjectContext *managedObjectContext = self.managedObjectStore.mainQueueManagedObjectContext;
+    self.lola.name = @"Lola Penelope";
+    [managedObjectContext saveToPersistentStore:nil];
+
+    // The search words are assigned by the indexer during the save of the persistent store context
+    NSManagedObjectContext *persistentStoreManagedObjectContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    [persistentStoreManagedObjectContext performBlockAndWait:^{
+        NSManagedObject *lola = [persistentStoreManagedObjectContext existingObjectWithID:self.lola.objectID error:nil];
+        [prefixIndex indexManagedObject:lola];
+    }];
+
+    expect([prefixIndex objectIDsMatchingSearchText:@"watters" type:NSAndPredicateType]).to.equal([NSSet setWithObject:self.asia.objectID]);
+    expect([prefixIndex objectIDsMatchingSearchText:@"penelope" type:NSAndPredicateType]).to.equal(([NSSet setWithObjects:self.asia.objectID, self.lola.objectID, nil]));
+
+    [prefixIndex removeManagedObjectWithID:self.asia.objectID];
+    expect(prefixIndex.objectCount).to.equal(2);
+    expect([prefixIndex objectIDsMatchingSearchText:@"penelope" type:NSAndPredicateType]).to.equal([NSSet setWithObject:self.lola.objectID]);
+    expect([prefixIndex objectIDsMatchingSearchText:@"asia" type:NSAndPredicateType]).to.beEmpty();
+}
+
+- (void)testRemovingObjectsCompactsObjectOrdinals
+{
+    RKSearchPrefixIndex *prefixIndex = [self loadedPrefixIndex];
+    [prefixIndex removeManagedObjectWithID:self.asia.objectID];
+    expect([prefixIndex.objectIDs count]).to.equal(3);
+    [prefixIndex removeManagedObjectWithID:self.lola.objectID];
+    expect([prefixIndex.objectIDs count]).to.equal(1);
+    expect(prefixIndex.objectCount).to.equal(1);
+    expect(prefixIndex.wordCount).to.equal(4);
+    expect([prefixIndex objectIDsMatchingSearchText:@"williams" type:NSAndPredicateType]).to.equal([NSSet setWithObject:self.reginald.objectID]);
+    expect([prefixIndex objectIDsMatchingSearchText:@"watters" type:NSOrPredicateType]).to.beEmpty();
+
+    NSManagedObjectContext *persistentStoreManagedObjectContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    [persistentStoreManagedObjectContext performBlockAndWait:^{
+        NSManagedObject *lola = [persistentStoreManagedObjectContext existingObjectWithID:self.lola.objectID error:nil];
+        [prefixIndex indexManagedObject:lola];
+    }];
+    expect([prefixIndex objectIDsMatchingSearchText:@"watters" type:NSAndPredicateType]).to.equal([NSSet setWithObject:self.lola.objectID]);
+    expect([prefixIndex objectIDsMatchingSearchText:@"r" type:NSAndPredicateType]).to.equal([NSSet setWithObject:self.reginald.objectID]);
+}
+
+@end
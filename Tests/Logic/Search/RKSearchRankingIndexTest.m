@@ -0,0 +1,228 @@
+//
+//  RKSearchRankingIndexTest.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "Search.h"
+#import "RKBenchmark.h"
+#import "RKCat.h"
+
+static NSUInteger const RKSearchRankingBenchmarkCorpusSize = 2000;
+
+@interface RKSearchRankingIndex ()
+@property (nonatomic, readonly) NSMutableArray *objectIDs;
+@end
+
+@interface RKSearchRankingIndexTest : RKTestCase
+@property (nonatomic, strong) RKManagedObjectStore *managedObjectStore;
+@end
+
+@implementation RKSearchRankingIndexTest
+
+- (void)setUp
+{
+    NSError *error = nil;
+    NSURL *modelURL = [[RKTestFixture fixtureBundle] URLForResource:@"Data Model" withExtension:@"mom"];
+    NSManagedObjectModel *managedObjectModel = [[NSManagedObjectModel alloc] initWithContentsOfURL:modelURL];
+    self.managedObjectStore = [[RKManagedObjectStore alloc] initWithManagedObjectModel:managedObjectModel];
+    [self.managedObjectStore addSearchIndexingToEntityForName:@"Cat" onAttributes:@[ @"name", @"nickName" ]];
+    [self.managedObjectStore addInMemoryPersistentStore:&error];
+    [self.managedObjectStore createManagedObjectContexts];
+}
+
+- (void)tearDown
+{
+    self.managedObjectStore = nil;
+}
+
+- (NSArray *)insertCatsWithNames:(NSArray *)names
+{
+    NSManagedObjectContext *managedObjectContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    NSMutableArray *cats = [NSMutableArray arrayWithCapacity:[names count]];
+    [managedObjectContext performBlockAndWait:^{
+        for (NSString *name in names) {
+            RKCat *cat = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+            cat.name = name;
+            [cats addObject:cat];
+        }
+        [managedObjectContext save:nil];
+    }];
+    return cats;
+}
+
+- (RKSearchRankingIndex *)loadedRankingIndex
+{
+    RKSearchRankingIndex *rankingIndex = [[RKSearchRankingIndex alloc] initWithEntity:self.managedObjectStore.managedObjectModel.entitiesByName[@"Cat"]];
+    NSError *error = nil;
+    BOOL success = [rankingIndex loadFromManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext error:&error];
+    expect(success).to.beTruthy();
+    return rankingIndex;
+}
+
+- (void)testRankingByTermFrequency
+{
+    NSArray *cats = [self insertCatsWithNames:@[ @"Asia Watters", @"Lola Watters Watters", @"Reginald Royford" ]];
+    RKSearchRankingIndex *rankingIndex = [self loadedRankingIndex];
+    expect(rankingIndex.objectCount).to.equal(3);
+    expect(rankingIndex.wordCount).to.equal(5);
+
+    NSArray *scores = nil;
+    NSArray *objectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:@"watters" type:NSOrPredicateType limit:10 scores:&scores];
+    expect(objectIDs).to.equal((@[ [cats[1] objectID], [cats[0] objectID] ]));
+    expect([scores[0] doubleValue]).to.beGreaterThan([scores[1] doubleValue]);
+}
+
+- (void)testRankingIsLimitedToTheTopResults
+{
+    NSMutableArray *names = [NSMutableArray array];
+    for (NSUInteger count = 1; count <= 20; count++) {
+        // Each cat repeats the word one more time and is thus more relevant than the last
+        NSMutableArray *words = [NSMutableArray arrayWithObject:@"Cat"];
+        for (NSUInteger index = 0; index < count; index++) [words addObject:@"meow"];
+        [names addObject:[words componentsJoinedByString:@" "]];
+    }
+    NSArray *cats = [self insertCatsWithNames:names];
+    RKSearchRankingIndex *rankingIndex = [self loadedRankingIndex];
+
+    NSArray *objectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:@"meow" type:NSAndPredicateType limit:3 scores:nil];
+    expect(objectIDs).to.equal((@[ [cats[19] objectID], [cats[18] objectID], [cats[17] objectID] ]));
+}
+
+- (void)testRankingMatchesPrefixesOfIndexedWords
+{
+    NSArray *cats = [self insertCatsWithNames:@[ @"Asia Watters", @"Reginald Royford" ]];
+    RKSearchRankingIndex *rankingIndex = [self loadedRankingIndex];
+    NSArray *objectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:@"Wat" type:NSAndPredicateType limit:10 scores:nil];
+    expect(objectIDs).to.equal(@[ [cats[0] objectID] ]);
+}
+
+- (void)testRankingWithAndPredicateTypeRequiresAllTerms
+{
+    NSArray *cats = [self insertCatsWithNames:@[ @"Asia Watters", @"Lola Watters", @"Asia Royford" ]];
+    RKSearchRankingIndex *rankingIndex = [self loadedRankingIndex];
+    NSArray *objectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:@"asia watters" type:NSAndPredicateType limit:10 scores:nil];
+    expect(objectIDs).to.equal(@[ [cats[0] objectID] ]);
+    objectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:@"asia watters" type:NSOrPredicateType limit:10 scores:nil];
+    expect(objectIDs).to.haveCountOf(3);
+    expect(objectIDs[0]).to.equal([cats[0] objectID]);
+}
+
+- (void)testRankingWithTFIDFWeightsRareTermsHigher
+{
+    NSArray *cats = [self insertCatsWithNames:@[ @"Asia Watters", @"Lola Watters", @"Roy Watters", @"Reginald Royford" ]];
+    RKSearchRankingIndex *rankingIndex = [self loadedRankingIndex];
+    rankingIndex.rankingFunction = RKSearchRankingFunctionTFIDF;
+    NSArray *scores = nil;
+    NSArray *objectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:@"reginald watters" type:NSOrPredicateType limit:1 scores:&scores];
+    expect(objectIDs).to.equal(@[ [cats[3] objectID] ]);
+    expect(scores).to.haveCountOf(1);
+}
+
+- (void)testStopWordsAreNotIndexedOrSearched
+{
+    NSArray *cats = [self insertCatsWithNames:@[ @"The Cat in the Hat" ]];
+    RKSearchRankingIndex *rankingIndex = [[RKSearchRankingIndex alloc] initWithEntity:self.managedObjectStore.managedObjectModel.entitiesByName[@"Cat"]];
+    rankingIndex.stopWords = [NSSet setWithObjects:@"the", @"in", nil];
+    [rankingIndex loadFromManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext error:nil];
+    expect(rankingIndex.wordCount).to.equal(2);
+    NSArray *objectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:@"the hat" type:NSAndPredicateType limit:10 scores:nil];
+    expect(objectIDs).to.equal(@[ [cats[0] objectID] ]);
+}
+
+- (void)testUpdatingAndRemovingObjects
+{
+    NSArray *cats = [self insertCatsWithNames:@[ @"Asia Watters", @"Lola Watters" ]];
+    RKSearchRankingIndex *rankingIndex = [self loadedRankingIndex];
+    NSManagedObjectContext *managedObjectContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    [managedObjectContext performBlockAndWait:^{
+        [cats[1] setName:@"Lola Royford"];
+        [rankingIndex indexManagedObject:cats[1]];
+    }];
+    expect([rankingIndex rankedObjectIDsMatchingSearchText:@"watters" type:NSAndPredicateType limit:10 scores:nil]).to.equal(@[ [cats[0] objectID] ]);
+    expect([rankingIndex rankedObjectIDsMatchingSearchText:@"royford" type:NSAndPredicateType limit:10 scores:nil]).to.equal(@[ [cats[1] objectID] ]);
+
+    [rankingIndex removeManagedObjectWithID:[cats[0] objectID]];
+    expect(rankingIndex.objectCount).to.equal(1);
+    expect([rankingIndex rankedObjectIDsMatchingSearchText:@"asia watters" type:NSOrPredicateType limit:10 scores:nil]).to.beEmpty();
+}
+
+- (void)testRemovingObjectsCompactsTheObjectOrdinals
+{
+    NSArray *cats = [self insertCatsWithNames:@[ @"Asia Watters", @"Lola Watters Watters", @"Roy Watters", @"Reginald Royford", @"Lola Royford" ]];
+    RKSearchRankingIndex *rankingIndex = [self loadedRankingIndex];
+    [rankingIndex removeManagedObjectWithID:[cats[0] objectID]];
+    [rankingIndex removeManagedObjectWithID:[cats[2] objectID]];
+    expect(rankingIndex.objectIDs).to.haveCountOf(5);
+    [rankingIndex removeManagedObjectWithID:[cats[3] objectID]];
+    expect(rankingIndex.objectIDs).to.haveCountOf(2);
+    expect(rankingIndex.objectCount).to.equal(2);
+
+    expect([rankingIndex rankedObjectIDsMatchingSearchText:@"watters" type:NSOrPredicateType limit:10 scores:nil]).to.equal(@[ [cats[1] objectID] ]);
+    expect([rankingIndex rankedObjectIDsMatchingSearchText:@"lola" type:NSOrPredicateType limit:10 scores:nil]).to.haveCountOf(2);
+
+    [self.managedObjectStore.persistentStoreManagedObjectContext performBlockAndWait:^{
+        [rankingIndex indexManagedObject:cats[0]];
+    }];
+    expect([rankingIndex rankedObjectIDsMatchingSearchText:@"watters" type:NSOrPredicateType limit:10 scores:nil]).to.equal((@[ [cats[1] objectID], [cats[0] objectID] ]));
+}
+
+- (void)testRankedSearchPerformanceAgainstPredicateSearch
+{
+    // Build a synthetic corpus of names drawn from a fixed vocabulary and index it with the search indexer
+    NSMutableArray *vocabulary = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 500; index++) {
+        [vocabulary addObject:[NSString stringWithFormat:@"word%lu", (unsigned long)index]];
+    }
+    NSManagedObjectContext *managedObjectContext = self.managedObjectStore.persistentStoreManagedObjectContext;
+    RKSearchIndexer *searchIndexer = self.managedObjectStore.searchIndexer;
+    srandom(1234);
+    [managedObjectContext performBlockAndWait:^{
+        for (NSUInteger index = 0; index < RKSearchRankingBenchmarkCorpusSize; index++) {
+            @autoreleasepool {
+                NSMutableArray *words = [NSMutableArray arrayWithCapacity:6];
+                for (NSUInteger count = 0; count < 6; count++) {
+                    [words addObject:vocabulary[random() % [vocabulary count]]];
+                }
+                RKCat *cat = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+                cat.name = [words componentsJoinedByString:@" "];
+                [searchIndexer indexManagedObject:cat];
+            }
+        }
+        [managedObjectContext save:nil];
+        [managedObjectContext reset];
+    }];
+
+    RKSearchRankingIndex *rankingIndex = [[RKSearchRankingIndex alloc] initWithEntity:self.managedObjectStore.managedObjectModel.entitiesByName[@"Cat"]];
+    [RKBenchmark report:@"Loading Ranking Index" executionBlock:^{
+        [rankingIndex loadFromManagedObjectContext:managedObjectContext error:nil];
+    }];
+    expect(rankingIndex.objectCount).to.equal(RKSearchRankingBenchmarkCorpusSize);
+
+    NSString *searchText = @"word42 word424";
+    NSUInteger iterations = 10;
+    __block NSSet *predicateObjectIDs = nil;
+    [RKBenchmark report:@"Unranked Predicate Search" executionBlock:^{
+        [managedObjectContext performBlockAndWait:^{
+            for (NSUInteger index = 0; index < iterations; index++) {
+                NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"Cat"];
+                fetchRequest.predicate = [RKSearchPredicate searchPredicateWithText:searchText type:NSOrPredicateType];
+                fetchRequest.resultType = NSManagedObjectIDResultType;
+                predicateObjectIDs = [NSSet setWithArray:[managedObjectContext executeFetchRequest:fetchRequest error:nil]];
+            }
+        }];
+    }];
+    __block NSArray *rankedObjectIDs = nil;
+    [RKBenchmark report:@"Ranked Top 20 Search" executionBlock:^{
+        for (NSUInteger index = 0; index < iterations; index++) {
+            rankedObjectIDs = [rankingIndex rankedObjectIDsMatchingSearchText:searchText type:NSOrPredicateType limit:20 scores:nil];
+        }
+    }];
+    expect([predicateObjectIDs count]).to.beGreaterThan(0);
+    expect([rankedObjectIDs count]).to.equal(MIN([predicateObjectIDs count], 20));
+    expect([[NSSet setWithArray:rankedObjectIDs] isSubsetOfSet:predicateObjectIDs]).to.beTruthy();
+}
+
+@end
@@ -0,0 +1,115 @@
+//
+//  RKIncrementalJSONParserTest.m
+//  RestKit
+//
+//  Copyright (c) 2012 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKIncrementalJSONParser.h"
+
+@interface RKIncrementalJSONParserTest : RKTestCase
+
+@end
+
+@implementation RKIncrementalJSONParserTest
+
+- (NSArray *)parseString:(NSString *)string withParser:(RKIncrementalJSONParser *)parser chunkSize:(NSUInteger)chunkSize keyPath:(id)keyPath
+{
+    NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    NSMutableArray *elements = [NSMutableArray array];
+    for (NSUInteger offset = 0; offset < [data length]; offset += chunkSize) {
+        NSData *chunk = [data subdataWithRange:NSMakeRange(offset, MIN(chunkSize, [data length] - offset))];
+        NSError *error = nil;
+        NSDictionary *parsedElements = [parser parseData:chunk error:&error];
+        expect(error).to.beNil();
+        if (parsedElements[keyPath]) [elements addObjectsFromArray:parsedElements[keyPath]];
+    }
+    return elements;
+}
+
+- (void)testStreamingRootArrayAcrossChunkBoundaries
+{
+    RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObject:[NSNull null]]];
+    NSArray *elements = [self parseString:@"[{\"id\": 1, \"tags\": [1, 2]}, {\"id\": 2}, 3, \"four\", null]" withParser:parser chunkSize:3 keyPath:[NSNull null]];
+    expect(elements).to.equal((@[ @{ @"id": @1, @"tags": @[ @1, @2 ] }, @{ @"id": @2 }, @3, @"four", [NSNull null] ]));
+
+    NSError *error = nil;
+    id skeleton = [parser finishParsing:&error];
+    expect(error).to.beNil();
+    expect(skeleton).to.equal(@[]);
+}
+
+- (void)testStreamingKeyedArrayPreservesTheRestOfTheDocument
+{
+    RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObject:@"results"]];
+    NSArray *elements = [self parseString:@"{\"status\": \"OK\", \"results\": [{\"id\": 226}, {\"id\": 235}], \"meta\": {\"results\": [1]}}" withParser:parser chunkSize:5 keyPath:@"results"];
+    expect(elements).to.equal((@[ @{ @"id": @226 }, @{ @"id": @235 } ]));
+
+    NSError *error = nil;
+    id skeleton = [parser finishParsing:&error];
+    expect(error).to.beNil();
+    expect(skeleton).to.equal((@{ @"status": @"OK", @"results": @[], @"meta": @{ @"results": @[ @1 ] } }));
+}
+
+- (void)testStringsContainingStructuralCharactersAreNotTokenized
+{
+    RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObject:@"results"]];
+    NSArray *elements = [self parseString:@"{\"title\": \"[a, {b}]\", \"results\": [\"x\\\"],\", {\"y\": \"}\"}]}" withParser:parser chunkSize:1 keyPath:@"results"];
+    expect(elements).to.equal((@[ @"x\"],", @{ @"y": @"}" } ]));
+    expect([parser finishParsing:nil]).to.equal((@{ @"title": @"[a, {b}]", @"results": @[] }));
+}
+
+- (void)testThatNonStreamedDocumentsAreParsedAsSkeleton
+{
+    RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObject:@"results"]];
+    NSArray *elements = [self parseString:@"{\"users\": [{\"name\": \"Blake\"}]}" withParser:parser chunkSize:4 keyPath:@"results"];
+    expect(elements).to.beEmpty();
+    expect([parser finishParsing:nil]).to.equal((@{ @"users": @[ @{ @"name": @"Blake" } ] }));
+    expect(parser.length).to.equal(30);
+}
+
+- (void)testThatAnIncompleteDocumentReturnsAnError
+{
+    RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObject:[NSNull null]]];
+    NSArray *elements = [self parseString:@"[{\"id\": 1}, {\"id\"" withParser:parser chunkSize:8 keyPath:[NSNull null]];
+    expect(elements).to.haveCountOf(1);
+
+    NSError *error = nil;
+    id skeleton = [parser finishParsing:&error];
+    expect(skeleton).to.beNil();
+    expect(error).notTo.beNil();
+}
+
+- (void)testThatAMalformedElementReturnsAnError
+{
+    RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObject:[NSNull null]]];
+    NSError *error = nil;
+    NSDictionary *parsedElements = [parser parseData:[@"[{\"id\": }]" dataUsingEncoding:NSUTF8StringEncoding] error:&error];
+    expect(parsedElements).to.beNil();
+    expect(error).notTo.beNil();
+}
+
+- (void)testThatMisplacedCommasInAStreamedArrayReturnAnError
+{
+    for (NSString *string in @[ @"[1,,2]", @"[,1]", @"[1,]", @"[{\"id\": 1},]", @"[{\"id\": 1} {\"id\": 2}]", @"{\"results\": [1, , 2]}" ]) {
+        RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObjects:[NSNull null], @"results", nil]];
+        NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+        NSError *error = nil;
+        for (NSUInteger offset = 0; offset < [data length] && ! error; offset++) {
+            [parser parseData:[data subdataWithRange:NSMakeRange(offset, 1)] error:&error];
+        }
+        expect(error).notTo.beNil();
+        expect([parser finishParsing:nil]).to.beNil();
+    }
+}
+
+- (void)testThatEmptyStreamedArraysAreParsed
+{
+    RKIncrementalJSONParser *parser = [[RKIncrementalJSONParser alloc] initWithStreamingKeyPaths:[NSSet setWithObject:@"results"]];
+    NSArray *elements = [self parseString:@"{\"results\": [ ], \"count\": 0}" withParser:parser chunkSize:1 keyPath:@"results"];
+    expect(elements).to.haveCountOf(0);
+    expect([parser finishParsing:nil]).to.equal((@{ @"results": @[], @"count": @0 }));
+}
+
+@end
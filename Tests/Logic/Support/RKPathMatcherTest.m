@@ -20,6 +20,7 @@
 
 #import "RKTestEnvironment.h"
 #import "RKPathMatcher.h"
+#import "RKBenchmark.h"
 
 @interface RKPathMatcherTest : RKTestCase
 
@@ -190,4 +191,69 @@
     expect(matches).to.equal(YES);
 }
 
+- (void)testThatMatchersForTheSamePatternShareTheCompiledPattern
+{
+    RKPathMatcher *pathMatcher1 = [RKPathMatcher pathMatcherWithPattern:@"/compiled/:patternID"];
+    RKPathMatcher *pathMatcher2 = [RKPathMatcher pathMatcherWithPattern:[NSMutableString stringWithString:@"/compiled/:patternID"]];
+    expect([pathMatcher1 valueForKey:@"compiledPathPattern"]).to.beIdenticalTo([pathMatcher2 valueForKey:@"compiledPathPattern"]);
+    expect([[pathMatcher1 copy] valueForKey:@"compiledPathPattern"]).to.beIdenticalTo([pathMatcher1 valueForKey:@"compiledPathPattern"]);
+}
+
+- (void)testThatPathsWithADifferentNumberOfSlashesDoNotMatchOrParseArguments
+{
+    NSDictionary *arguments = nil;
+    RKPathMatcher *pathMatcher = [RKPathMatcher pathMatcherWithPattern:@"/files/:filename"];
+    BOOL matches = [pathMatcher matchesPath:@"/files/path/to/file" tokenizeQueryStrings:NO parsedArguments:&arguments];
+    expect(matches).to.equal(NO);
+    expect(arguments).to.beNil();
+
+    matches = [pathMatcher matchesPath:@"/files/file?path=/to/file" tokenizeQueryStrings:YES parsedArguments:&arguments];
+    expect(matches).to.equal(YES);
+    expect(arguments).to.equal((@{ @"filename": @"file", @"path": @"/to/file" }));
+}
+
+- (void)testThatPathsCanBeMatchedConcurrently
+{
+    RKPathMatcher *pathMatcher = [RKPathMatcher pathMatcherWithPattern:@"/users/:userID/posts/:postID"];
+    __block NSUInteger mismatchCount = 0;
+    dispatch_apply(1000, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+        NSDictionary *arguments = nil;
+        NSString *path = [NSString stringWithFormat:@"/users/%lu/posts/%lu", (unsigned long)index, (unsigned long)index * 2];
+        BOOL matches = [pathMatcher matchesPath:path tokenizeQueryStrings:NO parsedArguments:&arguments];
+        RKPathMatcher *patternMatcher = [RKPathMatcher pathMatcherWithPath:path];
+        BOOL matchesPattern = [patternMatcher matchesPattern:@"/users/:userID/posts/:postID" tokenizeQueryStrings:NO parsedArguments:nil];
+        if (!matches || !matchesPattern || ![arguments[@"postID"] isEqualToString:[NSString stringWithFormat:@"%lu", (unsigned long)index * 2]]) {
+            @synchronized(pathMatcher) {
+                mismatchCount++;
+            }
+        }
+    });
+    expect(mismatchCount).to.equal(0);
+}
+
+- (void)testPathMatchingPerformance
+{
+    NSMutableArray *paths = [NSMutableArray arrayWithCapacity:5000];
+    for (NSUInteger i = 0; i < 5000; i++) {
+        [paths addObject:(i % 3) ? [NSString stringWithFormat:@"/api/v1/organizations/%lu?client_search=t", (unsigned long)i] : [NSString stringWithFormat:@"/api/v1/organizations/%lu/members", (unsigned long)i]];
+    }
+    RKPathMatcher *pathMatcher = [RKPathMatcher pathMatcherWithPattern:@"/api/:version/organizations/:organizationID"];
+    __block NSUInteger matchCount = 0;
+    [RKBenchmark report:@"Matching Paths Against a Path Pattern" executionBlock:^{
+        for (NSString *path in paths) {
+            NSDictionary *arguments = nil;
+            if ([pathMatcher matchesPath:path tokenizeQueryStrings:NO parsedArguments:&arguments]) matchCount++;
+        }
+    }];
+
+    __block NSUInteger patternMatchCount = 0;
+    [RKBenchmark report:@"Matching Path Matchers Against a Path Pattern String" executionBlock:^{
+        for (NSString *path in paths) {
+            if ([[RKPathMatcher pathMatcherWithPath:path] matchesPattern:@"/api/:version/organizations/:organizationID" tokenizeQueryStrings:NO parsedArguments:nil]) patternMatchCount++;
+        }
+    }];
+    expect(patternMatchCount).to.equal(3333);
+    expect(matchCount).to.equal(3333);
+}
+
 @end
@@ -32,4 +32,54 @@
     expect(tokens).to.equal(expectedTokens);
 }
 
+- (void)testTokenizingStringFoldsCaseAndDiacritics
+{
+    RKStringTokenizer *stringTokenizer = [RKStringTokenizer new];
+    NSSet *tokens = [stringTokenizer tokenize:@"Crème BRÛLÉE"];
+    NSSet *expectedTokens = [NSSet setWithArray:@[ @"creme", @"brulee" ]];
+    expect(tokens).to.equal(expectedTokens);
+}
+
+- (void)testTokenizingNilOrEmptyStringReturnsEmptySet
+{
+    RKStringTokenizer *stringTokenizer = [RKStringTokenizer new];
+    expect([stringTokenizer tokenize:nil]).to.beEmpty();
+    expect([stringTokenizer tokenize:@""]).to.beEmpty();
+}
+
+- (void)testStopWordsAreMatchedCaseAndDiacriticInsensitively
+{
+    RKStringTokenizer *stringTokenizer = [RKStringTokenizer new];
+    stringTokenizer.stopWords = [NSSet setWithObjects:@"IS", @"À", nil];
+    NSSet *tokens = [stringTokenizer tokenize:@"This is a test"];
+    NSSet *expectedTokens = [NSSet setWithArray:@[ @"this", @"test" ]];
+    expect(tokens).to.equal(expectedTokens);
+}
+
+- (void)testReusingTokenizerForStringsOfDifferentLengths
+{
+    RKStringTokenizer *stringTokenizer = [RKStringTokenizer new];
+    expect([stringTokenizer tokenize:@"The quick brown fox jumps over the lazy dog"]).to.haveCountOf(8);
+    expect([stringTokenizer tokenize:@"Hi"]).to.equal([NSSet setWithObject:@"hi"]);
+    expect([stringTokenizer tokenize:@"Another rather long string of text to tokenize"]).to.equal([NSSet setWithArray:@[ @"another", @"rather", @"long", @"string", @"of", @"text", @"to", @"tokenize" ]]);
+}
+
+- (void)testTokenizingStringIntoSetAddsToExistingTokens
+{
+    RKStringTokenizer *stringTokenizer = [RKStringTokenizer new];
+    NSMutableSet *tokens = [NSMutableSet setWithObject:@"test"];
+    [stringTokenizer tokenizeString:@"This is a test" intoSet:tokens];
+    NSSet *expectedTokens = [NSSet setWithArray:@[ @"this", @"is", @"a", @"test" ]];
+    expect(tokens).to.equal(expectedTokens);
+}
+
+- (void)testTokenizingManyStrings
+{
+    RKStringTokenizer *stringTokenizer = [RKStringTokenizer new];
+    stringTokenizer.stopWords = [NSSet setWithObject:@"the"];
+    NSSet *tokens = [stringTokenizer tokenizeStrings:@[ @"The Cat", @"the hat", @"Cat in the Hat" ]];
+    NSSet *expectedTokens = [NSSet setWithArray:@[ @"cat", @"hat", @"in" ]];
+    expect(tokens).to.equal(expectedTokens);
+}
+
 @end
@@ -275,6 +275,12 @@ class RestKitTestServer < Sinatra::Base
     end
   end
 
+  get '/conditional/last_modified' do
+    content_type 'application/json'
+    last_modified Time.utc(2012, 10, 1)
+    {:human => {:name => "Blake Watters", :id => 1}}.to_json
+  end
+
   get '/object_manager/cancel' do
     sleep 0.05
     status 204